@@ -1,31 +1,53 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "AI/Decorators/BTDecorator_CheckEnemyState.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
-#include "AI/EnemyAIController.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Int.h"
+
+DECLARE_CYCLE_STAT(TEXT("BT Check Enemy State Condition"), STAT_Sairan_BTCheckEnemyState, STATGROUP_SairanAI);
 
 UBTDecorator_CheckEnemyState::UBTDecorator_CheckEnemyState()
 {
 	NodeName = TEXT("Check Enemy State");
 	StateToCheck = EEnemyState::Idle;
+
+	BlackboardKey.SelectedKeyName = AEnemyBase::BB_EnemyState;
+	BlackboardKey.AddIntFilter(this, GET_MEMBER_NAME_CHECKED(UBTDecorator_CheckEnemyState, BlackboardKey));
+
+	// React to state changes instead of polling
+	FlowAbortMode = EBTFlowAbortMode::Both;
 }
 
 bool UBTDecorator_CheckEnemyState::CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const
 {
-	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
-	if (!AIController)
+	SAIRAN_SCOPE(STAT_Sairan_BTCheckEnemyState, BehaviorTree);
+
+	const UBlackboardComponent* BlackboardComp = OwnerComp.GetBlackboardComponent();
+	if (!BlackboardComp)
 	{
 		return false;
 	}
 
-	AEnemyBase* Enemy = AIController->GetControlledEnemy();
-	if (!Enemy)
+	return BlackboardComp->GetValue<UBlackboardKeyType_Int>(BlackboardKey.GetSelectedKeyID()) == static_cast<int32>(StateToCheck);
+}
+
+EBlackboardNotificationResult UBTDecorator_CheckEnemyState::OnBlackboardKeyValueChange(const UBlackboardComponent& Blackboard, FBlackboard::FKey ChangedKeyID)
+{
+	UBehaviorTreeComponent* BehaviorComp = Cast<UBehaviorTreeComponent>(Blackboard.GetBrainComponent());
+	if (!BehaviorComp)
 	{
-		return false;
+		return EBlackboardNotificationResult::RemoveObserver;
 	}
 
-	return (Enemy->GetEnemyState() == StateToCheck);
+	// Only restart when the condition flips (Idle → Patrolling doesn't concern a Chasing check)
+	if (BlackboardKey.GetSelectedKeyID() == ChangedKeyID)
+	{
+		ConditionalFlowAbort(*BehaviorComp, EBTDecoratorAbortRequest::ConditionResultChanged);
+	}
+	return EBlackboardNotificationResult::ContinueObserving;
 }
 
 FString UBTDecorator_CheckEnemyState::GetStaticDescription() const
@@ -43,5 +65,5 @@ FString UBTDecorator_CheckEnemyState::GetStaticDescription() const
 	default: StateName = TEXT("Unknown"); break;
 	}
 
-	return FString::Printf(TEXT("State is %s"), *StateName);
+	return FString::Printf(TEXT("%s: State is %s"), *Super::GetStaticDescription(), *StateName);
 }
@@ -1,33 +1,55 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "AI/Decorators/BTDecorator_HasTarget.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
-#include "AI/EnemyAIController.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+
+DECLARE_CYCLE_STAT(TEXT("BT Has Target Condition"), STAT_Sairan_BTHasTarget, STATGROUP_SairanAI);
 
 UBTDecorator_HasTarget::UBTDecorator_HasTarget()
 {
 	NodeName = TEXT("Has Target");
+
+	BlackboardKey.SelectedKeyName = AEnemyBase::BB_TargetActor;
+	BlackboardKey.AddObjectFilter(this, GET_MEMBER_NAME_CHECKED(UBTDecorator_HasTarget, BlackboardKey), AActor::StaticClass());
+
+	// React to target acquired / lost instead of polling
+	FlowAbortMode = EBTFlowAbortMode::Both;
 }
 
 bool UBTDecorator_HasTarget::CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const
 {
-	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
-	if (!AIController)
+	SAIRAN_SCOPE(STAT_Sairan_BTHasTarget, BehaviorTree);
+
+	const UBlackboardComponent* BlackboardComp = OwnerComp.GetBlackboardComponent();
+	if (!BlackboardComp)
 	{
 		return false;
 	}
 
-	AEnemyBase* Enemy = AIController->GetControlledEnemy();
-	if (!Enemy)
+	return BlackboardComp->GetValue<UBlackboardKeyType_Object>(BlackboardKey.GetSelectedKeyID()) != nullptr;
+}
+
+EBlackboardNotificationResult UBTDecorator_HasTarget::OnBlackboardKeyValueChange(const UBlackboardComponent& Blackboard, FBlackboard::FKey ChangedKeyID)
+{
+	UBehaviorTreeComponent* BehaviorComp = Cast<UBehaviorTreeComponent>(Blackboard.GetBrainComponent());
+	if (!BehaviorComp)
 	{
-		return false;
+		return EBlackboardNotificationResult::RemoveObserver;
 	}
 
-	return (Enemy->GetCurrentTarget() != nullptr);
+	// Switching between two targets keeps the condition true: no restart
+	if (BlackboardKey.GetSelectedKeyID() == ChangedKeyID)
+	{
+		ConditionalFlowAbort(*BehaviorComp, EBTDecoratorAbortRequest::ConditionResultChanged);
+	}
+	return EBlackboardNotificationResult::ContinueObserving;
 }
 
 FString UBTDecorator_HasTarget::GetStaticDescription() const
 {
-	return TEXT("Has target");
+	return FString::Printf(TEXT("%s: has target"), *Super::GetStaticDescription());
 }
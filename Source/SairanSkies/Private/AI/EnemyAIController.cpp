@@ -1,20 +1,29 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "AI/EnemyAIController.h"
+#include "AI/EnemyBehaviorTreeComponent.h"
 #include "Enemies/EnemyBase.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "Perception/AIPerceptionComponent.h"
-#include "Perception/AISenseConfig_Sight.h"
-#include "Perception/AISenseConfig_Hearing.h"
-#include "Perception/AISense_Sight.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Float.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Int.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Vector.h"
+#include "AI/GroupCombatManager.h"
+#include "AI/EnemyPerceptionService.h"
+#include "AI/EnemyAvoidanceManager.h"
+#include "AI/EnemyPathRequestQueue.h"
+#include "AI/EnemyNavigationCache.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "NavigationData.h"
+#include "Enemies/EnemyMovementComponent.h"
 
 AEnemyAIController::AEnemyAIController()
 {
-	BehaviorTreeComponent = CreateDefaultSubobject<UBehaviorTreeComponent>(TEXT("BehaviorTreeComponent"));
+	BehaviorTreeComponent = CreateDefaultSubobject<UEnemyBehaviorTreeComponent>(TEXT("BehaviorTreeComponent"));
 	Blackboard = CreateDefaultSubobject<UBlackboardComponent>(TEXT("BlackboardComponent"));
-	SetPerceptionComponent(*CreateDefaultSubobject<UAIPerceptionComponent>(TEXT("PerceptionComponent")));
 }
 
 void AEnemyAIController::BeginPlay()
@@ -31,6 +40,11 @@ void AEnemyAIController::OnPossess(APawn* InPawn)
 	{
 		SetupPerceptionSystem();
 
+		if (UEnemyAvoidanceManager* Avoidance = GetWorld()->GetSubsystem<UEnemyAvoidanceManager>())
+		{
+			Avoidance->RegisterAgent(Cast<UEnemyMovementComponent>(Enemy->GetCharacterMovement()));
+		}
+
 		if (Enemy->BehaviorTree)
 		{
 			StartBehaviorTree(Enemy->BehaviorTree);
@@ -40,6 +54,21 @@ void AEnemyAIController::OnPossess(APawn* InPawn)
 
 void AEnemyAIController::OnUnPossess()
 {
+	CancelQueuedMove();
+
+	if (UEnemyPerceptionService* PerceptionService = GetWorld()->GetSubsystem<UEnemyPerceptionService>())
+	{
+		PerceptionService->UnregisterEnemy(GetControlledEnemy());
+	}
+
+	if (UEnemyAvoidanceManager* Avoidance = GetWorld()->GetSubsystem<UEnemyAvoidanceManager>())
+	{
+		if (AEnemyBase* Enemy = GetControlledEnemy())
+		{
+			Avoidance->UnregisterAgent(Cast<UEnemyMovementComponent>(Enemy->GetCharacterMovement()));
+		}
+	}
+
 	Super::OnUnPossess();
 	StopBehaviorTree();
 }
@@ -88,90 +117,283 @@ void AEnemyAIController::SetupPerceptionSystem()
 		return;
 	}
 
-	UAIPerceptionComponent* PerceptionComp = GetPerceptionComponent();
-	if (!PerceptionComp)
+	// Sight/hearing are evaluated for all enemies at once by the shared service
+	UEnemyPerceptionService* PerceptionService = GetWorld()->GetSubsystem<UEnemyPerceptionService>();
+	if (!PerceptionService)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SetupPerceptionSystem: No perception component!"));
+		UE_LOG(LogTemp, Warning, TEXT("SetupPerceptionSystem: No perception service!"));
 		return;
 	}
 
-	SightConfig = NewObject<UAISenseConfig_Sight>(this, UAISenseConfig_Sight::StaticClass(), TEXT("SightConfig"));
-	if (SightConfig)
+	PerceptionService->RegisterEnemy(Enemy);
+	
+	UE_LOG(LogTemp, Log, TEXT("SetupPerceptionSystem: %s registered - Sight: %.1f / %.1f deg, Hearing: %.1f"), 
+		*Enemy->GetName(), Enemy->PerceptionConfig.SightRadius, Enemy->PerceptionConfig.PeripheralVisionAngle,
+		Enemy->PerceptionConfig.HearingRadius);
+}
+
+void AEnemyAIController::SetSightEnabled(bool bEnabled)
+{
+	if (UEnemyPerceptionService* PerceptionService = GetWorld()->GetSubsystem<UEnemyPerceptionService>())
 	{
-		SightConfig->SightRadius = Enemy->PerceptionConfig.SightRadius;
-		SightConfig->LoseSightRadius = Enemy->PerceptionConfig.SightRadius + 500.0f;
-		SightConfig->PeripheralVisionAngleDegrees = Enemy->PerceptionConfig.PeripheralVisionAngle;
-		SightConfig->SetMaxAge(Enemy->PerceptionConfig.LoseSightTime);
-		SightConfig->AutoSuccessRangeFromLastSeenLocation = Enemy->PerceptionConfig.ProximityRadius;
-		
-		// Detect ALL targets - we filter by team attitude, not affiliation flags
-		SightConfig->DetectionByAffiliation.bDetectEnemies = true;
-		SightConfig->DetectionByAffiliation.bDetectNeutrals = true;
-		SightConfig->DetectionByAffiliation.bDetectFriendlies = false;
+		PerceptionService->SetSightEnabled(GetControlledEnemy(), bEnabled);
+	}
+}
 
-		PerceptionComp->ConfigureSense(*SightConfig);
-		
-		UE_LOG(LogTemp, Log, TEXT("SetupPerceptionSystem: Sight configured - Radius: %.1f, Angle: %.1f"), 
-			SightConfig->SightRadius, SightConfig->PeripheralVisionAngleDegrees);
+void AEnemyAIController::InitializeBlackboardValues()
+{
+	if (!Blackboard)
+	{
+		return;
 	}
 
-	HearingConfig = NewObject<UAISenseConfig_Hearing>(this, UAISenseConfig_Hearing::StaticClass(), TEXT("HearingConfig"));
-	if (HearingConfig)
+	TargetActorKey = Blackboard->GetKeyID(AEnemyBase::BB_TargetActor);
+	TargetLocationKey = Blackboard->GetKeyID(AEnemyBase::BB_TargetLocation);
+	EnemyStateKey = Blackboard->GetKeyID(AEnemyBase::BB_EnemyState);
+	CanSeeTargetKey = Blackboard->GetKeyID(AEnemyBase::BB_CanSeeTarget);
+	DistanceToTargetKey = Blackboard->GetKeyID(AEnemyBase::BB_DistanceToTarget);
+	CanAttackKey = Blackboard->GetKeyID(AEnemyBase::BB_CanAttack);
+	CombatManager = GetWorld()->GetSubsystem<UGroupCombatManager>();
+
+	Blackboard->SetValue<UBlackboardKeyType_Object>(TargetActorKey, nullptr);
+	Blackboard->SetValue<UBlackboardKeyType_Vector>(TargetLocationKey, FVector::ZeroVector);
+	Blackboard->SetValue<UBlackboardKeyType_Int>(EnemyStateKey, static_cast<int32>(EEnemyState::Idle));
+	Blackboard->SetValue<UBlackboardKeyType_Bool>(CanSeeTargetKey, false);
+	Blackboard->SetValueAsInt(AEnemyBase::BB_PatrolIndex, 0);
+	Blackboard->SetValue<UBlackboardKeyType_Float>(DistanceToTargetKey, 0.0f);
+	Blackboard->SetValue<UBlackboardKeyType_Bool>(CanAttackKey, true);
+	LastSyncedDistance = 0.0f;
+	LastSyncedTargetLocation = FVector::ZeroVector;
+
+	// A reused (pooled) enemy may already be mid-state
+	SyncBlackboard(EEnemyBlackboardSync::All);
+}
+
+void AEnemyAIController::SyncBlackboard(uint8 Mask)
+{
+	AEnemyBase* Enemy = GetControlledEnemy();
+	if (!Blackboard || !Enemy || Mask == EEnemyBlackboardSync::None)
 	{
-		HearingConfig->HearingRange = Enemy->PerceptionConfig.HearingRadius;
-		HearingConfig->SetMaxAge(Enemy->PerceptionConfig.LoseSightTime);
-		
-		HearingConfig->DetectionByAffiliation.bDetectEnemies = true;
-		HearingConfig->DetectionByAffiliation.bDetectNeutrals = true;
-		HearingConfig->DetectionByAffiliation.bDetectFriendlies = false;
+		return;
+	}
 
-		PerceptionComp->ConfigureSense(*HearingConfig);
-		
-		UE_LOG(LogTemp, Log, TEXT("SetupPerceptionSystem: Hearing configured - Range: %.1f"), 
-			HearingConfig->HearingRange);
+	AActor* Target = Enemy->GetCurrentTarget();
+
+	if (Mask & EEnemyBlackboardSync::Target)
+	{
+		Blackboard->SetValue<UBlackboardKeyType_Object>(TargetActorKey, Target);
 	}
 
-	PerceptionComp->SetDominantSense(UAISense_Sight::StaticClass());
-	
-	// Connect perception delegate
-	PerceptionComp->OnTargetPerceptionUpdated.AddDynamic(this, &AEnemyAIController::OnTargetPerceptionUpdated);
-	
-	// Force perception update
-	PerceptionComp->RequestStimuliListenerUpdate();
-	
-	UE_LOG(LogTemp, Log, TEXT("SetupPerceptionSystem: %s perception system ready"), *Enemy->GetName());
+	// Only write TargetLocation while there is a target (don't overwrite patrol points!)
+	if (Target && (Mask & (EEnemyBlackboardSync::Target | EEnemyBlackboardSync::TargetLocation)))
+	{
+		const FVector Location = Enemy->GetLastKnownTargetLocation();
+		if ((Mask & EEnemyBlackboardSync::Target) ||
+			FVector::DistSquared(Location, LastSyncedTargetLocation) >= FMath::Square(BlackboardDistanceQuantum))
+		{
+			LastSyncedTargetLocation = Location;
+			Blackboard->SetValue<UBlackboardKeyType_Vector>(TargetLocationKey, Location);
+		}
+	}
+
+	if (Mask & EEnemyBlackboardSync::State)
+	{
+		Blackboard->SetValue<UBlackboardKeyType_Int>(EnemyStateKey, static_cast<int32>(Enemy->GetEnemyState()));
+	}
+
+	if (Mask & EEnemyBlackboardSync::CanSeeTarget)
+	{
+		Blackboard->SetValue<UBlackboardKeyType_Bool>(CanSeeTargetKey, Enemy->CanSeeTarget());
+	}
+
+	if (Mask & EEnemyBlackboardSync::Distance)
+	{
+		// MAX_FLT without a target: always far from any real distance
+		const float Distance = Enemy->GetDistanceToTarget();
+		if (FMath::Abs(Distance - LastSyncedDistance) >= BlackboardDistanceQuantum)
+		{
+			LastSyncedDistance = Distance;
+			Blackboard->SetValue<UBlackboardKeyType_Float>(DistanceToTargetKey, Distance);
+		}
+	}
+
+	if (Mask & EEnemyBlackboardSync::CanAttack)
+	{
+		// CanAttack = enemy is in inner circle AND attack cooldown is ready
+		bool bCanAttack = Enemy->CanAttackNow();
+		if (CombatManager)
+		{
+			bCanAttack = bCanAttack && CombatManager->IsInInnerCircle(Enemy);
+		}
+		Blackboard->SetValue<UBlackboardKeyType_Bool>(CanAttackKey, bCanAttack);
+	}
 }
 
-void AEnemyAIController::OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus Stimulus)
+EPathFollowingRequestResult::Type AEnemyAIController::QueueMoveToLocation(const FVector& Dest, float AcceptanceRadius)
 {
-	AEnemyBase* Enemy = GetControlledEnemy();
-	if (!Enemy || !Actor)
+	// Same settings the movement tasks used with MoveToLocation
+	FAIMoveRequest MoveRequest(Dest);
+	MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
+	MoveRequest.SetReachTestIncludesAgentRadius(true);
+	MoveRequest.SetCanStrafe(true);
+	MoveRequest.SetAllowPartialPath(true);
+	MoveRequest.SetProjectGoalLocation(false);
+	return QueueMove(MoveRequest, Dest);
+}
+
+EPathFollowingRequestResult::Type AEnemyAIController::QueueMoveToActor(AActor* Goal, float AcceptanceRadius)
+{
+	if (!Goal)
+	{
+		return EPathFollowingRequestResult::Failed;
+	}
+
+	FAIMoveRequest MoveRequest(Goal);
+	MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
+	MoveRequest.SetReachTestIncludesAgentRadius(true);
+	MoveRequest.SetCanStrafe(true);
+	MoveRequest.SetAllowPartialPath(true);
+	return QueueMove(MoveRequest, Goal->GetActorLocation());
+}
+
+EPathFollowingRequestResult::Type AEnemyAIController::QueueMove(const FAIMoveRequest& MoveRequest, const FVector& Goal)
+{
+	CancelQueuedMove();
+	bQueuedMoveFailed = false;
+
+	UPathFollowingComponent* PathFollowing = GetPathFollowingComponent();
+	if (!GetPawn() || !PathFollowing)
+	{
+		return EPathFollowingRequestResult::Failed;
+	}
+
+	const bool bReached = MoveRequest.IsMoveToActor()
+		? PathFollowing->HasReached(*MoveRequest.GetGoalActor(), EPathFollowingReachMode::OverlapAgent, MoveRequest.GetAcceptanceRadius())
+		: PathFollowing->HasReached(Goal, EPathFollowingReachMode::OverlapAgent, MoveRequest.GetAcceptanceRadius());
+	if (bReached)
+	{
+		return EPathFollowingRequestResult::AlreadyAtGoal;
+	}
+
+	UEnemyPathRequestQueue* PathQueue = GetWorld()->GetSubsystem<UEnemyPathRequestQueue>();
+	if (!PathQueue)
+	{
+		return MoveTo(MoveRequest).Code;
+	}
+
+	QueuedPathRequest = PathQueue->RequestPath(this, Goal);
+	if (QueuedPathRequest == 0)
+	{
+		return EPathFollowingRequestResult::Failed;
+	}
+
+	QueuedMoveRequest = MoveRequest;
+	return EPathFollowingRequestResult::RequestSuccessful;
+}
+
+void AEnemyAIController::CancelQueuedMove()
+{
+	if (QueuedPathRequest == 0)
 	{
 		return;
 	}
-	
-	UE_LOG(LogTemp, Log, TEXT("AIController OnPerception: %s detected %s (Success: %s)"), 
-		*Enemy->GetName(), *Actor->GetName(), 
-		Stimulus.WasSuccessfullySensed() ? TEXT("YES") : TEXT("NO"));
-	
-	// Forward to Enemy for processing
-	Enemy->OnPerceptionUpdated(Actor, Stimulus);
+
+	if (UEnemyPathRequestQueue* PathQueue = GetWorld()->GetSubsystem<UEnemyPathRequestQueue>())
+	{
+		PathQueue->CancelRequest(QueuedPathRequest);
+	}
+	QueuedPathRequest = 0;
 }
 
-void AEnemyAIController::InitializeBlackboardValues()
+FAIRequestID AEnemyAIController::FollowCachedPath(const FAIMoveRequest& MoveRequest, FNavPathSharedPtr Path)
 {
-	if (!Blackboard)
+	CancelQueuedMove();
+	bQueuedMoveFailed = false;
+	return RequestMove(MoveRequest, Path);
+}
+
+void AEnemyAIController::StopMovement()
+{
+	CancelQueuedMove();
+	bQueuedMoveFailed = false;
+	Super::StopMovement();
+}
+
+void AEnemyAIController::OnQueuedPathReady(FNavPathSharedPtr Path)
+{
+	QueuedPathRequest = 0;
+
+	APawn* MyPawn = GetPawn();
+	if (!MyPawn || !Path.IsValid() || Path->GetPathPoints().Num() < 2)
 	{
+		UE_LOG(LogTemp, Verbose, TEXT("EnemyAI: %s queued path failed"), *GetName());
+		bQueuedMoveFailed = true;
 		return;
 	}
 
-	Blackboard->SetValueAsObject(AEnemyBase::BB_TargetActor, nullptr);
-	Blackboard->SetValueAsVector(AEnemyBase::BB_TargetLocation, FVector::ZeroVector);
-	Blackboard->SetValueAsInt(AEnemyBase::BB_EnemyState, static_cast<int32>(EEnemyState::Idle));
-	Blackboard->SetValueAsBool(AEnemyBase::BB_CanSeeTarget, false);
-	Blackboard->SetValueAsInt(AEnemyBase::BB_PatrolIndex, 0);
-	Blackboard->SetValueAsFloat(AEnemyBase::BB_DistanceToTarget, 0.0f);
-	Blackboard->SetValueAsBool(AEnemyBase::BB_CanAttack, true);
+	AActor* GoalActor = QueuedMoveRequest.GetGoalActor();
+	if (QueuedMoveRequest.IsMoveToActor() && !GoalActor)
+	{
+		bQueuedMoveFailed = true;
+		return;
+	}
+
+	// The batch was queried between the first requester's endpoints; ours lie in the same
+	// cells, but the hop from them to our own endpoints can still cross a wall
+	const ANavigationData* NavData = Path->GetNavigationDataUsed();
+	auto IsBlocked = [this, NavData, &Path](const FVector& From, const FVector& To)
+	{
+		FVector HitLocation;
+		return NavData && NavData->Raycast(From, To, HitLocation, Path->GetFilter(), this);
+	};
+
+	FNavPathSharedPtr OwnPath = UEnemyNavigationCache::CopyPath(Path);
+	TArray<FNavPathPoint>& Points = OwnPath->GetPathPoints();
+
+	// Replace the batch start when we see its second point, else walk to the batch start first
+	const FVector Start = MyPawn->GetNavAgentLocation();
+	if (!IsBlocked(Start, Points[1].Location))
+	{
+		Points[0].Location = Start;
+	}
+	else if (!IsBlocked(Start, Points[0].Location))
+	{
+		Points.Insert(FNavPathPoint(Start), 0);
+	}
+	else
+	{
+		// Not connected to the batch start after all: path on our own
+		if (MoveTo(QueuedMoveRequest).Code == EPathFollowingRequestResult::Failed)
+		{
+			bQueuedMoveFailed = true;
+		}
+		return;
+	}
+
+	if (!GoalActor && !OwnPath->IsPartial())
+	{
+		const FVector Goal = QueuedMoveRequest.GetGoalLocation();
+		if (!IsBlocked(Points[Points.Num() - 2].Location, Goal))
+		{
+			Points.Last().Location = Goal;
+		}
+		else if (!IsBlocked(Points.Last().Location, Goal))
+		{
+			Points.Add(FNavPathPoint(Goal));
+		}
+		// Otherwise stop at the batch goal: same cell, within the acceptance radius of most moves
+	}
+
+	OwnPath->SetQuerier(this);
+	OwnPath->SetFilter(Path->GetFilter());
+	OwnPath->EnableRecalculationOnInvalidation(true);
+	if (GoalActor)
+	{
+		// Same re-path threshold AAIController::MoveTo uses for actor goals
+		OwnPath->SetGoalActorObservation(*GoalActor, 100.0f);
+	}
+
+	RequestMove(QueuedMoveRequest, OwnPath);
 }
 
 ETeamAttitude::Type AEnemyAIController::GetTeamAttitudeTowards(const AActor& Other) const
@@ -0,0 +1,301 @@
+// SairanSkies - Enemy Ambient Director
+
+#include "AI/EnemyAmbientDirector.h"
+#include "Core/SairanStats.h"
+#include "Enemies/EnemyBase.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Ambient Director Tick"), STAT_Sairan_AmbientTick, STATGROUP_SairanAI);
+
+void UEnemyAmbientDirector::Deinitialize()
+{
+	for (const FAmbientRecord& Record : Records)
+	{
+		if (AEnemyBase* Enemy = Record.Enemy.Get())
+		{
+			Enemy->AmbientHandle = INDEX_NONE;
+		}
+	}
+
+	Records.Empty();
+	FreeHandles.Empty();
+	for (TArray<FWheelEvent>& Bucket : Wheel)
+	{
+		Bucket.Empty();
+	}
+	Candidates.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UEnemyAmbientDirector::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyAmbientDirector, STATGROUP_Tickables);
+}
+
+int32 UEnemyAmbientDirector::GetHandle(const AEnemyBase* Enemy) const
+{
+	if (!Enemy) return INDEX_NONE;
+	const int32 Handle = Enemy->AmbientHandle;
+	return (Records.IsValidIndex(Handle) && Records[Handle].Enemy.Get() == Enemy) ? Handle : INDEX_NONE;
+}
+
+int32 UEnemyAmbientDirector::FindOrAddRecord(AEnemyBase* Enemy)
+{
+	int32 Handle = GetHandle(Enemy);
+	if (Handle != INDEX_NONE) return Handle;
+
+	// Serials are kept on reuse so events of the previous owner stay stale
+	Handle = FreeHandles.Num() > 0 ? FreeHandles.Pop(EAllowShrinking::No) : Records.AddDefaulted();
+	FAmbientRecord& Record = Records[Handle];
+	Record.Enemy = Enemy;
+	Record.PendingMask = 0;
+	Record.bCandidate = false;
+	Enemy->AmbientHandle = Handle;
+	return Handle;
+}
+
+void UEnemyAmbientDirector::UnregisterEnemy(AEnemyBase* Enemy)
+{
+	const int32 Handle = GetHandle(Enemy);
+	if (Handle == INDEX_NONE) return;
+
+	FAmbientRecord& Record = Records[Handle];
+	for (uint32& Serial : Record.Serial)
+	{
+		++Serial;
+	}
+	if (Record.bCandidate)
+	{
+		Candidates.RemoveSingleSwap(Handle, EAllowShrinking::No);
+	}
+
+	Record.Enemy.Reset();
+	Record.PendingMask = 0;
+	Record.bCandidate = false;
+	FreeHandles.Add(Handle);
+	Enemy->AmbientHandle = INDEX_NONE;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TIMING WHEEL
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyAmbientDirector::Schedule(AEnemyBase* Enemy, EEnemyAmbientEvent Event, float Seconds)
+{
+	if (!IsValid(Enemy)) return;
+
+	const int32 Handle = FindOrAddRecord(Enemy);
+	FAmbientRecord& Record = Records[Handle];
+	const int32 EventIndex = static_cast<int32>(Event);
+
+	// Always at least one bucket ahead: the event fires on a later frame
+	const int32 Ticks = FMath::Max(1, FMath::CeilToInt32(Seconds / SlotDuration));
+
+	FWheelEvent& Entry = Wheel[(CurrentBucket + Ticks) % WheelSize].AddDefaulted_GetRef();
+	Entry.Handle = Handle;
+	Entry.Serial = ++Record.Serial[EventIndex];
+	Entry.Rounds = static_cast<uint16>(FMath::Min((Ticks - 1) / WheelSize, static_cast<int32>(MAX_uint16)));
+	Entry.Event = Event;
+
+	Record.PendingMask |= (1 << EventIndex);
+}
+
+void UEnemyAmbientDirector::Cancel(const AEnemyBase* Enemy, EEnemyAmbientEvent Event)
+{
+	const int32 Handle = GetHandle(Enemy);
+	if (Handle == INDEX_NONE) return;
+
+	const int32 EventIndex = static_cast<int32>(Event);
+	++Records[Handle].Serial[EventIndex];
+	Records[Handle].PendingMask &= ~(1 << EventIndex);
+}
+
+bool UEnemyAmbientDirector::IsScheduled(const AEnemyBase* Enemy, EEnemyAmbientEvent Event) const
+{
+	const int32 Handle = GetHandle(Enemy);
+	return Handle != INDEX_NONE && (Records[Handle].PendingMask & (1 << static_cast<int32>(Event))) != 0;
+}
+
+void UEnemyAmbientDirector::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_AmbientTick, AITick);
+
+	BucketAccumulator += DeltaTime;
+	while (BucketAccumulator >= SlotDuration)
+	{
+		BucketAccumulator -= SlotDuration;
+		AdvanceBucket();
+	}
+
+	TimeSinceMatch += DeltaTime;
+	if (TimeSinceMatch >= MatchInterval && Candidates.Num() > 1)
+	{
+		TimeSinceMatch = 0.0f;
+		MatchConversations();
+	}
+}
+
+void UEnemyAmbientDirector::AdvanceBucket()
+{
+	CurrentBucket = (CurrentBucket + 1) % WheelSize;
+	TArray<FWheelEvent>& Bucket = Wheel[CurrentBucket];
+	if (Bucket.Num() == 0) return;
+
+	// Split into due / later turns in place; stale (cancelled / replaced) events vanish
+	DueEvents.Reset();
+	int32 Kept = 0;
+	for (int32 i = 0; i < Bucket.Num(); ++i)
+	{
+		FWheelEvent& Entry = Bucket[i];
+		const FAmbientRecord& Record = Records[Entry.Handle];
+		if (Record.Serial[static_cast<int32>(Entry.Event)] != Entry.Serial) continue;
+
+		if (Entry.Rounds > 0)
+		{
+			--Entry.Rounds;
+			Bucket[Kept++] = Entry;
+		}
+		else
+		{
+			DueEvents.Add(Entry);
+		}
+	}
+	Bucket.SetNum(Kept, EAllowShrinking::No);
+
+	// Dispatch after the bucket is consistent (handlers re-schedule / unregister)
+	for (const FWheelEvent& Entry : DueEvents)
+	{
+		FAmbientRecord& Record = Records[Entry.Handle];
+		const int32 EventIndex = static_cast<int32>(Entry.Event);
+		if (Record.Serial[EventIndex] != Entry.Serial) continue;
+
+		Record.PendingMask &= ~(1 << EventIndex);
+		if (AEnemyBase* Enemy = Record.Enemy.Get())
+		{
+			Enemy->OnAmbientEvent(Entry.Event);
+		}
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CONVERSATIONS
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyAmbientDirector::AddConversationCandidate(AEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy)) return;
+
+	const int32 Handle = FindOrAddRecord(Enemy);
+	if (!Records[Handle].bCandidate)
+	{
+		Records[Handle].bCandidate = true;
+		Candidates.Add(Handle);
+	}
+}
+
+void UEnemyAmbientDirector::RemoveConversationCandidate(const AEnemyBase* Enemy)
+{
+	const int32 Handle = GetHandle(Enemy);
+	if (Handle != INDEX_NONE && Records[Handle].bCandidate)
+	{
+		Records[Handle].bCandidate = false;
+		Candidates.RemoveSingleSwap(Handle, EAllowShrinking::No);
+	}
+}
+
+uint64 UEnemyAmbientDirector::MakeCellKey(int32 CellX, int32 CellY) const
+{
+	return (static_cast<uint64>(static_cast<uint32>(CellX)) << 32) | static_cast<uint32>(CellY);
+}
+
+void UEnemyAmbientDirector::MatchConversations()
+{
+	// Gather candidates that can still talk (drop the rest)
+	MatchEnemies.Reset();
+	for (int32 i = Candidates.Num() - 1; i >= 0; --i)
+	{
+		FAmbientRecord& Record = Records[Candidates[i]];
+		AEnemyBase* Enemy = Record.Enemy.Get();
+		if (!Enemy || !Enemy->CanStartConversation() || !Enemy->bReadyForConversation)
+		{
+			Record.bCandidate = false;
+			Candidates.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+		MatchEnemies.Add(Enemy);
+	}
+
+	const int32 Num = MatchEnemies.Num();
+	if (Num < 2) return;
+
+	// Bucket by cell: sorted indices + per-cell ranges
+	MatchLocations.SetNumUninitialized(Num);
+	MatchKeys.SetNumUninitialized(Num);
+	SortedMatch.SetNumUninitialized(Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		MatchLocations[i] = MatchEnemies[i]->GetActorLocation();
+		MatchKeys[i] = MakeCellKey(FMath::FloorToInt32(MatchLocations[i].X / MatchCellSize),
+			FMath::FloorToInt32(MatchLocations[i].Y / MatchCellSize));
+		SortedMatch[i] = i;
+	}
+	SortedMatch.Sort([this](int32 A, int32 B) { return MatchKeys[A] < MatchKeys[B]; });
+
+	CellRanges.Reset();
+	for (int32 i = 0; i < Num;)
+	{
+		const uint64 Key = MatchKeys[SortedMatch[i]];
+		int32 End = i + 1;
+		while (End < Num && MatchKeys[SortedMatch[End]] == Key)
+		{
+			++End;
+		}
+		CellRanges.Add(Key, FIntPoint(i, End - i));
+		i = End;
+	}
+
+	// Greedy nearest pairing
+	Matched.Init(false, Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		if (Matched[i]) continue;
+
+		AEnemyBase* Initiator = MatchEnemies[i];
+		const float Radius = Initiator->ConversationConfig.ConversationRadius;
+		const int32 Rings = FMath::Max(1, FMath::CeilToInt32(Radius / MatchCellSize));
+		const int32 CellX = FMath::FloorToInt32(MatchLocations[i].X / MatchCellSize);
+		const int32 CellY = FMath::FloorToInt32(MatchLocations[i].Y / MatchCellSize);
+
+		int32 Best = INDEX_NONE;
+		float BestDistSq = FMath::Square(Radius);
+		for (int32 DX = -Rings; DX <= Rings; ++DX)
+		{
+			for (int32 DY = -Rings; DY <= Rings; ++DY)
+			{
+				const FIntPoint* Range = CellRanges.Find(MakeCellKey(CellX + DX, CellY + DY));
+				if (!Range) continue;
+
+				for (int32 k = Range->X; k < Range->X + Range->Y; ++k)
+				{
+					const int32 Other = SortedMatch[k];
+					if (Other == i || Matched[Other]) continue;
+
+					const float DistSq = FVector::DistSquared(MatchLocations[i], MatchLocations[Other]);
+					if (DistSq <= BestDistSq)
+					{
+						BestDistSq = DistSq;
+						Best = Other;
+					}
+				}
+			}
+		}
+
+		if (Best != INDEX_NONE && Initiator->TryStartConversation(MatchEnemies[Best]))
+		{
+			Matched[i] = true;
+			Matched[Best] = true;
+			RemoveConversationCandidate(Initiator);
+			RemoveConversationCandidate(MatchEnemies[Best]);
+		}
+	}
+}
@@ -0,0 +1,476 @@
+// SairanSkies - Enemy Avoidance Manager
+
+#include "AI/EnemyAvoidanceManager.h"
+#include "Core/SairanStats.h"
+#include "Enemies/EnemyMovementComponent.h"
+#include "Enemies/EnemyBase.h"
+#include "Components/CapsuleComponent.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Avoidance Tick"), STAT_Sairan_AvoidanceTick, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("Avoidance Apply"), STAT_Sairan_AvoidanceApply, STATGROUP_SairanAI);
+
+namespace EnemyAvoidance
+{
+	// ORCA half-plane: velocities on the left of Direction through Point are allowed
+	struct FLine
+	{
+		FVector2f Point;
+		FVector2f Direction;
+	};
+
+	using FLineArray = TArray<FLine, TInlineAllocator<32>>;
+
+	static constexpr float Epsilon = 1.0e-5f;
+
+	static float Det(const FVector2f& A, const FVector2f& B)
+	{
+		return A.X * B.Y - A.Y * B.X;
+	}
+
+	/** Optimise along one line, constrained by the previous ones and the speed circle */
+	static bool LinearProgram1(const FLineArray& Lines, int32 LineNo, float Radius,
+		const FVector2f& OptVelocity, bool bDirectionOpt, FVector2f& Result)
+	{
+		const FLine& Line = Lines[LineNo];
+		const float DotProduct = Line.Point | Line.Direction;
+		const float Discriminant = FMath::Square(DotProduct) + FMath::Square(Radius) - Line.Point.SizeSquared();
+		if (Discriminant < 0.0f) return false;
+
+		const float SqrtDiscriminant = FMath::Sqrt(Discriminant);
+		float TLeft = -DotProduct - SqrtDiscriminant;
+		float TRight = -DotProduct + SqrtDiscriminant;
+
+		for (int32 i = 0; i < LineNo; ++i)
+		{
+			const float Denominator = Det(Line.Direction, Lines[i].Direction);
+			const float Numerator = Det(Lines[i].Direction, Line.Point - Lines[i].Point);
+
+			if (FMath::Abs(Denominator) <= Epsilon)
+			{
+				// Parallel lines
+				if (Numerator < 0.0f) return false;
+				continue;
+			}
+
+			const float T = Numerator / Denominator;
+			if (Denominator >= 0.0f)
+			{
+				TRight = FMath::Min(TRight, T);
+			}
+			else
+			{
+				TLeft = FMath::Max(TLeft, T);
+			}
+			if (TLeft > TRight) return false;
+		}
+
+		if (bDirectionOpt)
+		{
+			Result = Line.Point + ((OptVelocity | Line.Direction) > 0.0f ? TRight : TLeft) * Line.Direction;
+		}
+		else
+		{
+			const float T = Line.Direction | (OptVelocity - Line.Point);
+			Result = Line.Point + FMath::Clamp(T, TLeft, TRight) * Line.Direction;
+		}
+		return true;
+	}
+
+	/** Returns Lines.Num() on success, otherwise the index of the first line that failed */
+	static int32 LinearProgram2(const FLineArray& Lines, float Radius,
+		const FVector2f& OptVelocity, bool bDirectionOpt, FVector2f& Result)
+	{
+		if (bDirectionOpt)
+		{
+			Result = OptVelocity * Radius;
+		}
+		else if (OptVelocity.SizeSquared() > FMath::Square(Radius))
+		{
+			Result = OptVelocity.GetSafeNormal() * Radius;
+		}
+		else
+		{
+			Result = OptVelocity;
+		}
+
+		for (int32 i = 0; i < Lines.Num(); ++i)
+		{
+			if (Det(Lines[i].Direction, Lines[i].Point - Result) > 0.0f)
+			{
+				const FVector2f TempResult = Result;
+				if (!LinearProgram1(Lines, i, Radius, OptVelocity, bDirectionOpt, Result))
+				{
+					Result = TempResult;
+					return i;
+				}
+			}
+		}
+		return Lines.Num();
+	}
+
+	/** Infeasible (too crowded): minimise the maximum penetration into the half-planes */
+	static void LinearProgram3(const FLineArray& Lines, int32 BeginLine, float Radius, FVector2f& Result)
+	{
+		float Distance = 0.0f;
+
+		for (int32 i = BeginLine; i < Lines.Num(); ++i)
+		{
+			if (Det(Lines[i].Direction, Lines[i].Point - Result) <= Distance) continue;
+
+			FLineArray ProjLines;
+			for (int32 j = 0; j < i; ++j)
+			{
+				FLine Line;
+				const float Determinant = Det(Lines[i].Direction, Lines[j].Direction);
+
+				if (FMath::Abs(Determinant) <= Epsilon)
+				{
+					// Same direction: already covered; opposite: take the midpoint
+					if ((Lines[i].Direction | Lines[j].Direction) > 0.0f) continue;
+					Line.Point = 0.5f * (Lines[i].Point + Lines[j].Point);
+				}
+				else
+				{
+					Line.Point = Lines[i].Point +
+						(Det(Lines[j].Direction, Lines[i].Point - Lines[j].Point) / Determinant) * Lines[i].Direction;
+				}
+
+				Line.Direction = (Lines[j].Direction - Lines[i].Direction).GetSafeNormal();
+				ProjLines.Add(Line);
+			}
+
+			const FVector2f TempResult = Result;
+			const FVector2f Perp(-Lines[i].Direction.Y, Lines[i].Direction.X);
+			if (LinearProgram2(ProjLines, Radius, Perp, true, Result) < ProjLines.Num())
+			{
+				// Only fails from floating point error; keep the previous result
+				Result = TempResult;
+			}
+
+			Distance = Det(Lines[i].Direction, Lines[i].Point - Result);
+		}
+	}
+}
+
+void UEnemyAvoidanceManager::Deinitialize()
+{
+	for (const TWeakObjectPtr<UEnemyMovementComponent>& Agent : Agents)
+	{
+		if (UEnemyMovementComponent* Movement = Agent.Get())
+		{
+			Movement->AvoidanceSlot = INDEX_NONE;
+			Movement->AvoidanceManager = nullptr;
+		}
+	}
+
+	Agents.Empty();
+	SetNum(0);
+	CellRanges.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UEnemyAvoidanceManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyAvoidanceManager, STATGROUP_Tickables);
+}
+
+int32 UEnemyAvoidanceManager::GetSlot(const UEnemyMovementComponent* Movement) const
+{
+	if (!Movement) return INDEX_NONE;
+	const int32 Slot = Movement->AvoidanceSlot;
+	return (Agents.IsValidIndex(Slot) && Agents[Slot].Get() == Movement) ? Slot : INDEX_NONE;
+}
+
+void UEnemyAvoidanceManager::SetNum(int32 Num)
+{
+	PosX.SetNumZeroed(Num);
+	PosY.SetNumZeroed(Num);
+	VelX.SetNumZeroed(Num);
+	VelY.SetNumZeroed(Num);
+	PrefX.SetNumZeroed(Num);
+	PrefY.SetNumZeroed(Num);
+	Radius.SetNumZeroed(Num);
+	MaxSpeed.SetNumZeroed(Num);
+	DeltaX.SetNumZeroed(Num);
+	DeltaY.SetNumZeroed(Num);
+	Active.SetNumZeroed(Num);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REGISTRATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyAvoidanceManager::RegisterAgent(UEnemyMovementComponent* Movement)
+{
+	if (!IsValid(Movement) || GetSlot(Movement) != INDEX_NONE) return;
+
+	const int32 Slot = Agents.Add(Movement);
+	SetNum(Agents.Num());
+	Movement->AvoidanceSlot = Slot;
+	Movement->AvoidanceManager = this;
+}
+
+void UEnemyAvoidanceManager::UnregisterAgent(UEnemyMovementComponent* Movement)
+{
+	const int32 Slot = GetSlot(Movement);
+	if (Slot == INDEX_NONE) return;
+
+	// Swap-remove every array so the last agent takes this slot
+	const int32 Last = Agents.Num() - 1;
+	if (Slot != Last)
+	{
+		Agents[Slot] = Agents[Last];
+		PrefX[Slot] = PrefX[Last];
+		PrefY[Slot] = PrefY[Last];
+		DeltaX[Slot] = DeltaX[Last];
+		DeltaY[Slot] = DeltaY[Last];
+		if (UEnemyMovementComponent* Moved = Agents[Slot].Get())
+		{
+			Moved->AvoidanceSlot = Slot;
+		}
+	}
+	Agents.RemoveAt(Last, 1, EAllowShrinking::No);
+	SetNum(Agents.Num());
+
+	Movement->AvoidanceSlot = INDEX_NONE;
+	Movement->AvoidanceManager = nullptr;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// MOVEMENT HOOK
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyAvoidanceManager::ApplyAvoidance(UEnemyMovementComponent* Movement, FVector& InOutVelocity)
+{
+	SAIRAN_SCOPE(STAT_Sairan_AvoidanceApply, Movement);
+
+	const int32 Slot = GetSlot(Movement);
+	if (Slot == INDEX_NONE) return;
+
+	PrefX[Slot] = InOutVelocity.X;
+	PrefY[Slot] = InOutVelocity.Y;
+
+	if (!bEnabled || (DeltaX[Slot] == 0.0f && DeltaY[Slot] == 0.0f)) return;
+
+	// Correction from the last solve on top of what the agent wants now
+	FVector2f Corrected(InOutVelocity.X + DeltaX[Slot], InOutVelocity.Y + DeltaY[Slot]);
+	const float Speed = Movement->GetMaxSpeed();
+	if (Corrected.SizeSquared() > FMath::Square(Speed))
+	{
+		Corrected = Corrected.GetSafeNormal() * Speed;
+	}
+	InOutVelocity.X = Corrected.X;
+	InOutVelocity.Y = Corrected.Y;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FRAME
+// ═══════════════════════════════════════════════════════════════════════════
+
+uint64 UEnemyAvoidanceManager::MakeCellKey(int32 CellX, int32 CellY) const
+{
+	return (static_cast<uint64>(static_cast<uint32>(CellX)) << 32) | static_cast<uint32>(CellY);
+}
+
+void UEnemyAvoidanceManager::PackAgents()
+{
+	for (int32 Slot = 0; Slot < Agents.Num(); ++Slot)
+	{
+		const UEnemyMovementComponent* Movement = Agents[Slot].Get();
+		const AEnemyBase* Enemy = Movement ? Cast<AEnemyBase>(Movement->GetOwner()) : nullptr;
+
+		Active[Slot] = Enemy && !Enemy->IsDead() && Movement->IsMovingOnGround();
+		if (!Active[Slot])
+		{
+			DeltaX[Slot] = DeltaY[Slot] = 0.0f;
+			continue;
+		}
+
+		const FVector Location = Enemy->GetActorLocation();
+		PosX[Slot] = Location.X;
+		PosY[Slot] = Location.Y;
+		VelX[Slot] = Movement->Velocity.X;
+		VelY[Slot] = Movement->Velocity.Y;
+		MaxSpeed[Slot] = Movement->GetMaxSpeed();
+
+		const UCapsuleComponent* Capsule = Enemy->GetCapsuleComponent();
+		Radius[Slot] = (Capsule ? Capsule->GetScaledCapsuleRadius() : 40.0f) * RadiusScale;
+	}
+}
+
+void UEnemyAvoidanceManager::BuildGrid()
+{
+	SortedSlots.Reset();
+	CellKeys.SetNumUninitialized(Agents.Num());
+
+	for (int32 Slot = 0; Slot < Agents.Num(); ++Slot)
+	{
+		if (!Active[Slot]) continue;
+		CellKeys[Slot] = MakeCellKey(FMath::FloorToInt32(PosX[Slot] / NeighbourRadius), FMath::FloorToInt32(PosY[Slot] / NeighbourRadius));
+		SortedSlots.Add(Slot);
+	}
+
+	SortedSlots.Sort([this](int32 A, int32 B) { return CellKeys[A] < CellKeys[B]; });
+
+	CellRanges.Reset();
+	for (int32 i = 0; i < SortedSlots.Num();)
+	{
+		const uint64 Key = CellKeys[SortedSlots[i]];
+		int32 End = i + 1;
+		while (End < SortedSlots.Num() && CellKeys[SortedSlots[End]] == Key)
+		{
+			++End;
+		}
+		CellRanges.Add(Key, FIntPoint(i, End - i));
+		i = End;
+	}
+}
+
+void UEnemyAvoidanceManager::SolveAgent(int32 Slot, float DeltaTime)
+{
+	using namespace EnemyAvoidance;
+
+	const FVector2f Position(PosX[Slot], PosY[Slot]);
+	const FVector2f Velocity(VelX[Slot], VelY[Slot]);
+	const FVector2f Preferred(PrefX[Slot], PrefY[Slot]);
+	const float RangeSq = FMath::Square(NeighbourRadius);
+
+	// Nearest neighbours from the 3x3 cells around the agent (sorted insert, small N)
+	struct FNeighbour
+	{
+		float DistSq;
+		int32 Slot;
+	};
+	TArray<FNeighbour, TInlineAllocator<32>> Neighbours;
+
+	const int32 CellX = FMath::FloorToInt32(Position.X / NeighbourRadius);
+	const int32 CellY = FMath::FloorToInt32(Position.Y / NeighbourRadius);
+	for (int32 DY = -1; DY <= 1; ++DY)
+	{
+		for (int32 DX = -1; DX <= 1; ++DX)
+		{
+			const FIntPoint* Range = CellRanges.Find(MakeCellKey(CellX + DX, CellY + DY));
+			if (!Range) continue;
+
+			for (int32 i = Range->X; i < Range->X + Range->Y; ++i)
+			{
+				const int32 Other = SortedSlots[i];
+				if (Other == Slot) continue;
+
+				const float DistSq = FVector2f::DistSquared(Position, FVector2f(PosX[Other], PosY[Other]));
+				if (DistSq >= RangeSq) continue;
+				if (Neighbours.Num() == MaxNeighbours && DistSq >= Neighbours.Last().DistSq) continue;
+
+				int32 Insert = Neighbours.Num();
+				while (Insert > 0 && Neighbours[Insert - 1].DistSq > DistSq)
+				{
+					--Insert;
+				}
+				Neighbours.Insert(FNeighbour{ DistSq, Other }, Insert);
+				if (Neighbours.Num() > MaxNeighbours)
+				{
+					Neighbours.Pop(EAllowShrinking::No);
+				}
+			}
+		}
+	}
+
+	if (Neighbours.Num() == 0)
+	{
+		DeltaX[Slot] = DeltaY[Slot] = 0.0f;
+		return;
+	}
+
+	// One ORCA half-plane per neighbour; each side takes half the responsibility
+	const float InvTimeHorizon = 1.0f / TimeHorizon;
+	FLineArray Lines;
+
+	for (const FNeighbour& Neighbour : Neighbours)
+	{
+		const int32 Other = Neighbour.Slot;
+		const FVector2f RelativePosition = FVector2f(PosX[Other], PosY[Other]) - Position;
+		const FVector2f RelativeVelocity = Velocity - FVector2f(VelX[Other], VelY[Other]);
+		const float DistSq = Neighbour.DistSq;
+		const float CombinedRadius = Radius[Slot] + Radius[Other];
+		const float CombinedRadiusSq = FMath::Square(CombinedRadius);
+
+		FLine Line;
+		FVector2f U;
+
+		if (DistSq > CombinedRadiusSq)
+		{
+			// No collision yet: vector from cutoff centre to relative velocity
+			const FVector2f W = RelativeVelocity - InvTimeHorizon * RelativePosition;
+			const float WLengthSq = W.SizeSquared();
+			const float DotProduct1 = W | RelativePosition;
+
+			if (DotProduct1 < 0.0f && FMath::Square(DotProduct1) > CombinedRadiusSq * WLengthSq)
+			{
+				// Project on the cut-off circle
+				const float WLength = FMath::Sqrt(WLengthSq);
+				const FVector2f UnitW = W / WLength;
+				Line.Direction = FVector2f(UnitW.Y, -UnitW.X);
+				U = (CombinedRadius * InvTimeHorizon - WLength) * UnitW;
+			}
+			else
+			{
+				// Project on the legs
+				const float Leg = FMath::Sqrt(DistSq - CombinedRadiusSq);
+				if (Det(RelativePosition, W) > 0.0f)
+				{
+					Line.Direction = FVector2f(
+						RelativePosition.X * Leg - RelativePosition.Y * CombinedRadius,
+						RelativePosition.X * CombinedRadius + RelativePosition.Y * Leg) / DistSq;
+				}
+				else
+				{
+					Line.Direction = -FVector2f(
+						RelativePosition.X * Leg + RelativePosition.Y * CombinedRadius,
+						-RelativePosition.X * CombinedRadius + RelativePosition.Y * Leg) / DistSq;
+				}
+				U = (RelativeVelocity | Line.Direction) * Line.Direction - RelativeVelocity;
+			}
+		}
+		else
+		{
+			// Already overlapping: separate within this frame
+			const float InvTimeStep = 1.0f / FMath::Max(DeltaTime, KINDA_SMALL_NUMBER);
+			const FVector2f W = RelativeVelocity - InvTimeStep * RelativePosition;
+			const float WLength = W.Size();
+			const FVector2f UnitW = WLength > Epsilon ? W / WLength : FVector2f(1.0f, 0.0f);
+			Line.Direction = FVector2f(UnitW.Y, -UnitW.X);
+			U = (CombinedRadius * InvTimeStep - WLength) * UnitW;
+		}
+
+		Line.Point = Velocity + 0.5f * U;
+		Lines.Add(Line);
+	}
+
+	FVector2f NewVelocity;
+	const int32 LineFail = LinearProgram2(Lines, MaxSpeed[Slot], Preferred, false, NewVelocity);
+	if (LineFail < Lines.Num())
+	{
+		LinearProgram3(Lines, LineFail, MaxSpeed[Slot], NewVelocity);
+	}
+
+	DeltaX[Slot] = NewVelocity.X - Preferred.X;
+	DeltaY[Slot] = NewVelocity.Y - Preferred.Y;
+}
+
+void UEnemyAvoidanceManager::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_AvoidanceTick, Movement);
+
+	if (!bEnabled || Agents.Num() == 0 || DeltaTime <= 0.0f) return;
+
+	PackAgents();
+	BuildGrid();
+
+	// Agents only read shared inputs and write their own Delta: safe to split
+	ParallelFor(SortedSlots.Num(), [this, DeltaTime](int32 Index)
+	{
+		SolveAgent(SortedSlots[Index], DeltaTime);
+	}, SortedSlots.Num() < 64);
+}
@@ -0,0 +1,13 @@
+// SairanSkies - Enemy Behavior Tree Component
+
+#include "AI/EnemyBehaviorTreeComponent.h"
+#include "Core/SairanStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Behavior Tree Tick"), STAT_Sairan_BehaviorTreeTick, STATGROUP_SairanAI);
+
+void UEnemyBehaviorTreeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	SAIRAN_SCOPE(STAT_Sairan_BehaviorTreeTick, BehaviorTree);
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+}
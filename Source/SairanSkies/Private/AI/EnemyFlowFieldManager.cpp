@@ -0,0 +1,501 @@
+// SairanSkies - Enemy Flow Field Manager
+
+#include "AI/EnemyFlowFieldManager.h"
+#include "Core/SairanStats.h"
+#include "NavigationSystem.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Flow Field Tick"), STAT_Sairan_FlowFieldTick, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("Flow Field Query"), STAT_Sairan_FlowFieldQuery, STATGROUP_SairanAI);
+
+namespace EnemyFlowField
+{
+	// 8 neighbours: orthogonal first (cost 1), then diagonals (cost √2)
+	static const FIntPoint Offsets[8] = {
+		{ 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+		{ 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 },
+	};
+	static const float StepCost[8] = {
+		1.0f, 1.0f, 1.0f, 1.0f,
+		UE_SQRT_2, UE_SQRT_2, UE_SQRT_2, UE_SQRT_2,
+	};
+
+	// Offsets[Opposite[n]] == -Offsets[n]
+	static const int32 Opposite[8] = { 1, 0, 3, 2, 7, 6, 5, 4 };
+
+	struct FOpenEntry
+	{
+		float Cost;
+		int32 Index;
+	};
+
+	struct FOpenEntryPredicate
+	{
+		bool operator()(const FOpenEntry& A, const FOpenEntry& B) const { return A.Cost < B.Cost; }
+	};
+}
+
+void UEnemyFlowFieldManager::Deinitialize()
+{
+	Fields.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UEnemyFlowFieldManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyFlowFieldManager, STATGROUP_Tickables);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// GRID HELPERS
+// ═══════════════════════════════════════════════════════════════════════════
+
+FIntPoint UEnemyFlowFieldManager::WorldToCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+FVector UEnemyFlowFieldManager::CellCenter(const FIntPoint& Cell, float Z) const
+{
+	return FVector((Cell.X + 0.5f) * CellSize, (Cell.Y + 0.5f) * CellSize, Z);
+}
+
+int32 UEnemyFlowFieldManager::WindowIndex(const FFlowField& Field, const FIntPoint& Cell) const
+{
+	const int32 X = Cell.X - Field.Origin.X;
+	const int32 Y = Cell.Y - Field.Origin.Y;
+	if (X < 0 || Y < 0 || X >= Resolution || Y >= Resolution) return INDEX_NONE;
+	return Y * Resolution + X;
+}
+
+UEnemyFlowFieldManager::FFlowField* UEnemyFlowFieldManager::FindField(const AActor* Target)
+{
+	return Fields.FindByPredicate([Target](const FFlowField& Field) { return Field.Target.Get() == Target; });
+}
+
+const UEnemyFlowFieldManager::FFlowField* UEnemyFlowFieldManager::FindField(const AActor* Target) const
+{
+	return Fields.FindByPredicate([Target](const FFlowField& Field) { return Field.Target.Get() == Target; });
+}
+
+UEnemyFlowFieldManager::FFlowField& UEnemyFlowFieldManager::CreateField(AActor* Target)
+{
+	const int32 NumCells = Resolution * Resolution;
+
+	FFlowField& Field = Fields.AddDefaulted_GetRef();
+	Field.Target = Target;
+	Field.State.Init(ECellState::Unknown, NumCells);
+	Field.CellZ.Init(0.0f, NumCells);
+	Field.Cost.Init(TNumericLimits<float>::Max(), NumCells);
+	Field.Direction.Init(NoDirection, NumCells);
+	Field.Links.Init(0, NumCells);
+	Field.LinksChecked.Init(0, NumCells);
+	Field.NumUnknown = NumCells;
+	Field.ReferenceZ = Target->GetActorLocation().Z;
+	Field.Origin = WorldToCell(Target->GetActorLocation()) - FIntPoint(Resolution / 2, Resolution / 2);
+	Field.LastQueryTime = GetWorld()->GetTimeSeconds();
+
+	UE_LOG(LogTemp, Log, TEXT("FlowField: new field for %s (%dx%d, cell %.0f)"),
+		*Target->GetName(), Resolution, Resolution, CellSize);
+	return Field;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// QUERIES
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool UEnemyFlowFieldManager::GetFlowDirection(AActor* Target, const FVector& Location, FVector& OutDirection)
+{
+	SAIRAN_SCOPE(STAT_Sairan_FlowFieldQuery, Movement);
+
+	if (!IsValid(Target)) return false;
+
+	FFlowField* Field = FindField(Target);
+	if (!Field)
+	{
+		Field = &CreateField(Target);
+	}
+	Field->LastQueryTime = GetWorld()->GetTimeSeconds();
+	if (!Field->bReady) return false;
+
+	const FIntPoint Cell = WorldToCell(Location);
+	const int32 Index = WindowIndex(*Field, Cell);
+	if (Index == INDEX_NONE || Field->Cost[Index] == TNumericLimits<float>::Max()) return false;
+
+	// Target cell (or no cheaper neighbour): head straight for the target
+	const uint8 Dir = Field->Direction[Index];
+	const FVector Goal = (Dir == NoDirection)
+		? Target->GetActorLocation()
+		: CellCenter(Cell + EnemyFlowField::Offsets[Dir], Location.Z);
+
+	OutDirection = (Goal - Location).GetSafeNormal2D();
+	return !OutDirection.IsNearlyZero();
+}
+
+float UEnemyFlowFieldManager::GetFlowDistance(const AActor* Target, const FVector& Location) const
+{
+	const FFlowField* Field = FindField(Target);
+	if (!Field || !Field->bReady) return -1.0f;
+
+	const int32 Index = WindowIndex(*Field, WorldToCell(Location));
+	if (Index == INDEX_NONE || Field->Cost[Index] == TNumericLimits<float>::Max()) return -1.0f;
+	return Field->Cost[Index] * CellSize;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FIELD UPDATE
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyFlowFieldManager::RecenterWindow(FFlowField& Field, const FIntPoint& TargetCell, float TargetZ)
+{
+	const FIntPoint NewOrigin = TargetCell - FIntPoint(Resolution / 2, Resolution / 2);
+	const FIntPoint Shift = NewOrigin - Field.Origin;
+	const int32 NumCells = Resolution * Resolution;
+
+	TArray<ECellState> NewState;
+	TArray<float> NewZ;
+	TArray<uint8> NewLinks;
+	TArray<uint8> NewLinksChecked;
+	NewState.Init(ECellState::Unknown, NumCells);
+	NewZ.Init(0.0f, NumCells);
+	NewLinks.Init(0, NumCells);
+	NewLinksChecked.Init(0, NumCells);
+
+	// A big height change (other floor, bridge...) invalidates everything
+	const bool bKeepOverlap = FMath::Abs(TargetZ - Field.ReferenceZ) <= MaxStepHeight;
+
+	int32 NumUnknown = NumCells;
+	if (bKeepOverlap)
+	{
+		for (int32 Y = 0; Y < Resolution; ++Y)
+		{
+			const int32 OldY = Y + Shift.Y;
+			if (OldY < 0 || OldY >= Resolution) continue;
+
+			for (int32 X = 0; X < Resolution; ++X)
+			{
+				const int32 OldX = X + Shift.X;
+				if (OldX < 0 || OldX >= Resolution) continue;
+
+				const int32 OldIndex = OldY * Resolution + OldX;
+				const int32 NewIndex = Y * Resolution + X;
+				NewState[NewIndex] = Field.State[OldIndex];
+				NewZ[NewIndex] = Field.CellZ[OldIndex];
+				NumUnknown -= (NewState[NewIndex] != ECellState::Unknown) ? 1 : 0;
+
+				// Keep edges whose other end was kept too; edges into the new strip are re-checked
+				for (int32 n = 0; n < 8; ++n)
+				{
+					const int32 NX = X + EnemyFlowField::Offsets[n].X;
+					const int32 NY = Y + EnemyFlowField::Offsets[n].Y;
+					const int32 ONX = OldX + EnemyFlowField::Offsets[n].X;
+					const int32 ONY = OldY + EnemyFlowField::Offsets[n].Y;
+					const bool bKept = NX >= 0 && NY >= 0 && NX < Resolution && NY < Resolution &&
+						ONX >= 0 && ONY >= 0 && ONX < Resolution && ONY < Resolution;
+					if (!bKept) continue;
+
+					const uint8 Bit = uint8(1u << n);
+					NewLinks[NewIndex] |= Field.Links[OldIndex] & Bit;
+					NewLinksChecked[NewIndex] |= Field.LinksChecked[OldIndex] & Bit;
+				}
+			}
+		}
+	}
+	else
+	{
+		Field.ReferenceZ = TargetZ;
+	}
+
+	Field.Origin = NewOrigin;
+	Field.State = MoveTemp(NewState);
+	Field.CellZ = MoveTemp(NewZ);
+	Field.Links = MoveTemp(NewLinks);
+	Field.LinksChecked = MoveTemp(NewLinksChecked);
+	Field.NumUnknown = NumUnknown;
+	Field.NextProjectIndex = 0;
+	Field.NextLinkIndex = 0;
+	Field.bLinksPending = true;
+	Field.bNeedsRebuild = true;
+
+	// Stale directions would point at the wrong cells until the next build
+	Field.bReady = false;
+}
+
+int32 UEnemyFlowFieldManager::ClassifyCells(FFlowField& Field, int32 Budget)
+{
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys) return 0;
+
+	const FVector Extent(CellSize * 0.5f, CellSize * 0.5f, ProjectionHalfHeight);
+	const int32 NumCells = Resolution * Resolution;
+	int32 Spent = 0;
+
+	while (Field.NumUnknown > 0 && Spent < Budget && Field.NextProjectIndex < NumCells)
+	{
+		const int32 Index = Field.NextProjectIndex++;
+		if (Field.State[Index] != ECellState::Unknown) continue;
+
+		const FIntPoint Cell = Field.Origin + FIntPoint(Index % Resolution, Index / Resolution);
+		FNavLocation NavLocation;
+		const bool bOnNav = NavSys->ProjectPointToNavigation(CellCenter(Cell, Field.ReferenceZ), NavLocation, Extent);
+
+		Field.State[Index] = bOnNav ? ECellState::Walkable : ECellState::Blocked;
+		Field.CellZ[Index] = bOnNav ? NavLocation.Location.Z : 0.0f;
+		--Field.NumUnknown;
+		++Spent;
+	}
+
+	if (Spent > 0)
+	{
+		Field.bNeedsRebuild = true;
+		Field.NextLinkIndex = 0;
+		Field.bLinksPending = true;
+	}
+	return Spent;
+}
+
+int32 UEnemyFlowFieldManager::ClassifyLinks(FFlowField& Field, int32 Budget)
+{
+	using namespace EnemyFlowField;
+
+	UWorld* World = GetWorld();
+	const int32 NumCells = Resolution * Resolution;
+	int32 Spent = 0;
+
+	while (Field.NextLinkIndex < NumCells && Spent < Budget)
+	{
+		const int32 Index = Field.NextLinkIndex;
+		const int32 X = Index % Resolution;
+		const int32 Y = Index / Resolution;
+
+		// Each edge is owned by one of its cells: check the four "forward" ones (+X, +Y, +X+Y, +X-Y)
+		static const int32 Forward[4] = { 0, 2, 4, 5 };
+		bool bCellDone = true;
+		for (int32 n : Forward)
+		{
+			const uint8 Bit = uint8(1u << n);
+			if (Field.LinksChecked[Index] & Bit) continue;
+
+			const int32 NX = X + Offsets[n].X;
+			const int32 NY = Y + Offsets[n].Y;
+			if (NX < 0 || NY < 0 || NX >= Resolution || NY >= Resolution)
+			{
+				Field.LinksChecked[Index] |= Bit;
+				continue;
+			}
+
+			const int32 NIndex = NY * Resolution + NX;
+			const uint8 OppositeBit = uint8(1u << Opposite[n]);
+			bool bLinked = false;
+
+			if (Field.State[Index] == ECellState::Walkable && Field.State[NIndex] == ECellState::Walkable &&
+				FMath::Abs(Field.CellZ[NIndex] - Field.CellZ[Index]) <= MaxStepHeight)
+			{
+				if (Spent >= Budget)
+				{
+					bCellDone = false;
+					break;
+				}
+
+				// Thin walls and railings leave both cells on the navmesh: the edge itself must be walkable
+				const FVector From = CellCenter(Field.Origin + FIntPoint(X, Y), Field.CellZ[Index]);
+				const FVector To = CellCenter(Field.Origin + FIntPoint(NX, NY), Field.CellZ[NIndex]);
+				FVector HitLocation;
+				bLinked = !UNavigationSystemV1::NavigationRaycast(World, From, To, HitLocation);
+				++Spent;
+			}
+
+			Field.LinksChecked[Index] |= Bit;
+			Field.LinksChecked[NIndex] |= OppositeBit;
+			if (bLinked)
+			{
+				Field.Links[Index] |= Bit;
+				Field.Links[NIndex] |= OppositeBit;
+			}
+			else
+			{
+				Field.Links[Index] &= ~Bit;
+				Field.Links[NIndex] &= ~OppositeBit;
+			}
+		}
+
+		if (!bCellDone) break;
+		++Field.NextLinkIndex;
+	}
+
+	if (Field.NextLinkIndex >= NumCells)
+	{
+		Field.bLinksPending = false;
+	}
+	if (Spent > 0)
+	{
+		Field.bNeedsRebuild = true;
+	}
+	return Spent;
+}
+
+void UEnemyFlowFieldManager::BuildIntegration(FFlowField& Field, const FIntPoint& TargetCell)
+{
+	using namespace EnemyFlowField;
+
+	const int32 NumCells = Resolution * Resolution;
+	const float Unreached = TNumericLimits<float>::Max();
+
+	Field.Cost.Init(Unreached, NumCells);
+	Field.Direction.Init(NoDirection, NumCells);
+	Field.BuiltTargetCell = TargetCell;
+	Field.bNeedsRebuild = false;
+	Field.TimeSinceBuild = 0.0f;
+	Field.bReady = true;
+
+	const int32 Start = WindowIndex(Field, TargetCell);
+	if (Start == INDEX_NONE) return;
+
+	auto IsWalkable = [&Field](int32 X, int32 Y, int32 Res)
+	{
+		return X >= 0 && Y >= 0 && X < Res && Y < Res && Field.State[Y * Res + X] == ECellState::Walkable;
+	};
+
+	// Edge n of Index was raycast walkable; diagonals also need both orthogonal cells open (no corner cutting)
+	auto IsLinked = [&Field, &IsWalkable](int32 Index, int32 X, int32 Y, int32 n, int32 Res)
+	{
+		if (!(Field.Links[Index] & (1u << n))) return false;
+		const int32 NX = X + Offsets[n].X;
+		const int32 NY = Y + Offsets[n].Y;
+		return n < 4 || (IsWalkable(NX, Y, Res) && IsWalkable(X, NY, Res));
+	};
+
+	TArray<FOpenEntry> Open;
+	Open.Reserve(NumCells / 4);
+	Field.Cost[Start] = 0.0f;
+
+	// The target itself may stand on a cell the projection missed (edge, jump) or a
+	// blocked one. Seed its walkable neighbours at a similar height for this build
+	// only: State/Links stay untouched so later builds never route through that cell.
+	TArray<int32, TInlineAllocator<8>> Seeds;
+	if (Field.State[Start] == ECellState::Walkable)
+	{
+		Open.HeapPush(FOpenEntry{ 0.0f, Start }, FOpenEntryPredicate());
+	}
+	else
+	{
+		const int32 SX = Start % Resolution;
+		const int32 SY = Start / Resolution;
+		for (int32 n = 0; n < 8; ++n)
+		{
+			const int32 NX = SX + Offsets[n].X;
+			const int32 NY = SY + Offsets[n].Y;
+			if (!IsWalkable(NX, NY, Resolution)) continue;
+			if (n >= 4 && !(IsWalkable(NX, SY, Resolution) && IsWalkable(SX, NY, Resolution))) continue;
+
+			const int32 NIndex = NY * Resolution + NX;
+			if (FMath::Abs(Field.CellZ[NIndex] - Field.ReferenceZ) > MaxStepHeight) continue;
+
+			Field.Cost[NIndex] = StepCost[n];
+			Open.HeapPush(FOpenEntry{ StepCost[n], NIndex }, FOpenEntryPredicate());
+			Seeds.Add(NIndex);
+		}
+	}
+
+	while (Open.Num() > 0)
+	{
+		FOpenEntry Current;
+		Open.HeapPop(Current, FOpenEntryPredicate(), EAllowShrinking::No);
+		if (Current.Cost > Field.Cost[Current.Index]) continue;
+
+		const int32 X = Current.Index % Resolution;
+		const int32 Y = Current.Index / Resolution;
+
+		for (int32 n = 0; n < 8; ++n)
+		{
+			if (!IsLinked(Current.Index, X, Y, n, Resolution)) continue;
+
+			const int32 NIndex = (Y + Offsets[n].Y) * Resolution + (X + Offsets[n].X);
+			const float NewCost = Current.Cost + StepCost[n];
+			if (NewCost < Field.Cost[NIndex])
+			{
+				Field.Cost[NIndex] = NewCost;
+				Open.HeapPush(FOpenEntry{ NewCost, NIndex }, FOpenEntryPredicate());
+			}
+		}
+	}
+
+	// Direction = cheapest reachable neighbour (same connectivity rules as above)
+	for (int32 Index = 0; Index < NumCells; ++Index)
+	{
+		if (Index == Start || Field.Cost[Index] == Unreached) continue;
+
+		const int32 X = Index % Resolution;
+		const int32 Y = Index / Resolution;
+		float Best = Field.Cost[Index];
+
+		for (int32 n = 0; n < 8; ++n)
+		{
+			if (!IsLinked(Index, X, Y, n, Resolution)) continue;
+
+			const int32 NIndex = (Y + Offsets[n].Y) * Resolution + (X + Offsets[n].X);
+			if (Field.Cost[NIndex] < Best)
+			{
+				Best = Field.Cost[NIndex];
+				Field.Direction[Index] = static_cast<uint8>(n);
+			}
+		}
+	}
+
+	// Seeds border the target cell without a link to it: head straight for the target
+	for (const int32 Seed : Seeds)
+	{
+		Field.Direction[Seed] = NoDirection;
+	}
+}
+
+void UEnemyFlowFieldManager::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_FlowFieldTick, Movement);
+
+	if (Fields.Num() == 0) return;
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	int32 ProjectionBudget = MaxProjectionsPerTick;
+
+	for (int32 i = Fields.Num() - 1; i >= 0; --i)
+	{
+		FFlowField& Field = Fields[i];
+		const AActor* Target = Field.Target.Get();
+		if (!Target || Now - Field.LastQueryTime > FieldTimeout)
+		{
+			Fields.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		Field.TimeSinceBuild += DeltaTime;
+
+		// Keep the target in the central half of the window
+		const FVector TargetLocation = Target->GetActorLocation();
+		const FIntPoint TargetCell = WorldToCell(TargetLocation);
+		const FIntPoint Local = TargetCell - Field.Origin;
+		const int32 Margin = Resolution / 4;
+		if (Local.X < Margin || Local.Y < Margin || Local.X >= Resolution - Margin || Local.Y >= Resolution - Margin)
+		{
+			RecenterWindow(Field, TargetCell, TargetLocation.Z);
+		}
+
+		if (Field.NumUnknown > 0)
+		{
+			ProjectionBudget -= ClassifyCells(Field, ProjectionBudget);
+			if (Field.NumUnknown > 0) continue;
+		}
+
+		if (Field.bLinksPending)
+		{
+			ProjectionBudget -= ClassifyLinks(Field, ProjectionBudget);
+			if (Field.bLinksPending) continue;
+		}
+
+		const bool bTargetMovedCell = TargetCell != Field.BuiltTargetCell;
+		if ((Field.bNeedsRebuild || bTargetMovedCell) && (Field.TimeSinceBuild >= RebuildInterval || !Field.bReady))
+		{
+			BuildIntegration(Field, TargetCell);
+		}
+	}
+}
@@ -0,0 +1,247 @@
+// SairanSkies - Enemy Line-of-Sight Cache
+
+#include "AI/EnemyLineOfSightCache.h"
+#include "Core/SairanStats.h"
+#include "Enemies/EnemyBase.h"
+#include "AI/EnemyAIController.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Line Of Sight Cache Tick"), STAT_Sairan_LOSCacheTick, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("Line Of Sight Cache Query"), STAT_Sairan_LOSCacheQuery, STATGROUP_SairanAI);
+
+void UEnemyLineOfSightCache::Deinitialize()
+{
+	for (const FLineOfSightEntry& Entry : Entries)
+	{
+		if (AEnemyBase* Enemy = Entry.Enemy.Get())
+		{
+			Enemy->LineOfSightSlot = INDEX_NONE;
+		}
+	}
+
+	Entries.Empty();
+	NextIssueIndex = 0;
+	NumPending = 0;
+	Super::Deinitialize();
+}
+
+TStatId UEnemyLineOfSightCache::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyLineOfSightCache, STATGROUP_Tickables);
+}
+
+int32 UEnemyLineOfSightCache::GetSlot(const AEnemyBase* Enemy) const
+{
+	if (!Enemy) return INDEX_NONE;
+	const int32 Slot = Enemy->LineOfSightSlot;
+	return (Entries.IsValidIndex(Slot) && Entries[Slot].Enemy.Get() == Enemy) ? Slot : INDEX_NONE;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REGISTRATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyLineOfSightCache::RegisterEnemy(AEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy) || GetSlot(Enemy) != INDEX_NONE) return;
+
+	FLineOfSightEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Enemy = Enemy;
+	Enemy->LineOfSightSlot = Entries.Num() - 1;
+}
+
+void UEnemyLineOfSightCache::UnregisterEnemy(AEnemyBase* Enemy)
+{
+	const int32 Slot = GetSlot(Enemy);
+	if (Slot == INDEX_NONE) return;
+
+	// An in-flight trace is simply dropped: its data is never queried again
+	NumPending -= Entries[Slot].bPending ? 1 : 0;
+
+	Entries.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	if (Entries.IsValidIndex(Slot))
+	{
+		if (AEnemyBase* Moved = Entries[Slot].Enemy.Get())
+		{
+			Moved->LineOfSightSlot = Slot;
+		}
+	}
+	Enemy->LineOfSightSlot = INDEX_NONE;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// QUERIES
+// ═══════════════════════════════════════════════════════════════════════════
+
+FEnemyLineOfSightResult UEnemyLineOfSightCache::GetLineOfSight(const AEnemyBase* Enemy) const
+{
+	const int32 Slot = GetSlot(Enemy);
+	if (Slot == INDEX_NONE) return FEnemyLineOfSightResult();
+
+	const FLineOfSightEntry& Entry = Entries[Slot];
+	const AActor* Target = Enemy->GetCurrentTarget();
+	if (!Target || Entry.Target.Get() != Target)
+	{
+		// Cached result belongs to a previous target
+		return FEnemyLineOfSightResult();
+	}
+	return Entry.Result;
+}
+
+bool UEnemyLineOfSightCache::CanSeeTarget(const AEnemyBase* Enemy)
+{
+	SAIRAN_SCOPE(STAT_Sairan_LOSCacheQuery, Perception);
+
+	AActor* Target = Enemy ? Enemy->GetCurrentTarget() : nullptr;
+	if (!Target) return false;
+
+	const int32 Slot = GetSlot(Enemy);
+	if (Slot == INDEX_NONE)
+	{
+		return TraceLineOfSight(Enemy, Target);
+	}
+
+	FLineOfSightEntry& Entry = Entries[Slot];
+	if (Entry.Target.Get() == Target && Entry.Result.bValid)
+	{
+		return Entry.Result.bVisible;
+	}
+
+	// First query for this target: trace now and seed the cache
+	Entry.Target = Target;
+	Entry.Result.bValid = true;
+	Entry.Result.bVisible = TraceLineOfSight(Enemy, Target);
+	Entry.Result.Timestamp = GetWorld()->GetTimeSeconds();
+	return Entry.Result.bVisible;
+}
+
+bool UEnemyLineOfSightCache::TraceLineOfSight(const AEnemyBase* Enemy, const AActor* Target) const
+{
+	if (!Enemy || !Target) return false;
+
+	const FVector Start = Enemy->GetActorLocation() + FVector(0, 0, TraceHeightOffset);
+	const FVector End = Target->GetActorLocation() + FVector(0, 0, TraceHeightOffset);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(EnemyLineOfSight), false, Enemy);
+	SAIRAN_COUNT(STAT_Sairan_AITraces, TracesIssued, 1);
+
+	FHitResult HitResult;
+	if (!GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, TraceChannel, Params))
+	{
+		return true;
+	}
+	return HitResult.GetActor() == Target;
+}
+
+bool UEnemyLineOfSightCache::IsVisibleFromHits(const TArray<FHitResult>& Hits, const AActor* Target)
+{
+	for (const FHitResult& Hit : Hits)
+	{
+		if (Hit.bBlockingHit)
+		{
+			return Hit.GetActor() == Target;
+		}
+	}
+	return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FRAME
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyLineOfSightCache::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_LOSCacheTick, Perception);
+
+	if (Entries.Num() == 0) return;
+
+	PollPendingTraces();
+	IssueTraces(GetWorld()->GetTimeSeconds());
+}
+
+void UEnemyLineOfSightCache::PollPendingTraces()
+{
+	if (NumPending == 0) return;
+
+	UWorld* World = GetWorld();
+	for (FLineOfSightEntry& Entry : Entries)
+	{
+		if (!Entry.bPending) continue;
+
+		FTraceDatum Data;
+		if (!World->IsTraceHandleValid(Entry.PendingHandle, false))
+		{
+			// Lost (e.g. the async buffer was flushed): re-issue on the next sweep
+			Entry.bPending = false;
+			--NumPending;
+			continue;
+		}
+		if (!World->QueryTraceData(Entry.PendingHandle, Data))
+		{
+			continue;
+		}
+
+		Entry.bPending = false;
+		--NumPending;
+
+		// Discard if the enemy switched targets while the trace was in flight
+		AEnemyBase* Enemy = Entry.Enemy.Get();
+		AActor* Target = Entry.PendingTarget.Get();
+		if (!Enemy || !Target || Enemy->GetCurrentTarget() != Target) continue;
+
+		// Never overwrite a newer synchronous seed with older data
+		if (Entry.Target.Get() == Target && Entry.Result.bValid && Entry.Result.Timestamp > Entry.PendingTimestamp) continue;
+
+		const bool bWasVisible = Entry.Target.Get() == Target && Entry.Result.bValid && Entry.Result.bVisible;
+
+		Entry.Target = Target;
+		Entry.Result.bValid = true;
+		Entry.Result.bVisible = IsVisibleFromHits(Data.OutHits, Target);
+		Entry.Result.Timestamp = Entry.PendingTimestamp;
+
+		// Blackboard observers only hear about actual visibility flips
+		if (Entry.Result.bVisible != bWasVisible)
+		{
+			Enemy->SyncBlackboard(EEnemyBlackboardSync::CanSeeTarget);
+		}
+	}
+}
+
+void UEnemyLineOfSightCache::IssueTraces(float Now)
+{
+	UWorld* World = GetWorld();
+	const int32 Num = Entries.Num();
+	int32 Issued = 0;
+
+	// Visit each entry at most once per frame, resuming where the last frame stopped
+	for (int32 Visited = 0; Visited < Num && Issued < MaxTracesPerFrame; ++Visited)
+	{
+		if (NextIssueIndex >= Num)
+		{
+			NextIssueIndex = 0;
+		}
+		FLineOfSightEntry& Entry = Entries[NextIssueIndex++];
+
+		if (Entry.bPending) continue;
+
+		const AEnemyBase* Enemy = Entry.Enemy.Get();
+		AActor* Target = Enemy ? Enemy->GetCurrentTarget() : nullptr;
+		if (!Target || Enemy->IsDead()) continue;
+
+		const bool bFresh = Entry.Target.Get() == Target && Entry.Result.bValid &&
+			Now - Entry.Result.Timestamp < UpdateInterval;
+		if (bFresh) continue;
+
+		const FVector Start = Enemy->GetActorLocation() + FVector(0, 0, TraceHeightOffset);
+		const FVector End = Target->GetActorLocation() + FVector(0, 0, TraceHeightOffset);
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(EnemyLineOfSightAsync), false, Enemy);
+
+		SAIRAN_COUNT(STAT_Sairan_AITraces, TracesIssued, 1);
+		Entry.PendingHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, TraceChannel, Params);
+		Entry.PendingTarget = Target;
+		Entry.PendingTimestamp = Now;
+		Entry.bPending = true;
+		++NumPending;
+		++Issued;
+	}
+}
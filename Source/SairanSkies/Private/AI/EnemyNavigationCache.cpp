@@ -0,0 +1,451 @@
+// SairanSkies - Enemy Navigation Cache
+
+#include "AI/EnemyNavigationCache.h"
+#include "Core/SairanStats.h"
+#include "Navigation/PatrolPath.h"
+#include "NavigationSystem.h"
+#include "NavMesh/NavMeshPath.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Navigation Cache Tick"), STAT_Sairan_NavCacheTick, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("Navigation Cache Patrol Leg"), STAT_Sairan_NavCachePatrolLeg, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("Navigation Cache Reachable Point"), STAT_Sairan_NavCacheReachablePoint, STATGROUP_SairanAI);
+
+void UEnemyNavigationCache::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UEnemyNavigationCache::OnNavigationBuildFinished);
+	}
+}
+
+void UEnemyNavigationCache::Deinitialize()
+{
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UEnemyNavigationCache::OnNavigationBuildFinished);
+	}
+
+	PatrolPaths.Empty();
+	SampleCells.Empty();
+	LegQueue.Empty();
+	CellQueue.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UEnemyNavigationCache::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyNavigationCache, STATGROUP_Tickables);
+}
+
+ANavigationData* UEnemyNavigationCache::GetReadyNavData() const
+{
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys || NavSys->IsNavigationBuildInProgress())
+	{
+		return nullptr;
+	}
+	return NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate);
+}
+
+void UEnemyNavigationCache::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_NavCacheTick, Movement);
+
+	if (LegQueue.Num() == 0 && CellQueue.Num() == 0) return;
+
+	// Wait for the navmesh (loading / runtime generation)
+	ANavigationData* NavData = GetReadyNavData();
+	if (!NavData) return;
+
+	int32 Budget = MaxQueriesPerTick;
+
+	while (Budget > 0 && LegQueue.Num() > 0)
+	{
+		SolveLeg(LegQueue.Pop(EAllowShrinking::No), NavData);
+		--Budget;
+	}
+
+	while (Budget > 0 && CellQueue.Num() > 0)
+	{
+		const uint64 CellKey = CellQueue.Last();
+		Budget -= FillCell(CellKey, Budget);
+
+		const FSampleCell* Cell = SampleCells.Find(CellKey);
+		if (!Cell || Cell->bFilled)
+		{
+			CellQueue.Pop(EAllowShrinking::No);
+		}
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PATROL LEGS
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyNavigationCache::RegisterPatrolPath(APatrolPath* Path)
+{
+	if (!IsValid(Path)) return;
+
+	const TObjectKey<APatrolPath> Key(Path);
+	FCachedPatrolPath& Entry = PatrolPaths.FindOrAdd(Key);
+	Entry.Path = Path;
+	Entry.Points.Reset();
+	Entry.Legs.Reset();
+
+	const int32 NumPoints = Path->GetNumPatrolPoints();
+	for (int32 i = 0; i < NumPoints; ++i)
+	{
+		Entry.Points.Add(Path->GetPatrolPoint(i));
+	}
+
+	// Same order BTTask_FindPatrolPoint walks: 0 -> 1 -> 2 -> 0 ...
+	if (NumPoints >= 2)
+	{
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			AddLeg(Entry, Key, i, (i + 1) % NumPoints);
+		}
+	}
+
+	// Investigations happen around the patrolled area: sample it up front
+	for (const FVector& Point : Entry.Points)
+	{
+		QueueCell(GetCellKey(Point), Point.Z);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("NavigationCache: %s registered (%d points, %d legs queued)"),
+		*Path->GetName(), NumPoints, Entry.Legs.Num());
+}
+
+void UEnemyNavigationCache::UnregisterPatrolPath(APatrolPath* Path)
+{
+	// Queued refs to it are skipped when they come up
+	PatrolPaths.Remove(TObjectKey<APatrolPath>(Path));
+}
+
+int32 UEnemyNavigationCache::AddLeg(FCachedPatrolPath& Entry, TObjectKey<APatrolPath> Key, int32 FromIndex, int32 ToIndex)
+{
+	FPatrolLeg& Leg = Entry.Legs.AddDefaulted_GetRef();
+	Leg.FromIndex = FromIndex;
+	Leg.ToIndex = ToIndex;
+
+	const int32 LegIndex = Entry.Legs.Num() - 1;
+	QueueLeg(Key, LegIndex);
+	return LegIndex;
+}
+
+void UEnemyNavigationCache::QueueLeg(TObjectKey<APatrolPath> Key, int32 Leg)
+{
+	FCachedPatrolPath* Entry = PatrolPaths.Find(Key);
+	if (!Entry || !Entry->Legs.IsValidIndex(Leg) || Entry->Legs[Leg].bQueued) return;
+
+	Entry->Legs[Leg].bQueued = true;
+	LegQueue.Add({ Key, Leg });
+}
+
+void UEnemyNavigationCache::SolveLeg(const FLegRef& Ref, ANavigationData* NavData)
+{
+	FCachedPatrolPath* Entry = PatrolPaths.Find(Ref.Path);
+	if (!Entry || !Entry->Legs.IsValidIndex(Ref.Leg)) return;
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	FPatrolLeg& Leg = Entry->Legs[Ref.Leg];
+	Leg.bQueued = false;
+	Leg.Path.Reset();
+	if (!NavSys) return;
+
+	FPathFindingQuery Query(this, *NavData, Entry->Points[Leg.FromIndex], Entry->Points[Leg.ToIndex],
+		NavData->GetDefaultQueryFilter());
+	Query.SetAllowPartialPaths(true);
+
+	const FPathFindingResult Result = NavSys->FindPathSync(Query);
+	if (!Result.IsSuccessful() || !Result.Path.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("NavigationCache: no path for leg %d -> %d"), Leg.FromIndex, Leg.ToIndex);
+		return;
+	}
+
+	// Tile rebuilds crossing the path invalidate it; we re-solve it ourselves
+	Leg.Path = Result.Path;
+	Leg.Path->EnableRecalculationOnInvalidation(false);
+	Leg.Path->AddObserver(FNavigationPath::FPathObserverDelegate::FDelegate::CreateUObject(
+		this, &UEnemyNavigationCache::OnLegPathEvent, Ref.Path, Ref.Leg));
+	NavData->RegisterActivePath(Leg.Path);
+}
+
+void UEnemyNavigationCache::OnLegPathEvent(FNavigationPath* InvalidatedPath, ENavPathEvent::Type Event, TObjectKey<APatrolPath> Key, int32 Leg)
+{
+	// Don't drop the path here: we're inside its own broadcast
+	if (Event == ENavPathEvent::Invalidated)
+	{
+		QueueLeg(Key, Leg);
+	}
+}
+
+FNavPathSharedPtr UEnemyNavigationCache::FindPatrolLeg(const APatrolPath* Path, const FVector& From, const FVector& To)
+{
+	SAIRAN_SCOPE(STAT_Sairan_NavCachePatrolLeg, Movement);
+
+	FCachedPatrolPath* Entry = PatrolPaths.Find(TObjectKey<APatrolPath>(Path));
+	if (!Entry) return nullptr;
+
+	const int32 ToIndex = FindNearestPoint(*Entry, To, 1.0f);
+	const int32 FromIndex = FindNearestPoint(*Entry, From, LegStartTolerance);
+	if (ToIndex == INDEX_NONE || FromIndex == INDEX_NONE || FromIndex == ToIndex) return nullptr;
+
+	for (const FPatrolLeg& Leg : Entry->Legs)
+	{
+		if (Leg.FromIndex != FromIndex || Leg.ToIndex != ToIndex) continue;
+
+		if (Leg.bQueued || !Leg.Path.IsValid() || !Leg.Path->IsValid() || !Leg.Path->IsUpToDate())
+		{
+			return nullptr;
+		}
+		return CopyPath(Leg.Path);
+	}
+
+	// Random patrol: first time this pair is walked, cache it for the next ones
+	AddLeg(*Entry, TObjectKey<APatrolPath>(Path), FromIndex, ToIndex);
+	return nullptr;
+}
+
+int32 UEnemyNavigationCache::FindNearestPoint(const FCachedPatrolPath& Entry, const FVector& Location, float Tolerance) const
+{
+	int32 Best = INDEX_NONE;
+	float BestDistSq = FMath::Square(Tolerance);
+	for (int32 i = 0; i < Entry.Points.Num(); ++i)
+	{
+		// 2D: the enemy is at capsule height, patrol points usually on the ground
+		const float DistSq = FVector::DistSquared2D(Entry.Points[i], Location);
+		if (DistSq <= BestDistSq)
+		{
+			BestDistSq = DistSq;
+			Best = i;
+		}
+	}
+	return Best;
+}
+
+FNavPathSharedPtr UEnemyNavigationCache::CopyPath(const FNavPathSharedPtr& Source)
+{
+	TSharedRef<FNavMeshPath, ESPMode::ThreadSafe> Copy = MakeShared<FNavMeshPath, ESPMode::ThreadSafe>();
+	Copy->GetPathPoints() = Source->GetPathPoints();
+	if (const FNavMeshPath* MeshPath = Source->CastPath<FNavMeshPath>())
+	{
+		Copy->PathCorridor = MeshPath->PathCorridor;
+		Copy->PathCorridorCost = MeshPath->PathCorridorCost;
+	}
+	Copy->SetNavigationDataUsed(Source->GetNavigationDataUsed());
+	Copy->SetIsPartial(Source->IsPartial());
+	Copy->MarkReady();
+	return Copy;
+}
+
+int32 UEnemyNavigationCache::GetNumCachedLegs() const
+{
+	int32 Num = 0;
+	for (const TPair<TObjectKey<APatrolPath>, FCachedPatrolPath>& Pair : PatrolPaths)
+	{
+		for (const FPatrolLeg& Leg : Pair.Value.Legs)
+		{
+			Num += Leg.Path.IsValid() ? 1 : 0;
+		}
+	}
+	return Num;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REACHABLE POINTS
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool UEnemyNavigationCache::GetReachablePointInRadius(const FVector& Origin, float Radius, FVector& OutPoint)
+{
+	SAIRAN_SCOPE(STAT_Sairan_NavCacheReachablePoint, Movement);
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	ANavigationData* NavData = GetReadyNavData();
+
+	// Samples are only comparable with a point on the navmesh (Origin is often at capsule height)
+	FNavLocation OriginNav;
+	if (NavData && NavSys->ProjectPointToNavigation(Origin, OriginNav, FVector(50.0f, 50.0f, SampleLayerHeight * 0.5f), NavData))
+	{
+		const float RadiusSq = FMath::Square(Radius);
+		const int32 MinX = FMath::FloorToInt32((OriginNav.Location.X - Radius) / SampleCellSize);
+		const int32 MaxX = FMath::FloorToInt32((OriginNav.Location.X + Radius) / SampleCellSize);
+		const int32 MinY = FMath::FloorToInt32((OriginNav.Location.Y - Radius) / SampleCellSize);
+		const int32 MaxY = FMath::FloorToInt32((OriginNav.Location.Y + Radius) / SampleCellSize);
+		const int32 Layer = FMath::FloorToInt32(OriginNav.Location.Z / SampleLayerHeight);
+
+		// Reservoir pick among the samples inside the radius, on the origin's floor
+		int32 NumCandidates = 0;
+		FVector Candidate = FVector::ZeroVector;
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			for (int32 Y = MinY; Y <= MaxY; ++Y)
+			{
+				for (int32 L = Layer - 1; L <= Layer + 1; ++L)
+				{
+					const FSampleCell* Cell = SampleCells.Find(MakeCellKey(X, Y, L));
+					if (!Cell) continue;
+
+					for (const FVector& Point : Cell->Points)
+					{
+						if (FVector::DistSquared2D(Point, OriginNav.Location) > RadiusSq) continue;
+						if (FMath::Abs(Point.Z - OriginNav.Location.Z) > SampleLayerHeight) continue;
+
+						if (FMath::RandRange(0, NumCandidates) == 0)
+						{
+							Candidate = Point;
+						}
+						++NumCandidates;
+					}
+				}
+			}
+		}
+
+		// Cover this spot next time
+		const uint64 OriginKey = GetCellKey(OriginNav.Location);
+		const FSampleCell* OriginCell = SampleCells.Find(OriginKey);
+		if (!OriginCell || (!OriginCell->bFilled && !OriginCell->bQueued))
+		{
+			QueueCell(OriginKey, OriginNav.Location.Z);
+		}
+
+		// Samples are reachable from their cell anchor, not necessarily from Origin:
+		// straight line first, a path test only when something is in between
+		if (NumCandidates > 0)
+		{
+			FVector HitLocation;
+			bool bReachable = !NavData->Raycast(OriginNav.Location, Candidate, HitLocation, nullptr, this);
+			if (!bReachable)
+			{
+				FPathFindingQuery Query(this, *NavData, OriginNav.Location, Candidate);
+				bReachable = NavSys->TestPathSync(Query, EPathFindingMode::Hierarchical);
+			}
+			if (bReachable)
+			{
+				OutPoint = Candidate;
+				return true;
+			}
+		}
+	}
+
+	// Miss: one direct query, as before
+	FNavLocation NavLocation;
+	if (NavSys && NavSys->GetRandomReachablePointInRadius(Origin, Radius, NavLocation))
+	{
+		OutPoint = NavLocation.Location;
+		return true;
+	}
+	return false;
+}
+
+void UEnemyNavigationCache::QueueCell(uint64 CellKey, float AnchorZ)
+{
+	FSampleCell& Cell = SampleCells.FindOrAdd(CellKey);
+	if (Cell.bQueued) return;
+
+	if (!Cell.bFilled)
+	{
+		Cell.AnchorZ = AnchorZ;
+	}
+	Cell.Points.Reset();
+	Cell.bHasAnchor = false;
+	Cell.Attempts = 0;
+	Cell.bFilled = false;
+	Cell.bQueued = true;
+	CellQueue.Add(CellKey);
+}
+
+int32 UEnemyNavigationCache::FillCell(uint64 CellKey, int32 Budget)
+{
+	FSampleCell* Cell = SampleCells.Find(CellKey);
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!Cell || !NavSys) return 1;
+
+	int32 Used = 0;
+	const float HalfCell = SampleCellSize * 0.5f;
+
+	if (!Cell->bHasAnchor)
+	{
+		++Used;
+		FNavLocation AnchorLocation;
+		if (!NavSys->ProjectPointToNavigation(GetCellCenter(CellKey, Cell->AnchorZ), AnchorLocation,
+			FVector(HalfCell, HalfCell, SampleLayerHeight * 0.5f)))
+		{
+			// No navmesh here: stays empty, queries fall back to direct ones
+			Cell->bFilled = true;
+			Cell->bQueued = false;
+			return Used;
+		}
+		Cell->Anchor = AnchorLocation.Location;
+		Cell->bHasAnchor = true;
+	}
+
+	// Radius reaching the cell corners; a few attempts may fail near edges
+	const float SampleRadius = HalfCell * UE_SQRT_2;
+	const int32 MaxAttempts = SamplesPerCell * 2;
+	while (Used < Budget && Cell->Points.Num() < SamplesPerCell && Cell->Attempts < MaxAttempts)
+	{
+		++Used;
+		++Cell->Attempts;
+
+		FNavLocation Sample;
+		if (NavSys->GetRandomReachablePointInRadius(Cell->Anchor, SampleRadius, Sample))
+		{
+			Cell->Points.Add(Sample.Location);
+		}
+	}
+
+	if (Cell->Points.Num() >= SamplesPerCell || Cell->Attempts >= MaxAttempts)
+	{
+		Cell->bFilled = true;
+		Cell->bQueued = false;
+	}
+	return FMath::Max(1, Used);
+}
+
+void UEnemyNavigationCache::OnNavigationBuildFinished(ANavigationData* NavData)
+{
+	// The navmesh changed under us: re-solve every leg, re-sample every cell
+	for (TPair<TObjectKey<APatrolPath>, FCachedPatrolPath>& Pair : PatrolPaths)
+	{
+		for (int32 Leg = 0; Leg < Pair.Value.Legs.Num(); ++Leg)
+		{
+			QueueLeg(Pair.Key, Leg);
+		}
+	}
+
+	for (TPair<uint64, FSampleCell>& Pair : SampleCells)
+	{
+		QueueCell(Pair.Key, Pair.Value.AnchorZ);
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CELLS
+// ═══════════════════════════════════════════════════════════════════════════
+
+uint64 UEnemyNavigationCache::MakeCellKey(int32 CellX, int32 CellY, int32 Layer) const
+{
+	return (static_cast<uint64>(static_cast<uint32>(CellX) & 0xFFFFFF) << 40)
+		| (static_cast<uint64>(static_cast<uint32>(CellY) & 0xFFFFFF) << 16)
+		| (static_cast<uint32>(Layer) & 0xFFFF);
+}
+
+uint64 UEnemyNavigationCache::GetCellKey(const FVector& Location) const
+{
+	return MakeCellKey(FMath::FloorToInt32(Location.X / SampleCellSize), FMath::FloorToInt32(Location.Y / SampleCellSize),
+		FMath::FloorToInt32(Location.Z / SampleLayerHeight));
+}
+
+FVector UEnemyNavigationCache::GetCellCenter(uint64 CellKey, float Z) const
+{
+	// Sign-extend the packed fields back
+	const int32 CellX = static_cast<int32>(static_cast<uint32>(CellKey >> 40) << 8) >> 8;
+	const int32 CellY = static_cast<int32>(static_cast<uint32>((CellKey >> 16) & 0xFFFFFF) << 8) >> 8;
+	return FVector((CellX + 0.5f) * SampleCellSize, (CellY + 0.5f) * SampleCellSize, Z);
+}
@@ -0,0 +1,181 @@
+// SairanSkies - Enemy Path Request Queue
+
+#include "AI/EnemyPathRequestQueue.h"
+#include "Core/SairanStats.h"
+#include "AI/EnemyAIController.h"
+#include "NavigationSystem.h"
+#include "NavFilters/NavigationQueryFilter.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Path Request Queue Tick"), STAT_Sairan_PathQueueTick, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("Path Request"), STAT_Sairan_PathQueueRequest, STATGROUP_SairanAI);
+
+void UEnemyPathRequestQueue::Deinitialize()
+{
+	// Results still in flight are dropped: the delegate is bound weakly to us
+	Requests.Empty();
+	Batches.Empty();
+	BatchByCells.Empty();
+	PendingBatches.Empty();
+	NumInFlight = 0;
+	Super::Deinitialize();
+}
+
+TStatId UEnemyPathRequestQueue::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyPathRequestQueue, STATGROUP_Tickables);
+}
+
+uint64 UEnemyPathRequestQueue::MakeCellKey(int32 CellX, int32 CellY) const
+{
+	return (static_cast<uint64>(static_cast<uint32>(CellX)) << 32) | static_cast<uint32>(CellY);
+}
+
+uint64 UEnemyPathRequestQueue::GetCellKey(const FVector& Location) const
+{
+	return MakeCellKey(FMath::FloorToInt32(Location.X / PathCellSize), FMath::FloorToInt32(Location.Y / PathCellSize));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REQUESTS
+// ═══════════════════════════════════════════════════════════════════════════
+
+uint32 UEnemyPathRequestQueue::RequestPath(AEnemyAIController* Controller, const FVector& Goal)
+{
+	SAIRAN_SCOPE(STAT_Sairan_PathQueueRequest, Movement);
+
+	const APawn* Pawn = Controller ? Controller->GetPawn() : nullptr;
+	if (!Pawn) return 0;
+
+	const FVector Start = Pawn->GetNavAgentLocation();
+	const FCellPair Cells(GetCellKey(Start), GetCellKey(Goal));
+
+	uint32 BatchId = 0;
+	if (const uint32* Existing = BatchByCells.Find(Cells))
+	{
+		// Same corridor already asked for (pending or in flight): share its result
+		BatchId = *Existing;
+		++NumMerged;
+	}
+	else
+	{
+		BatchId = ++NextBatchId;
+		if (BatchId == 0) BatchId = ++NextBatchId;
+
+		FPathBatch& Batch = Batches.Add(BatchId);
+		Batch.Cells = Cells;
+		Batch.Start = Start;
+		Batch.Goal = Goal;
+		BatchByCells.Add(Cells, BatchId);
+		PendingBatches.Add(BatchId);
+	}
+
+	uint32 RequestId = ++NextRequestId;
+	if (RequestId == 0) RequestId = ++NextRequestId;
+
+	FPathRequest& Request = Requests.Add(RequestId);
+	Request.Controller = Controller;
+	Request.Batch = BatchId;
+	Batches[BatchId].Requests.Add(RequestId);
+	return RequestId;
+}
+
+void UEnemyPathRequestQueue::CancelRequest(uint32 RequestId)
+{
+	// The batch keeps the id; DispatchBatch / DeliverBatch skip missing requests
+	Requests.Remove(RequestId);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DISPATCH
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyPathRequestQueue::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_PathQueueTick, Movement);
+
+	if (PendingBatches.Num() == 0) return;
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys) return;
+
+	int32 Budget = MaxQueriesPerTick;
+	int32 Consumed = 0;
+	while (Consumed < PendingBatches.Num() && Budget > 0 && NumInFlight < MaxQueriesInFlight)
+	{
+		if (DispatchBatch(PendingBatches[Consumed++], NavSys))
+		{
+			--Budget;
+		}
+	}
+	PendingBatches.RemoveAt(0, Consumed, EAllowShrinking::No);
+}
+
+bool UEnemyPathRequestQueue::DispatchBatch(uint32 BatchId, UNavigationSystemV1* NavSys)
+{
+	FPathBatch* Batch = Batches.Find(BatchId);
+	if (!Batch) return false;
+
+	AEnemyAIController* Querier = nullptr;
+	for (const uint32 RequestId : Batch->Requests)
+	{
+		const FPathRequest* Request = Requests.Find(RequestId);
+		Querier = Request ? Request->Controller.Get() : nullptr;
+		if (Querier && Querier->GetPawn()) break;
+		Querier = nullptr;
+	}
+
+	// Everyone cancelled before we got here
+	if (!Querier)
+	{
+		BatchByCells.Remove(Batch->Cells);
+		Batches.Remove(BatchId);
+		return false;
+	}
+
+	const FNavAgentProperties& AgentProps = Querier->GetNavAgentPropertiesRef();
+	const ANavigationData* NavData = NavSys->GetNavDataForProps(AgentProps, Batch->Start);
+	if (!NavData)
+	{
+		DeliverBatch(BatchId, nullptr);
+		return true;
+	}
+
+	FPathFindingQuery Query(Querier, *NavData, Batch->Start, Batch->Goal,
+		UNavigationQueryFilter::GetQueryFilter(*NavData, Querier, Querier->GetDefaultNavigationFilterClass()));
+	Query.SetAllowPartialPaths(true);
+
+	Batch->bInFlight = true;
+	++NumInFlight;
+	NavSys->FindPathAsync(AgentProps, Query,
+		FNavPathQueryDelegate::CreateUObject(this, &UEnemyPathRequestQueue::OnPathFound, BatchId),
+		EPathFindingMode::Regular);
+	return true;
+}
+
+void UEnemyPathRequestQueue::OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path, uint32 BatchId)
+{
+	NumInFlight = FMath::Max(0, NumInFlight - 1);
+	DeliverBatch(BatchId, Result == ENavigationQueryResult::Success ? Path : nullptr);
+}
+
+void UEnemyPathRequestQueue::DeliverBatch(uint32 BatchId, FNavPathSharedPtr Path)
+{
+	// Take the batch out first: starting a move may queue a new request
+	FPathBatch Batch;
+	if (!Batches.RemoveAndCopyValue(BatchId, Batch)) return;
+	BatchByCells.Remove(Batch.Cells);
+
+	for (const uint32 RequestId : Batch.Requests)
+	{
+		FPathRequest Request;
+		if (!Requests.RemoveAndCopyValue(RequestId, Request)) continue;
+
+		AEnemyAIController* Controller = Request.Controller.Get();
+		if (Controller && Controller->QueuedPathRequest == RequestId)
+		{
+			Controller->OnQueuedPathReady(Path);
+		}
+	}
+}
@@ -0,0 +1,363 @@
+// SairanSkies - Enemy Perception Service
+
+#include "AI/EnemyPerceptionService.h"
+#include "Core/SairanStats.h"
+#include "Enemies/EnemyBase.h"
+#include "Perception/AIPerceptionTypes.h"
+#include "Perception/AISense_Sight.h"
+#include "Perception/AISense_Hearing.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Perception Service Tick"), STAT_Sairan_PerceptionTick, STATGROUP_SairanAI);
+
+// Active[] values: 0 = skipped, 1 = hearing only, 2 = sight + hearing
+static constexpr float PerceptionActive_Hearing = 1.0f;
+static constexpr float PerceptionActive_All = 2.0f;
+
+void UEnemyPerceptionService::Deinitialize()
+{
+	Enemies.Empty();
+	SlotByEnemy.Empty();
+	SetPaddedNum(0);
+	SightEnabled.Empty();
+	PrevSensed.Empty();
+	SightGraceLeft.Empty();
+	Candidates.Empty();
+	PendingNoises.Empty();
+	PendingStimuli.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UEnemyPerceptionService::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyPerceptionService, STATGROUP_Tickables);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REGISTRATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyPerceptionService::SetPaddedNum(int32 Num)
+{
+	const int32 Padded = Align(Num, 4);
+	for (TArray<float>* Channel : { &PosX, &PosY, &PosZ, &FwdX, &FwdY, &FwdZ,
+		&SightRadiusSq, &CosHalfAngle, &HearingRadiusSq, &ProximityRadiusSq,
+		&LoseSightRadiusSq, &LoseSightTime, &SightTestRadiusSq, &Active })
+	{
+		Channel->SetNumZeroed(Padded, EAllowShrinking::No);
+	}
+}
+
+void UEnemyPerceptionService::WriteConfig(int32 Slot, const AEnemyBase* Enemy)
+{
+	const FEnemyPerceptionConfig& Config = Enemy->PerceptionConfig;
+	SightRadiusSq[Slot] = FMath::Square(Config.SightRadius);
+	// PeripheralVisionAngle is the half-angle, as in UAISenseConfig_Sight
+	CosHalfAngle[Slot] = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(Config.PeripheralVisionAngle, 0.0f, 180.0f)));
+	HearingRadiusSq[Slot] = FMath::Square(Config.HearingRadius);
+	ProximityRadiusSq[Slot] = FMath::Square(Config.ProximityRadius);
+	LoseSightRadiusSq[Slot] = FMath::Square(Config.SightRadius + LoseSightRadiusOffset);
+	LoseSightTime[Slot] = Config.LoseSightTime;
+}
+
+void UEnemyPerceptionService::RegisterEnemy(AEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy)) return;
+
+	if (const int32* Existing = SlotByEnemy.Find(Enemy))
+	{
+		WriteConfig(*Existing, Enemy);
+		return;
+	}
+
+	const int32 Slot = Enemies.Add(Enemy);
+	SlotByEnemy.Add(Enemy, Slot);
+	SightEnabled.Add(true);
+	PrevSensed.Add(Sensed_None);
+	SightGraceLeft.Add(0.0f);
+	SetPaddedNum(Enemies.Num());
+	WriteConfig(Slot, Enemy);
+}
+
+void UEnemyPerceptionService::UnregisterEnemy(AEnemyBase* Enemy)
+{
+	int32 Slot = INDEX_NONE;
+	if (!SlotByEnemy.RemoveAndCopyValue(Enemy, Slot)) return;
+
+	const int32 LastSlot = Enemies.Num() - 1;
+	if (Slot != LastSlot)
+	{
+		Enemies[Slot] = Enemies[LastSlot];
+		SightEnabled[Slot] = SightEnabled[LastSlot];
+		PrevSensed[Slot] = PrevSensed[LastSlot];
+		SightGraceLeft[Slot] = SightGraceLeft[LastSlot];
+		SightRadiusSq[Slot] = SightRadiusSq[LastSlot];
+		CosHalfAngle[Slot] = CosHalfAngle[LastSlot];
+		HearingRadiusSq[Slot] = HearingRadiusSq[LastSlot];
+		ProximityRadiusSq[Slot] = ProximityRadiusSq[LastSlot];
+		LoseSightRadiusSq[Slot] = LoseSightRadiusSq[LastSlot];
+		LoseSightTime[Slot] = LoseSightTime[LastSlot];
+		SlotByEnemy.Add(Enemies[Slot], Slot);
+	}
+
+	Enemies.Pop(EAllowShrinking::No);
+	SightEnabled.Pop(EAllowShrinking::No);
+	PrevSensed.Pop(EAllowShrinking::No);
+	SightGraceLeft.Pop(EAllowShrinking::No);
+	SetPaddedNum(Enemies.Num());
+}
+
+void UEnemyPerceptionService::SetSightEnabled(AEnemyBase* Enemy, bool bEnabled)
+{
+	if (const int32* Slot = SlotByEnemy.Find(Enemy))
+	{
+		SightEnabled[*Slot] = bEnabled;
+	}
+}
+
+void UEnemyPerceptionService::ReportNoise(const FVector& Location, float MaxRange)
+{
+	PendingNoises.Add({ Location, FMath::Max(0.0f, MaxRange) });
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FRAME
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyPerceptionService::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_PerceptionTick, Perception);
+
+	TimeUntilUpdate -= DeltaTime;
+	TimeSinceUpdate += DeltaTime;
+	if (TimeUntilUpdate > 0.0f || Enemies.Num() == 0) return;
+	TimeUntilUpdate = UpdateInterval;
+
+	const float Elapsed = TimeSinceUpdate;
+	TimeSinceUpdate = 0.0f;
+
+	APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	if (Player)
+	{
+		RunUpdate(Player, Elapsed);
+	}
+	PendingNoises.Reset();
+}
+
+void UEnemyPerceptionService::PackEnemies(const APawn* Player)
+{
+	const int32 Num = Enemies.Num();
+	for (int32 Slot = 0; Slot < Num; ++Slot)
+	{
+		const AEnemyBase* Enemy = Enemies[Slot].Get();
+
+		// Enemies already fighting the player track it through the line-of-sight cache
+		const bool bEligible = Enemy && !Enemy->IsDead() &&
+			!(Enemy->GetCurrentTarget() == Player && Enemy->IsInCombat());
+		if (!bEligible)
+		{
+			Active[Slot] = 0.0f;
+			continue;
+		}
+
+		const FVector Location = Enemy->GetActorLocation();
+		const FVector Forward = Enemy->GetActorForwardVector();
+		PosX[Slot] = Location.X;
+		PosY[Slot] = Location.Y;
+		PosZ[Slot] = Location.Z;
+		FwdX[Slot] = Forward.X;
+		FwdY[Slot] = Forward.Y;
+		FwdZ[Slot] = Forward.Z;
+		SightTestRadiusSq[Slot] = (PrevSensed[Slot] & Sensed_Sight) ? LoseSightRadiusSq[Slot] : SightRadiusSq[Slot];
+		Active[Slot] = SightEnabled[Slot] ? PerceptionActive_All : PerceptionActive_Hearing;
+	}
+
+	// Padding lanes never pass
+	for (int32 Slot = Num; Slot < Active.Num(); ++Slot)
+	{
+		Active[Slot] = 0.0f;
+	}
+}
+
+void UEnemyPerceptionService::RunBatchedTests(const FVector& PlayerLocation)
+{
+	const int32 Num = Enemies.Num();
+	const int32 Padded = Active.Num();
+	Candidates.SetNumUninitialized(Padded, EAllowShrinking::No);
+
+	const VectorRegister4Float PlayerX = VectorSetFloat1(static_cast<float>(PlayerLocation.X));
+	const VectorRegister4Float PlayerY = VectorSetFloat1(static_cast<float>(PlayerLocation.Y));
+	const VectorRegister4Float PlayerZ = VectorSetFloat1(static_cast<float>(PlayerLocation.Z));
+	const VectorRegister4Float HearingOnly = VectorSetFloat1(0.5f * (PerceptionActive_Hearing + PerceptionActive_All));
+	const VectorRegister4Float Zero = VectorZeroFloat();
+
+	for (int32 i = 0; i < Padded; i += 4)
+	{
+		const VectorRegister4Float X = VectorLoad(&PosX[i]);
+		const VectorRegister4Float Y = VectorLoad(&PosY[i]);
+		const VectorRegister4Float Z = VectorLoad(&PosZ[i]);
+		const VectorRegister4Float State = VectorLoad(&Active[i]);
+
+		// ── Sight cone + proximity against the player ──
+		const VectorRegister4Float DX = VectorSubtract(PlayerX, X);
+		const VectorRegister4Float DY = VectorSubtract(PlayerY, Y);
+		const VectorRegister4Float DZ = VectorSubtract(PlayerZ, Z);
+		const VectorRegister4Float DistSq = VectorMultiplyAdd(DX, DX, VectorMultiplyAdd(DY, DY, VectorMultiply(DZ, DZ)));
+		const VectorRegister4Float Dot = VectorMultiplyAdd(VectorLoad(&FwdX[i]), DX,
+			VectorMultiplyAdd(VectorLoad(&FwdY[i]), DY, VectorMultiply(VectorLoad(&FwdZ[i]), DZ)));
+
+		// dot(fwd, d) >= cos(half) * |d|  — valid for any half-angle, no normalisation
+		const VectorRegister4Float InCone = VectorBitwiseAnd(
+			VectorCompareLE(DistSq, VectorLoad(&SightTestRadiusSq[i])),
+			VectorCompareGE(Dot, VectorMultiply(VectorLoad(&CosHalfAngle[i]), VectorSqrt(DistSq))));
+		const VectorRegister4Float InProximity = VectorCompareLE(DistSq, VectorLoad(&ProximityRadiusSq[i]));
+		const VectorRegister4Float SightMask = VectorBitwiseAnd(VectorBitwiseOr(InCone, InProximity), VectorCompareGT(State, HearingOnly));
+		const uint32 SightBits = static_cast<uint32>(VectorMaskBits(SightMask));
+
+		// ── Hearing: any noise reported since the last update ──
+		uint32 HearingBits = 0;
+		if (PendingNoises.Num() > 0)
+		{
+			const VectorRegister4Float HearingSq = VectorLoad(&HearingRadiusSq[i]);
+			VectorRegister4Float Heard = VectorZeroFloat();
+			for (const FNoiseEvent& Noise : PendingNoises)
+			{
+				const VectorRegister4Float NX = VectorSubtract(VectorSetFloat1(static_cast<float>(Noise.Location.X)), X);
+				const VectorRegister4Float NY = VectorSubtract(VectorSetFloat1(static_cast<float>(Noise.Location.Y)), Y);
+				const VectorRegister4Float NZ = VectorSubtract(VectorSetFloat1(static_cast<float>(Noise.Location.Z)), Z);
+				const VectorRegister4Float NoiseDistSq = VectorMultiplyAdd(NX, NX, VectorMultiplyAdd(NY, NY, VectorMultiply(NZ, NZ)));
+				const VectorRegister4Float Limit = Noise.MaxRange > 0.0f
+					? VectorMin(HearingSq, VectorSetFloat1(FMath::Square(Noise.MaxRange)))
+					: HearingSq;
+				Heard = VectorBitwiseOr(Heard, VectorCompareLE(NoiseDistSq, Limit));
+			}
+			HearingBits = static_cast<uint32>(VectorMaskBits(VectorBitwiseAnd(Heard, VectorCompareGT(State, Zero))));
+		}
+
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			Candidates[i + Lane] =
+				(((SightBits >> Lane) & 1u) ? Sensed_Sight : Sensed_None) |
+				(((HearingBits >> Lane) & 1u) ? Sensed_Hearing : Sensed_None);
+		}
+	}
+
+	// Padding lanes are masked by Active, but keep the scratch tidy
+	for (int32 Slot = Num; Slot < Padded; ++Slot)
+	{
+		Candidates[Slot] = Sensed_None;
+	}
+}
+
+bool UEnemyPerceptionService::TraceOcclusion(const AEnemyBase* Enemy, const APawn* Player) const
+{
+	const FVector Start = Enemy->GetActorLocation() + FVector(0, 0, TraceHeightOffset);
+	const FVector End = Player->GetActorLocation() + FVector(0, 0, TraceHeightOffset);
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(EnemyPerceptionSight), false, Enemy);
+	SAIRAN_COUNT(STAT_Sairan_AITraces, TracesIssued, 1);
+
+	FHitResult HitResult;
+	if (!GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, Params))
+	{
+		return true;
+	}
+	return HitResult.GetActor() == Player;
+}
+
+void UEnemyPerceptionService::RunUpdate(APawn* Player, float Elapsed)
+{
+	const int32 Num = Enemies.Num();
+	const FVector PlayerLocation = Player->GetActorLocation();
+
+	PackEnemies(Player);
+	RunBatchedTests(PlayerLocation);
+
+	// ── Occlusion only for candidates, round-robin under the trace budget ──
+	PendingStimuli.Reset();
+	int32 TracesLeft = MaxTracesPerUpdate;
+	int32 LastTraced = INDEX_NONE;
+
+	for (int32 Offset = 0; Offset < Num; ++Offset)
+	{
+		const int32 Slot = (NextTraceSlot + Offset) % Num;
+		AEnemyBase* Enemy = Enemies[Slot].Get();
+		if (!Enemy || Active[Slot] == 0.0f)
+		{
+			PrevSensed[Slot] = Sensed_None;
+			SightGraceLeft[Slot] = 0.0f;
+			continue;
+		}
+
+		const uint8 Candidate = Candidates[Slot];
+		bool bSeen = false;
+		if (Candidate & Sensed_Sight)
+		{
+			if (TracesLeft > 0)
+			{
+				--TracesLeft;
+				LastTraced = Slot;
+				bSeen = TraceOcclusion(Enemy, Player);
+			}
+			else
+			{
+				// Out of budget: keep last result until its turn comes
+				bSeen = (PrevSensed[Slot] & Sensed_Sight) != 0;
+			}
+		}
+
+		// Stimulus max age: a seen player is only lost after LoseSightTime without sight
+		const bool bWasSeen = (PrevSensed[Slot] & Sensed_Sight) != 0;
+		if (bSeen)
+		{
+			SightGraceLeft[Slot] = LoseSightTime[Slot];
+		}
+		else if (bWasSeen)
+		{
+			SightGraceLeft[Slot] -= Elapsed;
+			bSeen = SightGraceLeft[Slot] > 0.0f;
+		}
+
+		if (bSeen != bWasSeen)
+		{
+			PendingStimuli.Add({ Enemy, PlayerLocation, true, bSeen });
+		}
+
+		// Noises are discrete events: every one heard is reported
+		if ((Candidate & Sensed_Hearing) && !bSeen)
+		{
+			FVector NoiseLocation = PendingNoises[0].Location;
+			const FVector EnemyLocation = Enemy->GetActorLocation();
+			for (const FNoiseEvent& Noise : PendingNoises)
+			{
+				if (FVector::DistSquared(Noise.Location, EnemyLocation) < FVector::DistSquared(NoiseLocation, EnemyLocation))
+				{
+					NoiseLocation = Noise.Location;
+				}
+			}
+			PendingStimuli.Add({ Enemy, NoiseLocation, false, true });
+		}
+
+		PrevSensed[Slot] = bSeen ? Sensed_Sight : Sensed_None;
+	}
+
+	if (LastTraced != INDEX_NONE)
+	{
+		NextTraceSlot = (LastTraced + 1) % Num;
+	}
+
+	// ── Dispatch after the pass (handlers change enemy state) ──
+	for (const FPendingStimulus& Pending : PendingStimuli)
+	{
+		AEnemyBase* Enemy = Pending.Enemy.Get();
+		if (!Enemy) continue;
+
+		const UAISense& Sense = Pending.bSight
+			? static_cast<const UAISense&>(*GetDefault<UAISense_Sight>())
+			: static_cast<const UAISense&>(*GetDefault<UAISense_Hearing>());
+
+		FAIStimulus Stimulus(Sense, 1.0f, Pending.Location, Enemy->GetActorLocation(),
+			Pending.bSensed ? FAIStimulus::SensingSucceeded : FAIStimulus::SensingFailed);
+		Enemy->OnPerceptionUpdated(Player, Stimulus);
+	}
+}
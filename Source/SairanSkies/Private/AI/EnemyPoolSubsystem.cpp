@@ -0,0 +1,168 @@
+// SairanSkies - Enemy Pool
+
+#include "AI/EnemyPoolSubsystem.h"
+#include "Core/SairanStats.h"
+#include "Enemies/EnemyBase.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Enemy Pool Tick"), STAT_Sairan_EnemyPoolTick, STATGROUP_SairanAI);
+
+void UEnemyPoolSubsystem::Deinitialize()
+{
+	for (TPair<TSubclassOf<AEnemyBase>, FEnemyPoolBucket>& Pair : Buckets)
+	{
+		for (AEnemyBase* Enemy : Pair.Value.Free)
+		{
+			if (Enemy)
+			{
+				Enemy->OwningPool = nullptr;
+			}
+		}
+	}
+
+	Buckets.Empty();
+	ParkLocations.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UEnemyPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyPoolSubsystem, STATGROUP_Tickables);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PREWARM
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyPoolSubsystem::Prewarm(TSubclassOf<AEnemyBase> EnemyClass, int32 Count, const FVector& ParkLocation)
+{
+	if (!EnemyClass) return;
+
+	FEnemyPoolBucket& Bucket = Buckets.FindOrAdd(EnemyClass);
+	const int32 Target = FMath::Min(Count, MaxEnemiesPerClass);
+	Bucket.PendingPrewarm = FMath::Max(Bucket.PendingPrewarm, Target - Bucket.NumCreated);
+	ParkLocations.Add(EnemyClass, ParkLocation);
+}
+
+void UEnemyPoolSubsystem::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_EnemyPoolTick, AITick);
+
+	int32 Budget = MaxPrewarmSpawnsPerTick;
+
+	for (TPair<TSubclassOf<AEnemyBase>, FEnemyPoolBucket>& Pair : Buckets)
+	{
+		FEnemyPoolBucket& Bucket = Pair.Value;
+		if (Bucket.PendingPrewarm <= 0) continue;
+
+		const FVector* ParkLocation = ParkLocations.Find(Pair.Key);
+		const FTransform ParkTransform(ParkLocation ? *ParkLocation : FVector::ZeroVector);
+
+		while (Bucket.PendingPrewarm > 0 && Budget > 0)
+		{
+			--Bucket.PendingPrewarm;
+			--Budget;
+
+			if (Bucket.NumCreated >= MaxEnemiesPerClass)
+			{
+				Bucket.PendingPrewarm = 0;
+				break;
+			}
+
+			if (AEnemyBase* Enemy = CreateEnemy(Pair.Key, ParkTransform, /*bParked=*/true))
+			{
+				Bucket.Free.Add(Enemy);
+			}
+		}
+
+		if (Budget <= 0) break;
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ACQUIRE / RELEASE
+// ═══════════════════════════════════════════════════════════════════════════
+
+AEnemyBase* UEnemyPoolSubsystem::AcquireEnemy(TSubclassOf<AEnemyBase> EnemyClass, const FVector& Location, const FRotator& Rotation, APatrolPath* PatrolPath)
+{
+	if (!EnemyClass) return nullptr;
+
+	FEnemyPoolBucket& Bucket = Buckets.FindOrAdd(EnemyClass);
+
+	while (Bucket.Free.Num() > 0)
+	{
+		AEnemyBase* Enemy = Bucket.Free.Pop(EAllowShrinking::No);
+		if (!IsValid(Enemy))
+		{
+			// Pending kill while parked — EndPlay already took it off the count
+			continue;
+		}
+
+		// Before the reset: it registers with the managers and picks the start state
+		Enemy->PatrolPath = PatrolPath;
+		Enemy->ResetForReuse(Location, Rotation);
+		return Enemy;
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("EnemyPool: Pool miss for %s (%d created) — spawning"),
+		*EnemyClass->GetName(), Bucket.NumCreated);
+
+	return CreateEnemy(EnemyClass, FTransform(Rotation, Location), /*bParked=*/false, PatrolPath);
+}
+
+void UEnemyPoolSubsystem::ReleaseEnemy(AEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy) || Enemy->OwningPool != this || Enemy->bInPool) return;
+
+	FEnemyPoolBucket* Bucket = Buckets.Find(Enemy->GetClass());
+	if (!Bucket)
+	{
+		Enemy->Destroy();
+		return;
+	}
+
+	Enemy->DeactivateForPool();
+	Bucket->Free.Add(Enemy);
+}
+
+void UEnemyPoolSubsystem::NotifyEnemyDestroyed(AEnemyBase* Enemy)
+{
+	if (!Enemy) return;
+
+	if (FEnemyPoolBucket* Bucket = Buckets.Find(Enemy->GetClass()))
+	{
+		Bucket->Free.RemoveSingleSwap(Enemy, EAllowShrinking::No);
+		Bucket->NumCreated = FMath::Max(0, Bucket->NumCreated - 1);
+	}
+}
+
+AEnemyBase* UEnemyPoolSubsystem::CreateEnemy(TSubclassOf<AEnemyBase> EnemyClass, const FTransform& Transform, bool bParked, APatrolPath* PatrolPath)
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	AEnemyBase* Enemy = World->SpawnActorDeferred<AEnemyBase>(EnemyClass, Transform, nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+	if (!Enemy) return nullptr;
+
+	// Set before BeginPlay so a parked enemy unpossesses and parks before registering anywhere
+	Enemy->OwningPool = this;
+	Enemy->bInPool = bParked;
+	Enemy->PatrolPath = PatrolPath;
+	Enemy->FinishSpawning(Transform);
+
+	++Buckets.FindOrAdd(EnemyClass).NumCreated;
+	return Enemy;
+}
+
+int32 UEnemyPoolSubsystem::GetNumFree(TSubclassOf<AEnemyBase> EnemyClass) const
+{
+	const FEnemyPoolBucket* Bucket = Buckets.Find(EnemyClass);
+	return Bucket ? Bucket->Free.Num() : 0;
+}
+
+int32 UEnemyPoolSubsystem::GetNumCreated(TSubclassOf<AEnemyBase> EnemyClass) const
+{
+	const FEnemyPoolBucket* Bucket = Buckets.Find(EnemyClass);
+	return Bucket ? Bucket->NumCreated : 0;
+}
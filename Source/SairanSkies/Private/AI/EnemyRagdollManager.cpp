@@ -0,0 +1,229 @@
+// SairanSkies - Enemy Ragdoll Manager
+
+#include "AI/EnemyRagdollManager.h"
+#include "Core/SairanStats.h"
+#include "Enemies/EnemyBase.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Ragdoll Manager Tick"), STAT_Sairan_RagdollTick, STATGROUP_SairanVFX);
+
+void UEnemyRagdollManager::Deinitialize()
+{
+	for (const FCorpse& Corpse : Corpses)
+	{
+		if (AEnemyBase* Enemy = Corpse.Enemy.Get())
+		{
+			Enemy->RagdollSlot = INDEX_NONE;
+		}
+	}
+
+	Corpses.Empty();
+	NumSimulating = 0;
+	Super::Deinitialize();
+}
+
+TStatId UEnemyRagdollManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyRagdollManager, STATGROUP_Tickables);
+}
+
+int32 UEnemyRagdollManager::GetSlot(const AEnemyBase* Enemy) const
+{
+	if (!Enemy) return INDEX_NONE;
+	const int32 Slot = Enemy->RagdollSlot;
+	return (Corpses.IsValidIndex(Slot) && Corpses[Slot].Enemy.Get() == Enemy) ? Slot : INDEX_NONE;
+}
+
+void UEnemyRagdollManager::RemoveSlot(int32 Slot)
+{
+	if (Corpses[Slot].State == ECorpseState::Simulating)
+	{
+		--NumSimulating;
+	}
+	if (AEnemyBase* Enemy = Corpses[Slot].Enemy.Get())
+	{
+		Enemy->RagdollSlot = INDEX_NONE;
+	}
+
+	Corpses.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	if (Corpses.IsValidIndex(Slot))
+	{
+		if (AEnemyBase* Moved = Corpses[Slot].Enemy.Get())
+		{
+			Moved->RagdollSlot = Slot;
+		}
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CORPSES
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyRagdollManager::AddCorpse(AEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy) || GetSlot(Enemy) != INDEX_NONE) return;
+
+	if (MaxSimulatingRagdolls <= 0)
+	{
+		StartFallback(Enemy);
+		return;
+	}
+
+	if (NumSimulating >= MaxSimulatingRagdolls)
+	{
+		FVector ViewerLocation = Enemy->GetActorLocation();
+		GetViewerLocation(ViewerLocation);
+
+		// Oldest / farthest simulating corpse
+		int32 WorstSlot = INDEX_NONE;
+		float WorstScore = -1.0f;
+		for (int32 Slot = 0; Slot < Corpses.Num(); ++Slot)
+		{
+			const FCorpse& Corpse = Corpses[Slot];
+			const AEnemyBase* Other = Corpse.Enemy.Get();
+			if (Corpse.State != ECorpseState::Simulating || !Other) continue;
+
+			const float Score = GetEvictionScore(Other, Corpse.Age, ViewerLocation);
+			if (Score > WorstScore)
+			{
+				WorstScore = Score;
+				WorstSlot = Slot;
+			}
+		}
+
+		if (WorstSlot == INDEX_NONE || WorstScore <= GetEvictionScore(Enemy, 0.0f, ViewerLocation))
+		{
+			StartFallback(Enemy);
+			return;
+		}
+
+		FreezeSlot(WorstSlot);
+	}
+
+	Enemy->StartRagdoll();
+
+	FCorpse& Corpse = Corpses.AddDefaulted_GetRef();
+	Corpse.Enemy = Enemy;
+	Corpse.State = ECorpseState::Simulating;
+	Enemy->RagdollSlot = Corpses.Num() - 1;
+	++NumSimulating;
+}
+
+void UEnemyRagdollManager::RemoveCorpse(AEnemyBase* Enemy)
+{
+	const int32 Slot = GetSlot(Enemy);
+	if (Slot != INDEX_NONE)
+	{
+		RemoveSlot(Slot);
+	}
+}
+
+void UEnemyRagdollManager::StartFallback(AEnemyBase* Enemy)
+{
+	USkeletalMeshComponent* Mesh = Enemy->GetMesh();
+	if (!Mesh) return;
+
+	UAnimMontage* DeathMontage = Enemy->AnimationConfig.DeathMontage;
+	UAnimInstance* AnimInstance = Mesh->GetAnimInstance();
+	const float Duration = (DeathMontage && AnimInstance) ? AnimInstance->Montage_Play(DeathMontage) : 0.0f;
+
+	if (Duration <= 0.0f)
+	{
+		// Sin montage: congelar la pose en la que murió
+		FreezePose(Mesh);
+		return;
+	}
+
+	// Freeze on the last pose, before the montage blends back to locomotion
+	FCorpse& Corpse = Corpses.AddDefaulted_GetRef();
+	Corpse.Enemy = Enemy;
+	Corpse.State = ECorpseState::Montage;
+	Corpse.FreezeAge = FMath::Max(0.0f, Duration - DeathMontage->GetDefaultBlendOutTime());
+	Enemy->RagdollSlot = Corpses.Num() - 1;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TICK
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyRagdollManager::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_RagdollTick, VFX);
+
+	for (int32 Slot = Corpses.Num() - 1; Slot >= 0; --Slot)
+	{
+		FCorpse& Corpse = Corpses[Slot];
+		AEnemyBase* Enemy = Corpse.Enemy.Get();
+		USkeletalMeshComponent* Mesh = Enemy ? Enemy->GetMesh() : nullptr;
+		if (!Mesh)
+		{
+			RemoveSlot(Slot);
+			continue;
+		}
+
+		Corpse.Age += DeltaTime;
+
+		bool bFreeze = false;
+		if (Corpse.State == ECorpseState::Simulating)
+		{
+			const float Speed = Mesh->GetPhysicsLinearVelocity().Size();
+			Corpse.SettledTime = (Speed < SettleSpeed) ? Corpse.SettledTime + DeltaTime : 0.0f;
+			bFreeze = Corpse.SettledTime >= SettleTime || Corpse.Age >= MaxSimulationTime;
+		}
+		else
+		{
+			bFreeze = Corpse.Age >= Corpse.FreezeAge;
+		}
+
+		if (bFreeze)
+		{
+			FreezeSlot(Slot);
+		}
+	}
+}
+
+void UEnemyRagdollManager::FreezeSlot(int32 Slot)
+{
+	if (AEnemyBase* Enemy = Corpses[Slot].Enemy.Get())
+	{
+		FreezePose(Enemy->GetMesh());
+	}
+	RemoveSlot(Slot);
+}
+
+void UEnemyRagdollManager::FreezePose(USkeletalMeshComponent* Mesh)
+{
+	if (!Mesh) return;
+
+	// Keep the current bone transforms as a static pose snapshot
+	Mesh->bNoSkeletonUpdate = true;
+	Mesh->SetAllBodiesSimulatePhysics(false);
+	Mesh->SetSimulatePhysics(false);
+	Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Mesh->SetComponentTickEnabled(false);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SCORING
+// ═══════════════════════════════════════════════════════════════════════════
+
+float UEnemyRagdollManager::GetEvictionScore(const AEnemyBase* Enemy, float Age, const FVector& ViewerLocation) const
+{
+	// The mesh follows the ragdoll, the capsule stays where the enemy died
+	const FVector Location = Enemy->GetMesh() ? Enemy->GetMesh()->GetComponentLocation() : Enemy->GetActorLocation();
+	return Age + FVector::Dist(ViewerLocation, Location) * DistanceWeight;
+}
+
+bool UEnemyRagdollManager::GetViewerLocation(FVector& OutLocation) const
+{
+	if (APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0))
+	{
+		OutLocation = Player->GetActorLocation();
+		return true;
+	}
+	return false;
+}
@@ -0,0 +1,264 @@
+// SairanSkies - Enemy Registry (Uniform Spatial Hash)
+
+#include "AI/EnemyRegistrySubsystem.h"
+#include "Core/SairanStats.h"
+#include "Enemies/EnemyBase.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Registry Tick"), STAT_Sairan_RegistryTick, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("Registry Query Radius"), STAT_Sairan_RegistryQueryRadius, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("Registry Query K Nearest"), STAT_Sairan_RegistryQueryKNearest, STATGROUP_SairanAI);
+
+void UEnemyRegistrySubsystem::Deinitialize()
+{
+	Entries.Empty();
+	EntryIndexByEnemy.Empty();
+	Cells.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UEnemyRegistrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyRegistrySubsystem, STATGROUP_Tickables);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// INTERNAL HELPERS
+// ═══════════════════════════════════════════════════════════════════════════
+
+FIntPoint UEnemyRegistrySubsystem::ToCell(const FVector& Location) const
+{
+	const float InvCell = 1.0f / FMath::Max(CellSize, 1.0f);
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X * InvCell),
+		FMath::FloorToInt32(Location.Y * InvCell));
+}
+
+void UEnemyRegistrySubsystem::AddToCell(const FIntPoint& Cell, int32 EntryIndex)
+{
+	Cells.FindOrAdd(Cell).Add(EntryIndex);
+}
+
+void UEnemyRegistrySubsystem::RemoveFromCell(const FIntPoint& Cell, int32 EntryIndex)
+{
+	if (TArray<int32>* Bucket = Cells.Find(Cell))
+	{
+		Bucket->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+		if (Bucket->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UEnemyRegistrySubsystem::RemoveEntryAt(int32 Index)
+{
+	const int32 LastIndex = Entries.Num() - 1;
+
+	RemoveFromCell(Entries[Index].Cell, Index);
+	EntryIndexByEnemy.Remove(Entries[Index].RawEnemy);
+
+	if (Index != LastIndex)
+	{
+		// The last entry is about to move into Index: retarget its references
+		FEnemyEntry& Moved = Entries[LastIndex];
+		if (TArray<int32>* Bucket = Cells.Find(Moved.Cell))
+		{
+			const int32 Slot = Bucket->IndexOfByKey(LastIndex);
+			if (Slot != INDEX_NONE)
+			{
+				(*Bucket)[Slot] = Index;
+			}
+		}
+		EntryIndexByEnemy.Add(Moved.RawEnemy, Index);
+	}
+
+	Entries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+bool UEnemyRegistrySubsystem::PassesFilter(const FEnemyEntry& Entry, const AEnemyBase* Exclude, bool bIncludeDead) const
+{
+	if (Entry.RawEnemy == Exclude || !Entry.Enemy.IsValid())
+	{
+		return false;
+	}
+	return bIncludeDead || !Entry.RawEnemy->IsDead();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REGISTRATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyRegistrySubsystem::RegisterEnemy(AEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy) || EntryIndexByEnemy.Contains(Enemy)) return;
+
+	FEnemyEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Enemy = Enemy;
+	Entry.RawEnemy = Enemy;
+	Entry.Location = Enemy->GetActorLocation();
+	Entry.Cell = ToCell(Entry.Location);
+
+	const int32 Index = Entries.Num() - 1;
+	EntryIndexByEnemy.Add(Enemy, Index);
+	AddToCell(Entry.Cell, Index);
+}
+
+void UEnemyRegistrySubsystem::UnregisterEnemy(AEnemyBase* Enemy)
+{
+	if (const int32* Index = EntryIndexByEnemy.Find(Enemy))
+	{
+		RemoveEntryAt(*Index);
+	}
+}
+
+void UEnemyRegistrySubsystem::GetAllEnemies(TArray<AEnemyBase*>& OutEnemies) const
+{
+	OutEnemies.Reserve(OutEnemies.Num() + Entries.Num());
+	for (const FEnemyEntry& Entry : Entries)
+	{
+		if (Entry.Enemy.IsValid())
+		{
+			OutEnemies.Add(Entry.RawEnemy);
+		}
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// INCREMENTAL UPDATE
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyRegistrySubsystem::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_RegistryTick, AITick);
+
+	// Iterate backwards so stale entries can be swap-removed in place
+	for (int32 i = Entries.Num() - 1; i >= 0; --i)
+	{
+		FEnemyEntry& Entry = Entries[i];
+		AEnemyBase* Enemy = Entry.Enemy.Get();
+		if (!Enemy)
+		{
+			// Destroyed without going through EndPlay (level streaming, editor)
+			RemoveEntryAt(i);
+			continue;
+		}
+
+		Entry.Location = Enemy->GetActorLocation();
+		const FIntPoint NewCell = ToCell(Entry.Location);
+		if (NewCell != Entry.Cell)
+		{
+			RemoveFromCell(Entry.Cell, i);
+			AddToCell(NewCell, i);
+			Entry.Cell = NewCell;
+		}
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// QUERIES
+// ═══════════════════════════════════════════════════════════════════════════
+
+int32 UEnemyRegistrySubsystem::QueryRadius(const FVector& Center, float Radius, TArray<AEnemyBase*>& OutEnemies,
+	const AEnemyBase* Exclude, bool bIncludeDead) const
+{
+	SAIRAN_SCOPE(STAT_Sairan_RegistryQueryRadius, AITick);
+
+	const int32 StartNum = OutEnemies.Num();
+	const float RadiusSq = FMath::Square(Radius);
+
+	ForEachInCells(Center, Radius, [&](int32 EntryIndex)
+	{
+		const FEnemyEntry& Entry = Entries[EntryIndex];
+		if (PassesFilter(Entry, Exclude, bIncludeDead) &&
+			FVector::DistSquared(Center, Entry.Location) <= RadiusSq)
+		{
+			OutEnemies.Add(Entry.RawEnemy);
+		}
+	});
+
+	return OutEnemies.Num() - StartNum;
+}
+
+int32 UEnemyRegistrySubsystem::QueryKNearest(const FVector& Center, int32 K, float MaxRadius, TArray<AEnemyBase*>& OutEnemies,
+	const AEnemyBase* Exclude, bool bIncludeDead) const
+{
+	SAIRAN_SCOPE(STAT_Sairan_RegistryQueryKNearest, AITick);
+
+	if (K <= 0 || Entries.Num() == 0) return 0;
+
+	struct FCandidate
+	{
+		AEnemyBase* Enemy;
+		float DistSq;
+	};
+
+	TArray<FCandidate, TInlineAllocator<16>> Best;
+	const float MaxRadiusSq = FMath::Square(MaxRadius);
+	const FIntPoint CenterCell = ToCell(Center);
+	const int32 MaxRing = FMath::CeilToInt32(MaxRadius / FMath::Max(CellSize, 1.0f)) + 1;
+
+	auto VisitCell = [&](const FIntPoint& Cell)
+	{
+		const TArray<int32>* Bucket = Cells.Find(Cell);
+		if (!Bucket) return;
+
+		for (int32 EntryIndex : *Bucket)
+		{
+			const FEnemyEntry& Entry = Entries[EntryIndex];
+			if (!PassesFilter(Entry, Exclude, bIncludeDead)) continue;
+
+			const float DistSq = FVector::DistSquared(Center, Entry.Location);
+			if (DistSq > MaxRadiusSq) continue;
+			if (Best.Num() == K && DistSq >= Best.Last().DistSq) continue;
+
+			// Sorted insert, keep at most K
+			int32 InsertAt = Best.Num();
+			while (InsertAt > 0 && Best[InsertAt - 1].DistSq > DistSq)
+			{
+				--InsertAt;
+			}
+			Best.Insert({ Entry.RawEnemy, DistSq }, InsertAt);
+			if (Best.Num() > K)
+			{
+				Best.Pop(EAllowShrinking::No);
+			}
+		}
+	};
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		// Anything in ring R is at least (R-1)*CellSize away in XY
+		if (Best.Num() == K)
+		{
+			const float RingMinDist = FMath::Max(0, Ring - 1) * CellSize;
+			if (FMath::Square(RingMinDist) > Best.Last().DistSq)
+			{
+				break;
+			}
+		}
+
+		if (Ring == 0)
+		{
+			VisitCell(CenterCell);
+			continue;
+		}
+
+		for (int32 d = -Ring; d <= Ring; ++d)
+		{
+			VisitCell(FIntPoint(CenterCell.X + d, CenterCell.Y - Ring));
+			VisitCell(FIntPoint(CenterCell.X + d, CenterCell.Y + Ring));
+		}
+		for (int32 d = -Ring + 1; d <= Ring - 1; ++d)
+		{
+			VisitCell(FIntPoint(CenterCell.X - Ring, CenterCell.Y + d));
+			VisitCell(FIntPoint(CenterCell.X + Ring, CenterCell.Y + d));
+		}
+	}
+
+	for (const FCandidate& C : Best)
+	{
+		OutEnemies.Add(C.Enemy);
+	}
+	return Best.Num();
+}
@@ -0,0 +1,236 @@
+// SairanSkies - Enemy Significance Manager (AI LOD)
+
+#include "AI/EnemySignificanceManager.h"
+#include "Core/SairanStats.h"
+#include "AI/EnemyAIController.h"
+#include "Enemies/EnemyBase.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Significance Tick"), STAT_Sairan_SignificanceTick, STATGROUP_SairanAI);
+
+UEnemySignificanceManager::UEnemySignificanceManager()
+{
+	// Defaults per tier (interval 0 = every frame)
+	FEnemySignificanceTierSettings Critical;
+	TierSettings.Add(EEnemySignificance::Critical, Critical);
+
+	FEnemySignificanceTierSettings High;
+	High.AnimationTickInterval = 0.0f;
+	TierSettings.Add(EEnemySignificance::High, High);
+
+	FEnemySignificanceTierSettings Medium;
+	Medium.MovementTickInterval = 0.033f;
+	Medium.AnimationTickInterval = 0.066f;
+	TierSettings.Add(EEnemySignificance::Medium, Medium);
+
+	FEnemySignificanceTierSettings Low;
+	Low.MovementTickInterval = 0.1f;
+	Low.bSightEnabled = false;
+	Low.AnimationTickInterval = 0.25f;
+	TierSettings.Add(EEnemySignificance::Low, Low);
+}
+
+void UEnemySignificanceManager::Deinitialize()
+{
+	Entries.Empty();
+	NextEvaluationIndex = 0;
+	EvaluationCarry = 0.0f;
+	Super::Deinitialize();
+}
+
+TStatId UEnemySignificanceManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemySignificanceManager, STATGROUP_Tickables);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REGISTRATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemySignificanceManager::RegisterEnemy(AEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy)) return;
+	if (Entries.IsValidIndex(Enemy->SignificanceSlot) && Entries[Enemy->SignificanceSlot].Enemy.Get() == Enemy) return;
+
+	FSignificanceEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Enemy = Enemy;
+	Entry.Tier = EEnemySignificance::Critical;
+	// Back-date so the first evaluation may demote without waiting MinTimeInTier
+	Entry.TierEnterTime = GetWorld()->GetTimeSeconds() - MinTimeInTier;
+	Enemy->SignificanceSlot = Entries.Num() - 1;
+
+	// Classify right away so freshly spawned far-away enemies start cheap
+	FVector ViewerLocation;
+	if (GetViewerLocation(ViewerLocation))
+	{
+		Evaluate(Entry, ViewerLocation, GetWorld()->GetTimeSeconds());
+	}
+}
+
+void UEnemySignificanceManager::UnregisterEnemy(AEnemyBase* Enemy)
+{
+	if (!Enemy) return;
+	const int32 Slot = Enemy->SignificanceSlot;
+	if (!Entries.IsValidIndex(Slot) || Entries[Slot].Enemy.Get() != Enemy) return;
+
+	ApplyTier(Enemy, EEnemySignificance::Critical);
+
+	Entries.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	if (Entries.IsValidIndex(Slot))
+	{
+		if (AEnemyBase* Moved = Entries[Slot].Enemy.Get())
+		{
+			Moved->SignificanceSlot = Slot;
+		}
+	}
+	Enemy->SignificanceSlot = INDEX_NONE;
+}
+
+void UEnemySignificanceManager::RequestImmediateEvaluation(AEnemyBase* Enemy)
+{
+	if (!Enemy) return;
+	const int32 Slot = Enemy->SignificanceSlot;
+	if (!Entries.IsValidIndex(Slot) || Entries[Slot].Enemy.Get() != Enemy) return;
+
+	FVector ViewerLocation;
+	if (GetViewerLocation(ViewerLocation))
+	{
+		Evaluate(Entries[Slot], ViewerLocation, GetWorld()->GetTimeSeconds());
+	}
+}
+
+int32 UEnemySignificanceManager::GetNumEnemiesInTier(EEnemySignificance Tier) const
+{
+	int32 Count = 0;
+	for (const FSignificanceEntry& Entry : Entries)
+	{
+		Count += (Entry.Tier == Tier) ? 1 : 0;
+	}
+	return Count;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// EVALUATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool UEnemySignificanceManager::GetViewerLocation(FVector& OutLocation) const
+{
+	if (APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0))
+	{
+		OutLocation = Player->GetActorLocation();
+		return true;
+	}
+	return false;
+}
+
+const FEnemySignificanceTierSettings& UEnemySignificanceManager::GetSettings(EEnemySignificance Tier) const
+{
+	static const FEnemySignificanceTierSettings FullRate;
+	const FEnemySignificanceTierSettings* Settings = TierSettings.Find(Tier);
+	return Settings ? *Settings : FullRate;
+}
+
+EEnemySignificance UEnemySignificanceManager::ComputeTier(const FSignificanceEntry& Entry, const FVector& ViewerLocation, float Now) const
+{
+	const AEnemyBase* Enemy = Entry.Enemy.Get();
+
+	// Combat always runs at full rate
+	if (Enemy->IsInCombat() || Enemy->IsAlerted())
+	{
+		return EEnemySignificance::Critical;
+	}
+
+	const float Dist = FVector::Dist(ViewerLocation, Enemy->GetActorLocation());
+	const bool bOnScreen = Enemy->WasRecentlyRendered(OnScreenTolerance);
+
+	auto Classify = [&](float Bias)
+	{
+		if (Dist <= HighDistance + Bias)   return EEnemySignificance::High;
+		if (Dist <= MediumDistance + Bias) return bOnScreen ? EEnemySignificance::High : EEnemySignificance::Medium;
+		if (Dist <= LowDistance + Bias)    return bOnScreen ? EEnemySignificance::Medium : EEnemySignificance::Low;
+		return EEnemySignificance::Low;
+	};
+
+	const EEnemySignificance Candidate = Classify(0.0f);
+	if (Candidate <= Entry.Tier)
+	{
+		// Same or more significant: promote immediately
+		return Candidate;
+	}
+
+	// Demotion: must clear the hysteresis band and have spent enough time in the tier
+	const EEnemySignificance Demoted = Classify(HysteresisDistance);
+	if (Demoted <= Entry.Tier || Now - Entry.TierEnterTime < MinTimeInTier)
+	{
+		return Entry.Tier;
+	}
+	return Demoted;
+}
+
+void UEnemySignificanceManager::Evaluate(FSignificanceEntry& Entry, const FVector& ViewerLocation, float Now)
+{
+	AEnemyBase* Enemy = Entry.Enemy.Get();
+	if (!Enemy || Enemy->IsDead()) return;
+
+	const EEnemySignificance NewTier = ComputeTier(Entry, ViewerLocation, Now);
+	if (NewTier == Entry.Tier && Enemy->GetSignificanceTier() == NewTier)
+	{
+		return;
+	}
+
+	Entry.Tier = NewTier;
+	Entry.TierEnterTime = Now;
+	ApplyTier(Enemy, NewTier);
+}
+
+void UEnemySignificanceManager::ApplyTier(AEnemyBase* Enemy, EEnemySignificance Tier) const
+{
+	const FEnemySignificanceTierSettings& Settings = GetSettings(Tier);
+
+	if (UCharacterMovementComponent* CMC = Enemy->GetCharacterMovement())
+	{
+		CMC->SetComponentTickInterval(Settings.MovementTickInterval);
+	}
+
+	if (USkeletalMeshComponent* SkelMesh = Enemy->GetMesh())
+	{
+		SkelMesh->SetComponentTickInterval(Settings.AnimationTickInterval);
+	}
+
+	if (AEnemyAIController* AIC = Cast<AEnemyAIController>(Enemy->GetController()))
+	{
+		AIC->SetSightEnabled(Settings.bSightEnabled);
+	}
+
+	Enemy->SetSignificance(Tier);
+}
+
+void UEnemySignificanceManager::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_SignificanceTick, AITick);
+
+	const int32 Num = Entries.Num();
+	if (Num == 0) return;
+
+	FVector ViewerLocation;
+	if (!GetViewerLocation(ViewerLocation)) return;
+
+	// Spread a full sweep over EvaluationPeriod
+	EvaluationCarry = FMath::Min(EvaluationCarry + Num * DeltaTime / EvaluationPeriod, static_cast<float>(Num));
+	int32 Budget = FMath::Min(FMath::FloorToInt32(EvaluationCarry), Num);
+	EvaluationCarry -= Budget;
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	while (Budget-- > 0)
+	{
+		if (NextEvaluationIndex >= Entries.Num())
+		{
+			NextEvaluationIndex = 0;
+		}
+		Evaluate(Entries[NextEvaluationIndex], ViewerLocation, Now);
+		++NextEvaluationIndex;
+	}
+}
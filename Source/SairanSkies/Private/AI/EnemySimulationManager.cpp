@@ -0,0 +1,173 @@
+// SairanSkies - Enemy Simulation Manager (SoA timers)
+
+#include "AI/EnemySimulationManager.h"
+#include "Core/SairanStats.h"
+#include "Enemies/EnemyBase.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Simulation Tick"), STAT_Sairan_SimulationTick, STATGROUP_SairanAI);
+
+void UEnemySimulationManager::Deinitialize()
+{
+	for (AEnemyBase* Enemy : Enemies)
+	{
+		if (Enemy)
+		{
+			Enemy->SimulationSlot = INDEX_NONE;
+		}
+	}
+
+	Enemies.Empty();
+	for (TArray<float>& Channel : Timers)
+	{
+		Channel.Empty();
+	}
+	Continuous.Empty();
+	Fired.Empty();
+	PendingEvents.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UEnemySimulationManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemySimulationManager, STATGROUP_Tickables);
+}
+
+int32 UEnemySimulationManager::GetSlot(const AEnemyBase* Enemy) const
+{
+	if (!Enemy) return INDEX_NONE;
+	const int32 Slot = Enemy->SimulationSlot;
+	return (Enemies.IsValidIndex(Slot) && Enemies[Slot] == Enemy) ? Slot : INDEX_NONE;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REGISTRATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemySimulationManager::RegisterEnemy(AEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy) || GetSlot(Enemy) != INDEX_NONE) return;
+
+	Enemy->SimulationSlot = Enemies.Add(Enemy);
+	for (TArray<float>& Channel : Timers)
+	{
+		Channel.Add(0.0f);
+	}
+	Continuous.Add(EEnemySimContinuous::None);
+}
+
+void UEnemySimulationManager::UnregisterEnemy(AEnemyBase* Enemy)
+{
+	const int32 Slot = GetSlot(Enemy);
+	if (Slot == INDEX_NONE) return;
+
+	// Swap-remove across every array, then fix the moved enemy's slot
+	Enemies.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	for (TArray<float>& Channel : Timers)
+	{
+		Channel.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	}
+	Continuous.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+
+	if (Enemies.IsValidIndex(Slot) && Enemies[Slot])
+	{
+		Enemies[Slot]->SimulationSlot = Slot;
+	}
+	Enemy->SimulationSlot = INDEX_NONE;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TIMERS
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemySimulationManager::SetTimer(const AEnemyBase* Enemy, EEnemySimTimer Timer, float Seconds)
+{
+	const int32 Slot = GetSlot(Enemy);
+	if (Slot == INDEX_NONE) return;
+	Timers[static_cast<int32>(Timer)][Slot] = FMath::Max(Seconds, KINDA_SMALL_NUMBER);
+}
+
+void UEnemySimulationManager::ClearTimer(const AEnemyBase* Enemy, EEnemySimTimer Timer)
+{
+	const int32 Slot = GetSlot(Enemy);
+	if (Slot == INDEX_NONE) return;
+	Timers[static_cast<int32>(Timer)][Slot] = 0.0f;
+}
+
+float UEnemySimulationManager::GetTimerRemaining(const AEnemyBase* Enemy, EEnemySimTimer Timer) const
+{
+	const int32 Slot = GetSlot(Enemy);
+	return Slot != INDEX_NONE ? Timers[static_cast<int32>(Timer)][Slot] : 0.0f;
+}
+
+void UEnemySimulationManager::SetContinuousMask(const AEnemyBase* Enemy, uint8 Mask)
+{
+	const int32 Slot = GetSlot(Enemy);
+	if (Slot == INDEX_NONE) return;
+	Continuous[Slot] = Mask;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FRAME
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemySimulationManager::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_SimulationTick, AITick);
+
+	const int32 Num = Enemies.Num();
+	if (Num == 0) return;
+
+	SAIRAN_COUNT(STAT_Sairan_EnemiesTicked, EnemiesTicked, Num);
+
+	// ── 1. Continuous pass (only the few enemies that move themselves) ──
+	for (int32 Slot = 0; Slot < Num; ++Slot)
+	{
+		if (Continuous[Slot] != EEnemySimContinuous::None && Enemies[Slot])
+		{
+			Enemies[Slot]->UpdateSimulationContinuous(Continuous[Slot], DeltaTime);
+		}
+	}
+
+	// ── 2. Batched timer pass: no branches, one channel at a time ──
+	Fired.SetNumUninitialized(Num, EAllowShrinking::No);
+	FMemory::Memzero(Fired.GetData(), Num * sizeof(uint8));
+	uint8* RESTRICT FiredData = Fired.GetData();
+
+	for (int32 Channel = 0; Channel < NumTimers; ++Channel)
+	{
+		float* RESTRICT Remaining = Timers[Channel].GetData();
+		const uint8 Bit = static_cast<uint8>(1u << Channel);
+
+		for (int32 Slot = 0; Slot < Num; ++Slot)
+		{
+			const float Prev = Remaining[Slot];
+			const float Next = FMath::Max(Prev - DeltaTime, 0.0f);
+			Remaining[Slot] = Next;
+			FiredData[Slot] |= static_cast<uint8>((Prev > 0.0f) & (Next <= 0.0f)) * Bit;
+		}
+	}
+
+	// ── 3. Collect crossings, then dispatch (handlers may re-arm / unregister) ──
+	PendingEvents.Reset();
+	for (int32 Slot = 0; Slot < Num; ++Slot)
+	{
+		if (FiredData[Slot] != 0)
+		{
+			PendingEvents.Add({ Enemies[Slot].Get(), FiredData[Slot] });
+		}
+	}
+
+	for (const FPendingEvent& Event : PendingEvents)
+	{
+		for (int32 Channel = 0; Channel < NumTimers; ++Channel)
+		{
+			if ((Event.FiredMask & (1u << Channel)) == 0) continue;
+
+			AEnemyBase* Enemy = Event.Enemy.Get();
+			if (!Enemy || GetSlot(Enemy) == INDEX_NONE) break;
+
+			Enemy->OnSimulationTimerExpired(static_cast<EEnemySimTimer>(Channel));
+		}
+	}
+}
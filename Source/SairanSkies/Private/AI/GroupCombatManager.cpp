@@ -1,8 +1,16 @@
 // SairanSkies - Group Combat Manager (Two-Circle Model)
 
 #include "AI/GroupCombatManager.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
+#include "AI/EnemyAIController.h"
 #include "Engine/World.h"
+#include "NavigationSystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Group Combat Tick"), STAT_Sairan_GroupCombatTick, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("Group Combat Request Entry"), STAT_Sairan_GroupCombatRequestEntry, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("Group Combat Outer Position"), STAT_Sairan_GroupCombatOuterPosition, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("Group Combat Inner Position"), STAT_Sairan_GroupCombatInnerPosition, STATGROUP_SairanAI);
 
 void UGroupCombatManager::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -11,97 +19,254 @@ void UGroupCombatManager::Initialize(FSubsystemCollectionBase& Collection)
 
 void UGroupCombatManager::Deinitialize()
 {
-	CombatEnemies.Empty();
-	OuterCircleEnemies.Empty();
-	InnerCircleEnemies.Empty();
-	InnerCooldowns.Empty();
+	for (const FCombatRecord& Record : Records)
+	{
+		if (AEnemyBase* Enemy = Record.Enemy.Get())
+		{
+			Enemy->CombatHandle = INDEX_NONE;
+		}
+	}
+
+	Records.Empty();
+	FreeHandles.Empty();
+	Pools.Empty();
+	FreePools.Empty();
+	PoolByTarget.Empty();
+	NumInner = 0;
+	NumOuter = 0;
 	Super::Deinitialize();
 }
 
+TStatId UGroupCombatManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGroupCombatManager, STATGROUP_Tickables);
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 // INTERNAL HELPERS
 // ═══════════════════════════════════════════════════════════════════════════
 
-void UGroupCombatManager::PurgeInvalidEnemies()
+int32 UGroupCombatManager::GetHandle(const AEnemyBase* Enemy) const
 {
-	auto IsInvalid = [](const AEnemyBase* E) { return !IsValid(E) || E->IsDead(); };
-	CombatEnemies.RemoveAll(IsInvalid);
-	OuterCircleEnemies.RemoveAll(IsInvalid);
-	InnerCircleEnemies.RemoveAll(IsInvalid);
+	if (!Enemy) return INDEX_NONE;
+	const int32 Handle = Enemy->CombatHandle;
+	return (Records.IsValidIndex(Handle) && Records[Handle].Enemy.Get() == Enemy) ? Handle : INDEX_NONE;
+}
 
-	TArray<TWeakObjectPtr<AEnemyBase>> KeysToRemove;
-	for (auto& Pair : InnerCooldowns)
+int32 UGroupCombatManager::AcquirePool(AActor* Target)
+{
+	if (const int32* Existing = PoolByTarget.Find(Target))
 	{
-		if (!Pair.Key.IsValid() || Pair.Key->IsDead())
-			KeysToRemove.Add(Pair.Key);
+		return *Existing;
 	}
-	for (auto& Key : KeysToRemove)
-		InnerCooldowns.Remove(Key);
+
+	const int32 PoolIndex = FreePools.Num() > 0 ? FreePools.Pop(EAllowShrinking::No) : Pools.AddDefaulted();
+	Pools[PoolIndex].Target = Target;
+	PoolByTarget.Add(Target, PoolIndex);
+	return PoolIndex;
 }
 
-FVector UGroupCombatManager::ComputeRingPosition(int32 EnemyIndex, int32 TotalOnRing,
-	float MinR, float MaxR, const FVector& Center, int32 Seed) const
+void UGroupCombatManager::ReleasePoolIfEmpty(int32 PoolIndex)
 {
-	if (TotalOnRing <= 0) TotalOnRing = 1;
+	FTargetTokenPool& Pool = Pools[PoolIndex];
+	if (Pool.NumMembers() > 0) return;
 
-	// Golden-angle distribution for organic spread
-	const float GoldenAngle = 137.508f;
-	float AngleDeg = GoldenAngle * EnemyIndex;
+	PoolByTarget.Remove(Pool.Target);
+	Pool = FTargetTokenPool();
+	FreePools.Add(PoolIndex);
+}
 
-	FRandomStream Rng(Seed + EnemyIndex * 7919);
-	AngleDeg += Rng.FRandRange(-20.0f, 20.0f);
+void UGroupCombatManager::RemoveRecord(int32 Handle)
+{
+	FCombatRecord& Record = Records[Handle];
+	const int32 PoolIndex = Record.Pool;
 
-	float AngleRad = FMath::DegreesToRadians(AngleDeg);
-	float Radius = Rng.FRandRange(MinR, MaxR);
+	CancelReservation(Handle);
+	RemoveFromCircle(Handle);
 
-	FVector Pos = Center;
-	Pos.X += FMath::Cos(AngleRad) * Radius;
-	Pos.Y += FMath::Sin(AngleRad) * Radius;
-	return Pos;
+	if (AEnemyBase* Enemy = Record.Enemy.Get())
+	{
+		Enemy->CombatHandle = INDEX_NONE;
+	}
+
+	// Reset also clears QueueSerial, which invalidates any ready-queue entry
+	Record = FCombatRecord();
+	FreeHandles.Add(Handle);
+	ReleasePoolIfEmpty(PoolIndex);
+}
+
+void UGroupCombatManager::AddToCircle(int32 Handle, ECombatCircle Circle)
+{
+	FCombatRecord& Record = Records[Handle];
+	FTargetTokenPool& Pool = Pools[Record.Pool];
+	TArray<int32>& List = (Circle == ECombatCircle::Inner) ? Pool.Inner : Pool.Outer;
+
+	Record.Circle = Circle;
+	Record.CircleIndex = List.Add(Handle);
+	Record.RingSlot = INDEX_NONE;
+	(Circle == ECombatCircle::Inner ? NumInner : NumOuter)++;
+	(Circle == ECombatCircle::Inner ? Pool.InnerRing : Pool.OuterRing).bDirty = true;
+
+	// BB CanAttack depends on inner circle membership
+	if (Circle == ECombatCircle::Inner)
+	{
+		if (AEnemyBase* Enemy = Record.Enemy.Get())
+		{
+			Enemy->SyncBlackboard(EEnemyBlackboardSync::CanAttack);
+		}
+	}
 }
 
-AEnemyBase* UGroupCombatManager::PickNextFromOuterCircle(AActor* Target) const
+void UGroupCombatManager::RemoveFromCircle(int32 Handle)
 {
-	if (OuterCircleEnemies.Num() == 0) return nullptr;
+	FCombatRecord& Record = Records[Handle];
+	if (Record.Circle == ECombatCircle::None) return;
 
-	// Weighted random: closer enemies have higher weight
-	float TotalWeight = 0.0f;
-	TArray<float> Weights;
-	Weights.Reserve(OuterCircleEnemies.Num());
+	FTargetTokenPool& Pool = Pools[Record.Pool];
+	const bool bInner = Record.Circle == ECombatCircle::Inner;
+	TArray<int32>& List = bInner ? Pool.Inner : Pool.Outer;
+	const int32 Index = Record.CircleIndex;
 
-	for (AEnemyBase* E : OuterCircleEnemies)
+	List.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (List.IsValidIndex(Index))
 	{
-		if (!IsValid(E)) { Weights.Add(0.0f); continue; }
+		Records[List[Index]].CircleIndex = Index;
+	}
+	(bInner ? NumInner : NumOuter)--;
+	(bInner ? Pool.InnerRing : Pool.OuterRing).bDirty = true;
+
+	Record.Circle = ECombatCircle::None;
+	Record.CircleIndex = INDEX_NONE;
+	Record.RingSlot = INDEX_NONE;
 
-		// Check cooldown
-		TWeakObjectPtr<AEnemyBase> W(const_cast<AEnemyBase*>(E));
-		if (const float* CD = InnerCooldowns.Find(W))
+	if (bInner)
+	{
+		if (AEnemyBase* Enemy = Record.Enemy.Get())
 		{
-			if (GetWorld()->GetTimeSeconds() < *CD)
-			{
-				Weights.Add(0.0f);
-				continue;
-			}
+			Enemy->SyncBlackboard(EEnemyBlackboardSync::CanAttack);
 		}
+	}
+}
 
-		float Dist = Target ? FVector::Dist(E->GetActorLocation(), Target->GetActorLocation()) : 1000.0f;
-		float Weight = FMath::Max(1.0f, 2000.0f - Dist); // closer = higher weight
-		Weights.Add(Weight);
-		TotalWeight += Weight;
+void UGroupCombatManager::Enqueue(int32 Handle, float ReadyTime)
+{
+	FCombatRecord& Record = Records[Handle];
+	FTargetTokenPool& Pool = Pools[Record.Pool];
+
+	// Closer enemies go first when several become ready at the same time
+	float Priority = 0.0f;
+	const AEnemyBase* Enemy = Record.Enemy.Get();
+	const AActor* Target = Pool.Target.Get();
+	if (Enemy && Target)
+	{
+		Priority = FVector::DistSquared(Enemy->GetActorLocation(), Target->GetActorLocation());
 	}
 
-	if (TotalWeight <= 0.0f) return nullptr;
+	Record.QueueSerial = NextQueueSerial++;
+	Pool.ReadyQueue.HeapPush(FReadyEntry{ ReadyTime, Priority, Handle, Record.QueueSerial }, FReadyEntryPredicate());
+}
+
+void UGroupCombatManager::CancelReservation(int32 Handle)
+{
+	FCombatRecord& Record = Records[Handle];
+	if (Record.ReservedUntil < 0.0f) return;
+
+	// Bounded by MaxInnerCircleEnemies
+	Pools[Record.Pool].Reserved.RemoveSingleSwap(Handle, EAllowShrinking::No);
+	Record.ReservedUntil = -1.0f;
+}
+
+bool UGroupCombatManager::RetreatToOuter(int32 Handle, float Now)
+{
+	FCombatRecord& Record = Records[Handle];
+	if (Record.Circle != ECombatCircle::Inner) return false;
+
+	RemoveFromCircle(Handle);
+	AddToCircle(Handle, ECombatCircle::Outer);
+	Record.CooldownEnd = Now + InnerCircleCooldown;
+	Enqueue(Handle, Record.CooldownEnd);
+	return true;
+}
+
+int32 UGroupCombatManager::PromoteReady(int32 PoolIndex, float Now)
+{
+	FTargetTokenPool& Pool = Pools[PoolIndex];
 
-	float Roll = FMath::FRandRange(0.0f, TotalWeight);
-	float Accum = 0.0f;
-	for (int32 i = 0; i < OuterCircleEnemies.Num(); i++)
+	// Tokens nobody claimed in time go back; the enemy rejoins the end of the line
+	for (int32 i = Pool.Reserved.Num() - 1; i >= 0; --i)
 	{
-		Accum += Weights[i];
-		if (Roll <= Accum)
-			return OuterCircleEnemies[i];
+		const int32 Handle = Pool.Reserved[i];
+		FCombatRecord& Record = Records[Handle];
+		if (Now < Record.ReservedUntil) continue;
+
+		Pool.Reserved.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		Record.ReservedUntil = -1.0f;
+		Enqueue(Handle, Now + ReservationTimeout);
 	}
 
-	return OuterCircleEnemies.Last();
+	int32 FirstPromoted = INDEX_NONE;
+	while (Pool.NumTokensInUse() < MaxInnerCircleEnemies && Pool.ReadyQueue.Num() > 0)
+	{
+		if (Pool.ReadyQueue.HeapTop().ReadyTime > Now) break;
+
+		FReadyEntry Entry;
+		Pool.ReadyQueue.HeapPop(Entry, FReadyEntryPredicate(), EAllowShrinking::No);
+
+		FCombatRecord& Record = Records[Entry.Handle];
+		if (Record.QueueSerial != Entry.Serial) continue;
+		Record.QueueSerial = 0;
+
+		// Destroyed without unregistering: drop it now that it surfaced
+		const AEnemyBase* Enemy = Record.Enemy.Get();
+		if (!Enemy || Enemy->IsDead())
+		{
+			RemoveRecord(Entry.Handle);
+			if (Pool.NumMembers() == 0) break;
+			continue;
+		}
+
+		Record.ReservedUntil = Now + ReservationTimeout;
+		Pool.Reserved.Add(Entry.Handle);
+		if (FirstPromoted == INDEX_NONE)
+		{
+			FirstPromoted = Entry.Handle;
+		}
+	}
+	return FirstPromoted;
+}
+
+bool UGroupCombatManager::ProjectToNavigation(const FVector& Point, FVector& OutLocation) const
+{
+	FNavLocation NavLocation;
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (NavSys && NavSys->ProjectPointToNavigation(Point, NavLocation, RingNavProjectExtent))
+	{
+		OutLocation = NavLocation.Location;
+		return true;
+	}
+	OutLocation = Point;
+	return false;
+}
+
+FVector UGroupCombatManager::ComputeRingPosition(int32 EnemyIndex, int32 TotalOnRing,
+	float MinR, float MaxR, const FVector& Center, int32 Seed) const
+{
+	if (TotalOnRing <= 0) TotalOnRing = 1;
+
+	// Golden-angle distribution for organic spread
+	const float GoldenAngle = 137.508f;
+	float AngleDeg = GoldenAngle * EnemyIndex;
+
+	FRandomStream Rng(Seed + EnemyIndex * 7919);
+	AngleDeg += Rng.FRandRange(-20.0f, 20.0f);
+
+	float AngleRad = FMath::DegreesToRadians(AngleDeg);
+	float Radius = Rng.FRandRange(MinR, MaxR);
+
+	FVector Pos = Center;
+	Pos.X += FMath::Cos(AngleRad) * Radius;
+	Pos.Y += FMath::Sin(AngleRad) * Radius;
+	return Pos;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -111,26 +276,47 @@ AEnemyBase* UGroupCombatManager::PickNextFromOuterCircle(AActor* Target) const
 void UGroupCombatManager::RegisterCombatEnemy(AEnemyBase* Enemy)
 {
 	if (!IsValid(Enemy)) return;
-	CombatEnemies.AddUnique(Enemy);
-	// New enemies go to outer circle by default
-	if (!InnerCircleEnemies.Contains(Enemy))
+	AActor* Target = Enemy->GetCurrentTarget();
+	if (!Target) return;
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	float CooldownEnd = Now;
+
+	int32 Handle = GetHandle(Enemy);
+	if (Handle != INDEX_NONE)
 	{
-		OuterCircleEnemies.AddUnique(Enemy);
+		if (Pools[Records[Handle].Pool].Target.Get() == Target) return;
+
+		// Switched targets: tokens are per target, but the cooldown carries over
+		CooldownEnd = FMath::Max(Now, Records[Handle].CooldownEnd);
+		RemoveRecord(Handle);
 	}
-	UE_LOG(LogTemp, Log, TEXT("GroupCombat: %s registered (outer=%d, inner=%d)"),
-		*Enemy->GetName(), OuterCircleEnemies.Num(), InnerCircleEnemies.Num());
+
+	const int32 PoolIndex = AcquirePool(Target);
+	Handle = FreeHandles.Num() > 0 ? FreeHandles.Pop(EAllowShrinking::No) : Records.AddDefaulted();
+
+	FCombatRecord& Record = Records[Handle];
+	Record.Enemy = Enemy;
+	Record.Pool = PoolIndex;
+	Record.CooldownEnd = CooldownEnd;
+	Enemy->CombatHandle = Handle;
+
+	// New enemies go to outer circle by default
+	AddToCircle(Handle, ECombatCircle::Outer);
+	Enqueue(Handle, CooldownEnd);
+
+	UE_LOG(LogTemp, Log, TEXT("GroupCombat: %s registered on %s (outer=%d, inner=%d)"),
+		*Enemy->GetName(), *Target->GetName(), Pools[PoolIndex].Outer.Num(), Pools[PoolIndex].Inner.Num());
 }
 
 void UGroupCombatManager::UnregisterCombatEnemy(AEnemyBase* Enemy)
 {
-	if (!Enemy) return;
-	CombatEnemies.Remove(Enemy);
-	OuterCircleEnemies.Remove(Enemy);
-	InnerCircleEnemies.Remove(Enemy);
-	TWeakObjectPtr<AEnemyBase> W(Enemy);
-	InnerCooldowns.Remove(W);
+	const int32 Handle = GetHandle(Enemy);
+	if (Handle == INDEX_NONE) return;
+
+	RemoveRecord(Handle);
 	UE_LOG(LogTemp, Log, TEXT("GroupCombat: %s unregistered (outer=%d, inner=%d)"),
-		*Enemy->GetName(), OuterCircleEnemies.Num(), InnerCircleEnemies.Num());
+		*Enemy->GetName(), NumOuter, NumInner);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -139,42 +325,38 @@ void UGroupCombatManager::UnregisterCombatEnemy(AEnemyBase* Enemy)
 
 bool UGroupCombatManager::RequestInnerCircleEntry(AEnemyBase* Enemy)
 {
-	if (!IsValid(Enemy)) return false;
-	PurgeInvalidEnemies();
+	SAIRAN_SCOPE(STAT_Sairan_GroupCombatRequestEntry, GroupCombat);
 
-	// Already inside
-	if (InnerCircleEnemies.Contains(Enemy)) return true;
+	if (!IsValid(Enemy) || Enemy->IsDead()) return false;
 
-	// Check cooldown
-	TWeakObjectPtr<AEnemyBase> W(Enemy);
-	if (const float* CD = InnerCooldowns.Find(W))
-	{
-		if (GetWorld()->GetTimeSeconds() < *CD)
-		{
-			return false;
-		}
-		InnerCooldowns.Remove(W);
-	}
+	const int32 Handle = GetHandle(Enemy);
+	if (Handle == INDEX_NONE) return false;
 
-	// Check space
-	if (InnerCircleEnemies.Num() >= MaxInnerCircleEnemies)
-		return false;
+	// Already inside
+	if (Records[Handle].Circle == ECombatCircle::Inner) return true;
+
+	// Only the enemies at the head of the ready queue hold a token
+	const int32 PoolIndex = Records[Handle].Pool;
+	PromoteReady(PoolIndex, GetWorld()->GetTimeSeconds());
+	if (Records[Handle].ReservedUntil < 0.0f) return false;
 
 	// Grant entry
-	InnerCircleEnemies.AddUnique(Enemy);
-	OuterCircleEnemies.Remove(Enemy);
+	CancelReservation(Handle);
+	RemoveFromCircle(Handle);
+	AddToCircle(Handle, ECombatCircle::Inner);
+
+	// The attack task reads its slot right away; the inner ring is tiny, solve now
+	SolveRing(Pools[PoolIndex], ECombatCircle::Inner);
 
 	UE_LOG(LogTemp, Warning, TEXT("GroupCombat: %s → INNER CIRCLE (%d/%d)"),
-		*Enemy->GetName(), InnerCircleEnemies.Num(), MaxInnerCircleEnemies);
+		*Enemy->GetName(), Pools[PoolIndex].Inner.Num(), MaxInnerCircleEnemies);
 	return true;
 }
 
 AEnemyBase* UGroupCombatManager::OnAttackFinished(AEnemyBase* Enemy, bool bStayInner)
 {
-	if (!IsValid(Enemy)) return nullptr;
-	PurgeInvalidEnemies();
-
-	AEnemyBase* NextAttacker = nullptr;
+	const int32 Handle = GetHandle(Enemy);
+	if (Handle == INDEX_NONE) return nullptr;
 
 	if (bStayInner)
 	{
@@ -184,19 +366,15 @@ AEnemyBase* UGroupCombatManager::OnAttackFinished(AEnemyBase* Enemy, bool bStayI
 	}
 
 	// Retreat to outer circle
-	InnerCircleEnemies.Remove(Enemy);
-	OuterCircleEnemies.AddUnique(Enemy);
-
-	// Set cooldown
-	TWeakObjectPtr<AEnemyBase> W(Enemy);
-	InnerCooldowns.Add(W, GetWorld()->GetTimeSeconds() + InnerCircleCooldown);
+	const float Now = GetWorld()->GetTimeSeconds();
+	if (!RetreatToOuter(Handle, Now)) return nullptr;
 
 	UE_LOG(LogTemp, Log, TEXT("GroupCombat: %s → OUTER CIRCLE (cooldown %.1fs)"),
 		*Enemy->GetName(), InnerCircleCooldown);
 
-	// Pick next attacker from outer circle
-	AActor* Target = Enemy->GetCurrentTarget();
-	NextAttacker = PickNextFromOuterCircle(Target);
+	// Reserve the freed token for the head of the ready queue
+	const int32 NextHandle = PromoteReady(Records[Handle].Pool, Now);
+	AEnemyBase* NextAttacker = (NextHandle != INDEX_NONE) ? Records[NextHandle].Enemy.Get() : nullptr;
 
 	if (NextAttacker)
 	{
@@ -209,29 +387,167 @@ AEnemyBase* UGroupCombatManager::OnAttackFinished(AEnemyBase* Enemy, bool bStayI
 
 void UGroupCombatManager::ForceToOuterCircle(AEnemyBase* Enemy)
 {
-	if (!Enemy) return;
-	if (InnerCircleEnemies.Remove(Enemy) > 0)
+	const int32 Handle = GetHandle(Enemy);
+	if (Handle == INDEX_NONE) return;
+
+	if (RetreatToOuter(Handle, GetWorld()->GetTimeSeconds()))
 	{
-		OuterCircleEnemies.AddUnique(Enemy);
-		TWeakObjectPtr<AEnemyBase> W(Enemy);
-		InnerCooldowns.Add(W, GetWorld()->GetTimeSeconds() + InnerCircleCooldown);
 		UE_LOG(LogTemp, Log, TEXT("GroupCombat: %s forced to outer circle"), *Enemy->GetName());
 	}
 }
 
 bool UGroupCombatManager::IsInInnerCircle(AEnemyBase* Enemy) const
 {
-	return InnerCircleEnemies.Contains(Enemy);
+	const int32 Handle = GetHandle(Enemy);
+	return Handle != INDEX_NONE && Records[Handle].Circle == ECombatCircle::Inner;
 }
 
 bool UGroupCombatManager::IsInOuterCircle(AEnemyBase* Enemy) const
 {
-	return OuterCircleEnemies.Contains(Enemy);
+	const int32 Handle = GetHandle(Enemy);
+	return Handle != INDEX_NONE && Records[Handle].Circle == ECombatCircle::Outer;
 }
 
-bool UGroupCombatManager::HasInnerCircleSpace() const
+bool UGroupCombatManager::HasInnerCircleSpace(AActor* Target) const
 {
-	return InnerCircleEnemies.Num() < MaxInnerCircleEnemies;
+	const int32* PoolIndex = PoolByTarget.Find(Target);
+	return !PoolIndex || Pools[*PoolIndex].NumTokensInUse() < MaxInnerCircleEnemies;
+}
+
+int32 UGroupCombatManager::GetInnerCircleCountForTarget(AActor* Target) const
+{
+	const int32* PoolIndex = PoolByTarget.Find(Target);
+	return PoolIndex ? Pools[*PoolIndex].Inner.Num() : 0;
+}
+
+bool UGroupCombatManager::CanEnemyAttack(AEnemyBase* Enemy) const
+{
+	if (!Enemy) return false;
+	const int32 Handle = GetHandle(Enemy);
+	if (Handle != INDEX_NONE && Records[Handle].ReservedUntil >= 0.0f) return true;
+	return IsInInnerCircle(Enemy) || HasInnerCircleSpace(Enemy->GetCurrentTarget());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// RING SOLVER
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UGroupCombatManager::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_GroupCombatTick, GroupCombat);
+
+	for (FTargetTokenPool& Pool : Pools)
+	{
+		const AActor* Target = Pool.Target.Get();
+		if (!Target || Pool.NumMembers() == 0) continue;
+
+		bool bTargetMoved = false;
+		Pool.TimeSinceSolve += DeltaTime;
+		if (Pool.TimeSinceSolve >= RingSolveInterval)
+		{
+			Pool.TimeSinceSolve = 0.0f;
+			const FVector TargetLocation = Target->GetActorLocation();
+			const float ThresholdSq = FMath::Square(RingResolveDistance);
+			bTargetMoved = FVector::DistSquared2D(TargetLocation, Pool.OuterRing.SolvedCenter) > ThresholdSq ||
+				FVector::DistSquared2D(TargetLocation, Pool.InnerRing.SolvedCenter) > ThresholdSq;
+		}
+
+		if (Pool.OuterRing.bDirty || bTargetMoved)
+		{
+			SolveRing(Pool, ECombatCircle::Outer);
+		}
+		if (Pool.InnerRing.bDirty || bTargetMoved)
+		{
+			SolveRing(Pool, ECombatCircle::Inner);
+		}
+	}
+}
+
+void UGroupCombatManager::SolveRing(FTargetTokenPool& Pool, ECombatCircle Circle)
+{
+	const bool bInner = Circle == ECombatCircle::Inner;
+	FRingLayout& Ring = bInner ? Pool.InnerRing : Pool.OuterRing;
+	const TArray<int32>& Members = bInner ? Pool.Inner : Pool.Outer;
+	const AActor* Target = Pool.Target.Get();
+
+	Ring.bDirty = false;
+	Ring.Slots.Reset();
+	if (!Target || Members.Num() == 0) return;
+
+	const FVector Center = Target->GetActorLocation();
+	Ring.SolvedCenter = Center;
+
+	// Angle of every member around the target; radius is the members' average
+	struct FMemberAngle
+	{
+		int32 Handle;
+		float Angle;
+	};
+	TArray<FMemberAngle, TInlineAllocator<32>> Sorted;
+	Sorted.Reserve(Members.Num());
+
+	float RadiusSum = 0.0f;
+	int32 RadiusCount = 0;
+	for (const int32 Handle : Members)
+	{
+		FVector Offset = FVector::ForwardVector;
+		if (const AEnemyBase* Enemy = Records[Handle].Enemy.Get())
+		{
+			Offset = Enemy->GetActorLocation() - Center;
+			RadiusSum += bInner
+				? 0.5f * (Enemy->CombatConfig.MinAttackPositionDist + Enemy->CombatConfig.MaxAttackPositionDist)
+				: Enemy->CombatConfig.OuterCircleRadius;
+			++RadiusCount;
+		}
+		Sorted.Add({ Handle, FMath::Atan2(Offset.Y, Offset.X) });
+	}
+	if (RadiusCount == 0) return;
+
+	Sorted.Sort([](const FMemberAngle& A, const FMemberAngle& B) { return A.Angle < B.Angle; });
+
+	const int32 Num = Sorted.Num();
+	const float Radius = RadiusSum / RadiusCount;
+	const float Step = 2.0f * PI / Num;
+
+	// In angle order member k takes slot Base + k·Step. The circular mean of
+	// (angle_k - k·Step) is the rotation with the least summed squared travel.
+	float SumSin = 0.0f;
+	float SumCos = 0.0f;
+	for (int32 k = 0; k < Num; ++k)
+	{
+		float Sin, Cos;
+		FMath::SinCos(&Sin, &Cos, Sorted[k].Angle - k * Step);
+		SumSin += Sin;
+		SumCos += Cos;
+	}
+	const float Base = (FMath::IsNearlyZero(SumSin) && FMath::IsNearlyZero(SumCos)) ? 0.0f : FMath::Atan2(SumSin, SumCos);
+
+	const float ToleranceSq = FMath::Square(RingSlotTolerance);
+	Ring.Slots.SetNumUninitialized(Num);
+	for (int32 k = 0; k < Num; ++k)
+	{
+		float Sin, Cos;
+		FMath::SinCos(&Sin, &Cos, Base + k * Step);
+		ProjectToNavigation(Center + FVector(Cos * Radius, Sin * Radius, 0.0f), Ring.Slots[k]);
+
+		FCombatRecord& Record = Records[Sorted[k].Handle];
+		if (Record.RingSlot == INDEX_NONE || FVector::DistSquared2D(Record.RingLocation, Ring.Slots[k]) > ToleranceSq)
+		{
+			Record.RingLocation = Ring.Slots[k];
+			Record.RingVersion = NextRingVersion++;
+		}
+		Record.RingSlot = k;
+	}
+}
+
+bool UGroupCombatManager::GetAssignedRingSlot(const AEnemyBase* Enemy, FVector& OutLocation, uint32& OutVersion) const
+{
+	const int32 Handle = GetHandle(Enemy);
+	if (Handle == INDEX_NONE || Records[Handle].RingSlot == INDEX_NONE) return false;
+
+	OutLocation = Records[Handle].RingLocation;
+	OutVersion = Records[Handle].RingVersion;
+	return true;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -240,18 +556,33 @@ bool UGroupCombatManager::HasInnerCircleSpace() const
 
 FVector UGroupCombatManager::GetOuterCirclePosition(AEnemyBase* Enemy, AActor* Target) const
 {
+	SAIRAN_SCOPE(STAT_Sairan_GroupCombatOuterPosition, GroupCombat);
+
 	if (!IsValid(Enemy) || !IsValid(Target))
 		return Enemy ? Enemy->GetActorLocation() : FVector::ZeroVector;
 
-	int32 Idx = OuterCircleEnemies.IndexOfByKey(Enemy);
-	if (Idx == INDEX_NONE) Idx = CombatEnemies.IndexOfByKey(Enemy);
-	if (Idx == INDEX_NONE) Idx = 0;
+	int32 Idx = 0;
+	int32 NumOnRing = 1;
+	const int32 Handle = GetHandle(Enemy);
+	if (Handle != INDEX_NONE)
+	{
+		const FCombatRecord& Record = Records[Handle];
+		if (Record.Circle == ECombatCircle::Outer && Record.RingSlot != INDEX_NONE &&
+			Pools[Record.Pool].Target.Get() == Target)
+		{
+			return Record.RingLocation;
+		}
+
+		// Not solved yet (joined this frame): deterministic point until the next solve
+		Idx = (Record.Circle == ECombatCircle::Outer) ? Record.CircleIndex : 0;
+		NumOnRing = FMath::Max(1, Pools[Record.Pool].Outer.Num());
+	}
 
 	float Radius = Enemy->CombatConfig.OuterCircleRadius;
 	float Var = Enemy->CombatConfig.OuterCircleVariation;
 
 	int32 Seed = Enemy->GetUniqueID();
-	FVector Pos = ComputeRingPosition(Idx, FMath::Max(1, OuterCircleEnemies.Num()),
+	FVector Pos = ComputeRingPosition(Idx, NumOnRing,
 		Radius - Var, Radius + Var, Target->GetActorLocation(), Seed);
 	Pos.Z = Enemy->GetActorLocation().Z;
 	return Pos;
@@ -259,9 +590,22 @@ FVector UGroupCombatManager::GetOuterCirclePosition(AEnemyBase* Enemy, AActor* T
 
 FVector UGroupCombatManager::GetInnerCircleAttackPosition(AEnemyBase* Enemy, AActor* Target) const
 {
+	SAIRAN_SCOPE(STAT_Sairan_GroupCombatInnerPosition, GroupCombat);
+
 	if (!IsValid(Enemy) || !IsValid(Target))
 		return Enemy ? Enemy->GetActorLocation() : FVector::ZeroVector;
 
+	const int32 Handle = GetHandle(Enemy);
+	if (Handle != INDEX_NONE)
+	{
+		const FCombatRecord& Record = Records[Handle];
+		if (Record.Circle == ECombatCircle::Inner && Record.RingSlot != INDEX_NONE &&
+			Pools[Record.Pool].Target.Get() == Target)
+		{
+			return Record.RingLocation;
+		}
+	}
+
 	float MinDist = Enemy->CombatConfig.MinAttackPositionDist;
 	float MaxDist = Enemy->CombatConfig.MaxAttackPositionDist;
 
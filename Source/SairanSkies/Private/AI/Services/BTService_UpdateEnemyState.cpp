@@ -1,72 +1,29 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "AI/Services/BTService_UpdateEnemyState.h"
-#include "Enemies/EnemyBase.h"
 #include "AI/EnemyAIController.h"
-#include "AI/GroupCombatManager.h"
-#include "BehaviorTree/BlackboardComponent.h"
-#include "Kismet/GameplayStatics.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
 
 UBTService_UpdateEnemyState::UBTService_UpdateEnemyState()
 {
 	NodeName = TEXT("Update Enemy State");
-	Interval = 0.25f;
-	RandomDeviation = 0.05f;
+
+	// Change-driven: values are pushed by the enemy, nothing to tick
+	bNotifyTick = false;
+	bNotifyBecomeRelevant = true;
 }
 
-void UBTService_UpdateEnemyState::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+void UBTService_UpdateEnemyState::OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
-	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
-
-	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
-	if (!AIController)
-	{
-		return;
-	}
-
-	AEnemyBase* Enemy = AIController->GetControlledEnemy();
-	if (!Enemy)
-	{
-		return;
-	}
-
-	UBlackboardComponent* BlackboardComp = OwnerComp.GetBlackboardComponent();
-	if (!BlackboardComp)
-	{
-		return;
-	}
-
-	// Update target info
-	BlackboardComp->SetValueAsObject(AEnemyBase::BB_TargetActor, Enemy->GetCurrentTarget());
-	
-	// Only update TargetLocation if we have a target (don't overwrite patrol points!)
-	if (Enemy->GetCurrentTarget())
-	{
-		BlackboardComp->SetValueAsVector(AEnemyBase::BB_TargetLocation, Enemy->GetLastKnownTargetLocation());
-	}
-	
-	// Update state values
-	BlackboardComp->SetValueAsInt(AEnemyBase::BB_EnemyState, static_cast<int32>(Enemy->GetEnemyState()));
-	BlackboardComp->SetValueAsBool(AEnemyBase::BB_CanSeeTarget, Enemy->CanSeeTarget());
-	BlackboardComp->SetValueAsFloat(AEnemyBase::BB_DistanceToTarget, Enemy->GetDistanceToTarget());
-
-	// Update proximity priorities in GroupCombatManager (if target exists)
-	if (UGroupCombatManager* CombatManager = GetWorld()->GetSubsystem<UGroupCombatManager>())
-	{
-		// Update MaxInnerCircleEnemies from config
-		CombatManager->MaxInnerCircleEnemies = Enemy->CombatConfig.MaxSimultaneousAttackers;
-	}
+	Super::OnBecomeRelevant(OwnerComp, NodeMemory);
 
-	// CanAttack = enemy is in inner circle (or has space) AND attack cooldown is ready
-	bool bCanAttack = Enemy->CanAttackNow();
-	if (UGroupCombatManager* CombatManager = GetWorld()->GetSubsystem<UGroupCombatManager>())
+	if (AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner()))
 	{
-		bCanAttack = bCanAttack && CombatManager->IsInInnerCircle(Enemy);
+		AIController->SyncBlackboard(EEnemyBlackboardSync::All);
 	}
-	BlackboardComp->SetValueAsBool(AEnemyBase::BB_CanAttack, bCanAttack);
 }
 
 FString UBTService_UpdateEnemyState::GetStaticDescription() const
 {
-	return TEXT("Updates enemy state values in Blackboard");
+	return TEXT("Resyncs enemy state values in Blackboard (updates are change-driven)");
 }
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "AI/Tasks/BTTask_AttackTarget.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
 #include "AI/EnemyAIController.h"
 #include "AI/GroupCombatManager.h"
@@ -11,11 +12,28 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Sound/SoundBase.h"
 
+DECLARE_CYCLE_STAT(TEXT("BT Attack Target Execute"), STAT_Sairan_BTAttackTargetExecute, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("BT Attack Target Tick"), STAT_Sairan_BTAttackTargetTick, STATGROUP_SairanAI);
+
 UBTTask_AttackTarget::UBTTask_AttackTarget()
 {
 	NodeName = TEXT("Attack Target");
 	bNotifyTick = true;
-	bCreateNodeInstance = true;
+}
+
+uint16 UBTTask_AttackTarget::GetInstanceMemorySize() const
+{
+	return sizeof(FBTAttackTargetMemory);
+}
+
+void UBTTask_AttackTarget::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTAttackTargetMemory>(NodeMemory, InitType);
+}
+
+void UBTTask_AttackTarget::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTAttackTargetMemory>(NodeMemory, CleanupType);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -29,20 +47,20 @@ UBTTask_AttackTarget::UBTTask_AttackTarget()
 //   where idealT(i) = i / (N-1) for N>1
 // ═══════════════════════════════════════════════════════════════════════════
 
-void UBTTask_AttackTarget::PickComboByDistance(AEnemyBase* Enemy)
+void UBTTask_AttackTarget::PickComboByDistance(FBTAttackTargetMemory& Memory, AEnemyBase* Enemy) const
 {
 	int32 NumMontages = Enemy->AnimationConfig.AttackMontages.Num();
 	if (NumMontages <= 0)
 	{
 		// No montages — 1 debug hit
-		TotalHits = 1;
-		ChosenComboIndex = 0;
+		Memory.TotalHits = 1;
+		Memory.ChosenComboIndex = 0;
 		return;
 	}
 	if (NumMontages == 1)
 	{
-		TotalHits = 1;
-		ChosenComboIndex = 0;
+		Memory.TotalHits = 1;
+		Memory.ChosenComboIndex = 0;
 		return;
 	}
 
@@ -75,13 +93,13 @@ void UBTTask_AttackTarget::PickComboByDistance(AEnemyBase* Enemy)
 	// Weighted random selection
 	float Roll = FMath::FRandRange(0.0f, TotalWeight);
 	float Accum = 0.0f;
-	ChosenComboIndex = 0;
+	Memory.ChosenComboIndex = 0;
 	for (int32 i = 0; i < NumMontages; i++)
 	{
 		Accum += Weights[i];
 		if (Roll <= Accum)
 		{
-			ChosenComboIndex = i;
+			Memory.ChosenComboIndex = i;
 			break;
 		}
 	}
@@ -91,16 +109,16 @@ void UBTTask_AttackTarget::PickComboByDistance(AEnemyBase* Enemy)
 	float CloseWeight = 1.0f - T;
 	int32 MaxHits = FMath::Max(1, NumMontages);
 	float MeanHits = FMath::Lerp(1.0f, (float)MaxHits, CloseWeight);
-	TotalHits = FMath::Clamp(FMath::RoundToInt32(MeanHits + FMath::RandRange(-0.5f, 0.5f)), 1, MaxHits);
+	Memory.TotalHits = FMath::Clamp(FMath::RoundToInt32(MeanHits + FMath::RandRange(-0.5f, 0.5f)), 1, MaxHits);
 
 	UE_LOG(LogTemp, Log, TEXT("Attack: %s combo[%d] (%d hits) | dist=%.0f T=%.2f weights=[%s]"),
-		*Enemy->GetName(), ChosenComboIndex, TotalHits, Dist, T,
+		*Enemy->GetName(), Memory.ChosenComboIndex, Memory.TotalHits, Dist, T,
 		*FString::JoinBy(Weights, TEXT(","), [](float W) { return FString::Printf(TEXT("%.2f"), W); }));
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
 
-void UBTTask_AttackTarget::ApplyDamage(AEnemyBase* Enemy, AActor* Target)
+void UBTTask_AttackTarget::ApplyDamage(AEnemyBase* Enemy, AActor* Target) const
 {
 	if (!Enemy || !Target) return;
 
@@ -113,32 +131,32 @@ void UBTTask_AttackTarget::ApplyDamage(AEnemyBase* Enemy, AActor* Target)
 	UGameplayStatics::ApplyDamage(Target, Dmg, Enemy->GetController(), Enemy, UDamageType::StaticClass());
 }
 
-void UBTTask_AttackTarget::ApplyDebugRotation(AEnemyBase* Enemy, bool bRestore)
+void UBTTask_AttackTarget::ApplyDebugRotation(FBTAttackTargetMemory& Memory, AEnemyBase* Enemy, bool bRestore) const
 {
 	if (bRestore)
 	{
-		Enemy->SetActorRotation(OriginalRotation);
+		Enemy->SetActorRotation(Memory.OriginalRotation);
 		return;
 	}
 
-	OriginalRotation = Enemy->GetActorRotation();
-	float Sign = (CurrentHit % 2 == 0) ? 1.0f : -1.0f;
+	Memory.OriginalRotation = Enemy->GetActorRotation();
+	float Sign = (Memory.CurrentHit % 2 == 0) ? 1.0f : -1.0f;
 	FRotator Offset(0.0f, DebugRotationDegrees * Sign, 0.0f);
-	Enemy->SetActorRotation(OriginalRotation + Offset);
+	Enemy->SetActorRotation(Memory.OriginalRotation + Offset);
 }
 
-void UBTTask_AttackTarget::Cleanup(UBehaviorTreeComponent& OwnerComp, AEnemyBase* Enemy)
+void UBTTask_AttackTarget::Cleanup(FBTAttackTargetMemory& Memory, UBehaviorTreeComponent& OwnerComp, AEnemyBase* Enemy) const
 {
 	if (!Enemy) return;
 
-	ApplyDebugRotation(Enemy, true);
+	ApplyDebugRotation(Memory, Enemy, true);
 
 	// Restore orient to movement
 	if (auto* CMC = Enemy->GetCharacterMovement())
 		CMC->bOrientRotationToMovement = true;
 
 	// Decide: stay in inner circle or retreat to outer
-	auto* Mgr = GetWorld()->GetSubsystem<UGroupCombatManager>();
+	auto* Mgr = Enemy->GetWorld()->GetSubsystem<UGroupCombatManager>();
 	if (Mgr)
 	{
 		bool bStay = FMath::FRand() < Enemy->CombatConfig.ChanceToStayInnerAfterAttack;
@@ -167,6 +185,10 @@ void UBTTask_AttackTarget::Cleanup(UBehaviorTreeComponent& OwnerComp, AEnemyBase
 
 EBTNodeResult::Type UBTTask_AttackTarget::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTAttackTargetExecute, BehaviorTree);
+
+	FBTAttackTargetMemory& Memory = *CastInstanceNodeMemory<FBTAttackTargetMemory>(NodeMemory);
+
 	AEnemyAIController* AIC = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIC) return EBTNodeResult::Failed;
 
@@ -177,10 +199,10 @@ EBTNodeResult::Type UBTTask_AttackTarget::ExecuteTask(UBehaviorTreeComponent& Ow
 	if (!Target) return EBTNodeResult::Failed;
 
 	// Reset state
-	CurrentHit = 0;
-	TotalHits = 1;
-	ChosenComboIndex = 0;
-	PhaseTimer = 0.0f;
+	Memory.CurrentHit = 0;
+	Memory.TotalHits = 1;
+	Memory.ChosenComboIndex = 0;
+	Memory.PhaseTimer = 0.0f;
 
 	// Disable auto-orient — we control rotation manually
 	if (auto* CMC = Enemy->GetCharacterMovement())
@@ -189,17 +211,17 @@ EBTNodeResult::Type UBTTask_AttackTarget::ExecuteTask(UBehaviorTreeComponent& Ow
 	Enemy->SetEnemyState(EEnemyState::Attacking);
 
 	// Pick a random attack position within the attack range
-	auto* Mgr = GetWorld()->GetSubsystem<UGroupCombatManager>();
+	auto* Mgr = Enemy->GetWorld()->GetSubsystem<UGroupCombatManager>();
 	if (Mgr)
 	{
-		AttackPosition = Mgr->GetInnerCircleAttackPosition(Enemy, Target);
+		Memory.AttackPosition = Mgr->GetInnerCircleAttackPosition(Enemy, Target);
 	}
 	else
 	{
 		// Fallback: position in front of target
 		FVector Dir = (Enemy->GetActorLocation() - Target->GetActorLocation()).GetSafeNormal2D();
 		float Dist = FMath::RandRange(Enemy->CombatConfig.MinAttackPositionDist, Enemy->CombatConfig.MaxAttackPositionDist);
-		AttackPosition = Target->GetActorLocation() + Dir * Dist;
+		Memory.AttackPosition = Target->GetActorLocation() + Dir * Dist;
 	}
 
 	// Check if already in attack range
@@ -208,22 +230,22 @@ EBTNodeResult::Type UBTTask_AttackTarget::ExecuteTask(UBehaviorTreeComponent& Ow
 	{
 		// Already in range — backstep telegraph, then attack
 		Enemy->Attack(); // Start cooldown
-		PickComboByDistance(Enemy);
+		PickComboByDistance(Memory, Enemy);
 
-		Phase = EAttackPhase::Backstep;
-		PhaseTimer = 0.0f;
+		Memory.Phase = EAttackPhase::Backstep;
+		Memory.PhaseTimer = 0.0f;
 		AIC->StopMovement();
 
 		UE_LOG(LogTemp, Warning, TEXT("=== ATTACK START: %s → %s | combo[%d] %d hits | dist=%.0f ==="),
-			*Enemy->GetName(), *Target->GetName(), ChosenComboIndex, TotalHits, DistToTarget);
+			*Enemy->GetName(), *Target->GetName(), Memory.ChosenComboIndex, Memory.TotalHits, DistToTarget);
 	}
 	else
 	{
 		// Need to close the gap from outer circle → attack range
-		Phase = EAttackPhase::Approach;
-		PhaseTimer = 0.0f;
+		Memory.Phase = EAttackPhase::Approach;
+		Memory.PhaseTimer = 0.0f;
 		Enemy->SetMovementSpeed(0.5f); // Moderate approach speed
-		AIC->MoveToActor(Target, Enemy->CombatConfig.MinAttackPositionDist);
+		AIC->QueueMoveToActor(Target, Enemy->CombatConfig.MinAttackPositionDist);
 
 		UE_LOG(LogTemp, Log, TEXT("Attack: %s acercándose a posición de ataque (dist=%.0f)"),
 			*Enemy->GetName(), DistToTarget);
@@ -238,6 +260,10 @@ EBTNodeResult::Type UBTTask_AttackTarget::ExecuteTask(UBehaviorTreeComponent& Ow
 
 void UBTTask_AttackTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTAttackTargetTick, BehaviorTree);
+
+	FBTAttackTargetMemory& Memory = *CastInstanceNodeMemory<FBTAttackTargetMemory>(NodeMemory);
+
 	AEnemyAIController* AIC = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIC) { FinishLatentTask(OwnerComp, EBTNodeResult::Failed); return; }
 
@@ -247,15 +273,15 @@ void UBTTask_AttackTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* No
 	AActor* Target = Enemy->GetCurrentTarget();
 	if (!Target)
 	{
-		Cleanup(OwnerComp, Enemy);
+		Cleanup(Memory, OwnerComp, Enemy);
 		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
 		return;
 	}
 
-	PhaseTimer += DeltaSeconds;
+	Memory.PhaseTimer += DeltaSeconds;
 
 	// Rotar suavemente hacia el target (excepto durante Strike)
-	if (Phase != EAttackPhase::Strike)
+	if (Memory.Phase != EAttackPhase::Strike)
 	{
 		FVector Dir = (Target->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal();
 		FRotator Look = Dir.Rotation();
@@ -265,7 +291,7 @@ void UBTTask_AttackTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* No
 		Enemy->SetActorRotation(FMath::RInterpTo(Cur, Look, DeltaSeconds, 8.0f));
 	}
 
-	switch (Phase)
+	switch (Memory.Phase)
 	{
 	// ═══════════════════════════════════════════════════════════════════
 	// APPROACH — close the gap from outer circle to attack range
@@ -278,35 +304,43 @@ void UBTTask_AttackTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* No
 		{
 			AIC->StopMovement();
 			Enemy->Attack(); // Start cooldown
-			PickComboByDistance(Enemy);
+			PickComboByDistance(Memory, Enemy);
 
 			// Backstep first — telegraphs the hit to the player
-			Phase = EAttackPhase::Backstep;
-			PhaseTimer = 0.0f;
+			Memory.Phase = EAttackPhase::Backstep;
+			Memory.PhaseTimer = 0.0f;
 
 			// Play warning sound
 			if (WindUpWarningSound)
 			{
-				UGameplayStatics::PlaySoundAtLocation(GetWorld(), WindUpWarningSound, Enemy->GetActorLocation());
+				UGameplayStatics::PlaySoundAtLocation(Enemy->GetWorld(), WindUpWarningSound, Enemy->GetActorLocation());
 			}
 
 			UE_LOG(LogTemp, Warning, TEXT("=== ATTACK START: %s → %s | combo[%d] %d hits | dist=%.0f ==="),
-				*Enemy->GetName(), *Target->GetName(), ChosenComboIndex, TotalHits, Dist);
+				*Enemy->GetName(), *Target->GetName(), Memory.ChosenComboIndex, Memory.TotalHits, Dist);
 			break;
 		}
 
-		// Re-request movement if stuck
+		if (AIC->HasQueuedMoveFailed())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Attack: %s no path to target (dist=%.0f)"), *Enemy->GetName(), Dist);
+			Cleanup(Memory, OwnerComp, Enemy);
+			FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
+			return;
+		}
+
+		// Re-request movement if stuck (not while the queued path is still coming)
 		EPathFollowingStatus::Type Status = AIC->GetMoveStatus();
-		if (Status == EPathFollowingStatus::Idle || Status == EPathFollowingStatus::Waiting)
+		if (!AIC->IsMoveQueued() && (Status == EPathFollowingStatus::Idle || Status == EPathFollowingStatus::Waiting))
 		{
-			AIC->MoveToActor(Target, Enemy->CombatConfig.MinAttackPositionDist);
+			AIC->QueueMoveToActor(Target, Enemy->CombatConfig.MinAttackPositionDist);
 		}
 
 		// Timeout
-		if (PhaseTimer >= MaxApproachTime)
+		if (Memory.PhaseTimer >= MaxApproachTime)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("Attack: %s approach timeout (dist=%.0f)"), *Enemy->GetName(), Dist);
-			Cleanup(OwnerComp, Enemy);
+			Cleanup(Memory, OwnerComp, Enemy);
 			FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
 		}
 		break;
@@ -325,10 +359,10 @@ void UBTTask_AttackTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* No
 			Enemy->SetActorLocation(Enemy->GetActorLocation() + AwayDir * StepThisFrame);
 		}
 
-		if (PhaseTimer >= BackstepDuration)
+		if (Memory.PhaseTimer >= BackstepDuration)
 		{
-			PhaseTimer = 0.0f;
-			Phase = EAttackPhase::WindUp;
+			Memory.PhaseTimer = 0.0f;
+			Memory.Phase = EAttackPhase::WindUp;
 		}
 		break;
 	}
@@ -338,29 +372,29 @@ void UBTTask_AttackTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* No
 	// ═══════════════════════════════════════════════════════════════════
 	case EAttackPhase::WindUp:
 	{
-		if (PhaseTimer >= WindUpDuration)
+		if (Memory.PhaseTimer >= WindUpDuration)
 		{
-			PhaseTimer = 0.0f;
-			Phase = EAttackPhase::Strike;
-			CurrentHit++;
+			Memory.PhaseTimer = 0.0f;
+			Memory.Phase = EAttackPhase::Strike;
+			Memory.CurrentHit++;
 
-			StrikeStartLocation = Enemy->GetActorLocation();
+			Memory.StrikeStartLocation = Enemy->GetActorLocation();
 
 			// Debug rotation
-			ApplyDebugRotation(Enemy, false);
+			ApplyDebugRotation(Memory, Enemy, false);
 
 			// Debug lunge towards target
 			if (DebugLungeDistance > 0.0f)
 			{
 				FVector ToTarget = (Target->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal2D();
-				Enemy->SetActorLocation(StrikeStartLocation + ToTarget * DebugLungeDistance);
+				Enemy->SetActorLocation(Memory.StrikeStartLocation + ToTarget * DebugLungeDistance);
 			}
 
 			// Apply damage
 			ApplyDamage(Enemy, Target);
 
 			// Play montage if available
-			int32 MontageIdx = (ChosenComboIndex + CurrentHit - 1) % FMath::Max(1, Enemy->AnimationConfig.AttackMontages.Num());
+			int32 MontageIdx = (Memory.ChosenComboIndex + Memory.CurrentHit - 1) % FMath::Max(1, Enemy->AnimationConfig.AttackMontages.Num());
 			if (Enemy->AnimationConfig.AttackMontages.IsValidIndex(MontageIdx))
 			{
 				UAnimMontage* M = Enemy->AnimationConfig.AttackMontages[MontageIdx];
@@ -368,8 +402,8 @@ void UBTTask_AttackTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* No
 			}
 
 			UE_LOG(LogTemp, Log, TEXT("Attack: %s GOLPE %d/%d (combo[%d] rot %s%.0f° lunge %.0f)"),
-				*Enemy->GetName(), CurrentHit, TotalHits, ChosenComboIndex,
-				(CurrentHit % 2 == 0) ? TEXT("+") : TEXT("-"),
+				*Enemy->GetName(), Memory.CurrentHit, Memory.TotalHits, Memory.ChosenComboIndex,
+				(Memory.CurrentHit % 2 == 0) ? TEXT("+") : TEXT("-"),
 				DebugRotationDegrees, DebugLungeDistance);
 		}
 		break;
@@ -383,20 +417,20 @@ void UBTTask_AttackTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* No
 		// Interpolate back to original position during strike
 		if (DebugLungeDistance > 0.0f)
 		{
-			float Alpha = FMath::Clamp(PhaseTimer / StrikeDuration, 0.0f, 1.0f);
+			float Alpha = FMath::Clamp(Memory.PhaseTimer / StrikeDuration, 0.0f, 1.0f);
 			FVector Current = Enemy->GetActorLocation();
-			FVector BackPos = FMath::Lerp(Current, StrikeStartLocation, Alpha * 0.5f);
+			FVector BackPos = FMath::Lerp(Current, Memory.StrikeStartLocation, Alpha * 0.5f);
 			Enemy->SetActorLocation(BackPos);
 		}
 
-		if (PhaseTimer >= StrikeDuration)
+		if (Memory.PhaseTimer >= StrikeDuration)
 		{
-			PhaseTimer = 0.0f;
-			Phase = EAttackPhase::Recovery;
+			Memory.PhaseTimer = 0.0f;
+			Memory.Phase = EAttackPhase::Recovery;
 
 			// Restore position and rotation
-			Enemy->SetActorLocation(StrikeStartLocation);
-			ApplyDebugRotation(Enemy, true);
+			Enemy->SetActorLocation(Memory.StrikeStartLocation);
+			ApplyDebugRotation(Memory, Enemy, true);
 		}
 		break;
 	}
@@ -406,10 +440,10 @@ void UBTTask_AttackTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* No
 	// ═══════════════════════════════════════════════════════════════════
 	case EAttackPhase::Recovery:
 	{
-		if (PhaseTimer >= RecoveryDuration)
+		if (Memory.PhaseTimer >= RecoveryDuration)
 		{
-			PhaseTimer = 0.0f;
-			Phase = (CurrentHit < TotalHits) ? EAttackPhase::ComboGap : EAttackPhase::Finished;
+			Memory.PhaseTimer = 0.0f;
+			Memory.Phase = (Memory.CurrentHit < Memory.TotalHits) ? EAttackPhase::ComboGap : EAttackPhase::Finished;
 		}
 		break;
 	}
@@ -419,10 +453,10 @@ void UBTTask_AttackTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* No
 	// ═══════════════════════════════════════════════════════════════════
 	case EAttackPhase::ComboGap:
 	{
-		if (PhaseTimer >= ComboGapDuration)
+		if (Memory.PhaseTimer >= ComboGapDuration)
 		{
-			PhaseTimer = 0.0f;
-			Phase = EAttackPhase::WindUp;
+			Memory.PhaseTimer = 0.0f;
+			Memory.Phase = EAttackPhase::WindUp;
 		}
 		break;
 	}
@@ -433,15 +467,15 @@ void UBTTask_AttackTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* No
 	case EAttackPhase::Finished:
 	{
 		UE_LOG(LogTemp, Warning, TEXT("=== ATTACK END: %s — %d golpes (combo[%d]) ==="),
-			*Enemy->GetName(), CurrentHit, ChosenComboIndex);
+			*Enemy->GetName(), Memory.CurrentHit, Memory.ChosenComboIndex);
 
-		Cleanup(OwnerComp, Enemy);
+		Cleanup(Memory, OwnerComp, Enemy);
 		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 		break;
 	}
 
 	default:
-		Cleanup(OwnerComp, Enemy);
+		Cleanup(Memory, OwnerComp, Enemy);
 		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
 		break;
 	}
@@ -1,21 +1,94 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "AI/Tasks/BTTask_ChaseTarget.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
 #include "AI/EnemyAIController.h"
+#include "AI/EnemyFlowFieldManager.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "Navigation/PathFollowingComponent.h"
 #include "AIController.h"
 
+DECLARE_CYCLE_STAT(TEXT("BT Chase Target Execute"), STAT_Sairan_BTChaseTargetExecute, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("BT Chase Target Tick"), STAT_Sairan_BTChaseTargetTick, STATGROUP_SairanAI);
+
 UBTTask_ChaseTarget::UBTTask_ChaseTarget()
 {
 	NodeName = TEXT("Chase Target");
 	bNotifyTick = true;
-	bCreateNodeInstance = true;
+}
+
+uint16 UBTTask_ChaseTarget::GetInstanceMemorySize() const
+{
+	return sizeof(FBTChaseTargetMemory);
+}
+
+void UBTTask_ChaseTarget::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTChaseTargetMemory>(NodeMemory, InitType);
+}
+
+void UBTTask_ChaseTarget::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTChaseTargetMemory>(NodeMemory, CleanupType);
+}
+
+bool UBTTask_ChaseTarget::StepFlowField(FBTChaseTargetMemory& Memory, AEnemyAIController* AIController, AEnemyBase* Enemy, AActor* Target, float DeltaSeconds) const
+{
+	if (Memory.FlowFieldCooldown > 0.0f)
+	{
+		Memory.FlowFieldCooldown -= DeltaSeconds;
+		return false;
+	}
+
+	UEnemyFlowFieldManager* FlowField = bUseFlowField ? Enemy->GetWorld()->GetSubsystem<UEnemyFlowFieldManager>() : nullptr;
+
+	FVector Direction;
+	if (!FlowField || !FlowField->GetFlowDirection(Target, Enemy->GetActorLocation(), Direction))
+	{
+		return false;
+	}
+
+	if (!Memory.bFollowingFlowField)
+	{
+		// Drop the individual path: the field replaces it
+		AIController->StopMovement();
+		Memory.bFollowingFlowField = true;
+		Memory.BestDistance = Enemy->GetDistanceToTarget();
+		Memory.StalledTime = 0.0f;
+	}
+	else
+	{
+		// Stuck against something the field doesn't know about: hand over to a real path for a while
+		const float Distance = Enemy->GetDistanceToTarget();
+		if (Distance < Memory.BestDistance - MinProgressDistance)
+		{
+			Memory.BestDistance = Distance;
+			Memory.StalledTime = 0.0f;
+		}
+		else
+		{
+			Memory.StalledTime += DeltaSeconds;
+			if (Memory.StalledTime >= StallTimeout)
+			{
+				UE_LOG(LogTemp, Log, TEXT("Chase: %s sin progreso en el flow field (dist=%.0f), usando path %.1fs"),
+					*Enemy->GetName(), Distance, FlowFieldRetryDelay);
+				Memory.FlowFieldCooldown = FlowFieldRetryDelay;
+				return false;
+			}
+		}
+	}
+	Enemy->AddMovementInput(Direction, 1.0f, false);
+	return true;
 }
 
 EBTNodeResult::Type UBTTask_ChaseTarget::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTChaseTargetExecute, BehaviorTree);
+
+	FBTChaseTargetMemory& Memory = *CastInstanceNodeMemory<FBTChaseTargetMemory>(NodeMemory);
+	Memory = FBTChaseTargetMemory();
+
 	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIController) return EBTNodeResult::Failed;
 
@@ -28,15 +101,6 @@ EBTNodeResult::Type UBTTask_ChaseTarget::ExecuteTask(UBehaviorTreeComponent& Own
 	Enemy->SetChaseSpeed();
 	Enemy->SetEnemyState(EEnemyState::Chasing);
 
-	// Chase until we reach the OUTER CIRCLE radius
-	float AcceptanceRadius = Enemy->CombatConfig.OuterCircleRadius - 50.0f;
-
-	EPathFollowingRequestResult::Type Result = AIController->MoveToActor(Target, AcceptanceRadius);
-	if (Result == EPathFollowingRequestResult::Failed)
-	{
-		return EBTNodeResult::Failed;
-	}
-
 	// If already in range, succeed immediately
 	float Dist = Enemy->GetDistanceToTarget();
 	if (Dist <= Enemy->CombatConfig.OuterCircleRadius)
@@ -46,6 +110,18 @@ EBTNodeResult::Type UBTTask_ChaseTarget::ExecuteTask(UBehaviorTreeComponent& Own
 		return EBTNodeResult::Succeeded;
 	}
 
+	// Chase until we reach the OUTER CIRCLE radius (shared flow field if we're inside one)
+	if (!StepFlowField(Memory, AIController, Enemy, Target, 0.0f))
+	{
+		float AcceptanceRadius = Enemy->CombatConfig.OuterCircleRadius - 50.0f;
+
+		EPathFollowingRequestResult::Type Result = AIController->QueueMoveToActor(Target, AcceptanceRadius);
+		if (Result == EPathFollowingRequestResult::Failed)
+		{
+			return EBTNodeResult::Failed;
+		}
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("Chase: %s persiguiendo a %s (dist=%.0f, objetivo=%.0f)"),
 		*Enemy->GetName(), *Target->GetName(), Dist, Enemy->CombatConfig.OuterCircleRadius);
 
@@ -54,6 +130,10 @@ EBTNodeResult::Type UBTTask_ChaseTarget::ExecuteTask(UBehaviorTreeComponent& Own
 
 void UBTTask_ChaseTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTChaseTargetTick, BehaviorTree);
+
+	FBTChaseTargetMemory& Memory = *CastInstanceNodeMemory<FBTChaseTargetMemory>(NodeMemory);
+
 	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIController) { FinishLatentTask(OwnerComp, EBTNodeResult::Failed); return; }
 
@@ -79,12 +159,20 @@ void UBTTask_ChaseTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* Nod
 		return;
 	}
 
-	// Re-request movement if stopped
+	// Shared flow field: one lookup, no path of our own
+	if (StepFlowField(Memory, AIController, Enemy, Target, DeltaSeconds))
+	{
+		return;
+	}
+
+	// Re-request movement if stopped (or we just left / stalled on the flow field); a queued path is on its way
 	EPathFollowingStatus::Type MoveStatus = AIController->GetMoveStatus();
-	if (MoveStatus == EPathFollowingStatus::Idle || MoveStatus == EPathFollowingStatus::Waiting)
+	if (Memory.bFollowingFlowField ||
+		(!AIController->IsMoveQueued() && (MoveStatus == EPathFollowingStatus::Idle || MoveStatus == EPathFollowingStatus::Waiting)))
 	{
+		Memory.bFollowingFlowField = false;
 		float AcceptanceRadius = Enemy->CombatConfig.OuterCircleRadius - 50.0f;
-		AIController->MoveToActor(Target, AcceptanceRadius);
+		AIController->QueueMoveToActor(Target, AcceptanceRadius);
 	}
 }
 
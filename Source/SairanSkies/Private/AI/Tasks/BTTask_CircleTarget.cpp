@@ -1,6 +1,7 @@
 // SairanSkies - BT Task: Circle Target — Intelligent flanking with feints
 
 #include "AI/Tasks/BTTask_CircleTarget.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
 #include "AI/EnemyAIController.h"
 #include "AI/GroupCombatManager.h"
@@ -8,11 +9,28 @@
 #include "AIController.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
+DECLARE_CYCLE_STAT(TEXT("BT Circle Target Execute"), STAT_Sairan_BTCircleTargetExecute, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("BT Circle Target Tick"), STAT_Sairan_BTCircleTargetTick, STATGROUP_SairanAI);
+
 UBTTask_CircleTarget::UBTTask_CircleTarget()
 {
 	NodeName = TEXT("Circle Target (Flank)");
 	bNotifyTick = true;
-	bCreateNodeInstance = true;
+}
+
+uint16 UBTTask_CircleTarget::GetInstanceMemorySize() const
+{
+	return sizeof(FBTCircleTargetMemory);
+}
+
+void UBTTask_CircleTarget::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTCircleTargetMemory>(NodeMemory, InitType);
+}
+
+void UBTTask_CircleTarget::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTCircleTargetMemory>(NodeMemory, CleanupType);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -22,6 +40,10 @@ UBTTask_CircleTarget::UBTTask_CircleTarget()
 EBTNodeResult::Type UBTTask_CircleTarget::ExecuteTask(
 	UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTCircleTargetExecute, BehaviorTree);
+
+	FBTCircleTargetMemory& Memory = *CastInstanceNodeMemory<FBTCircleTargetMemory>(NodeMemory);
+
 	AEnemyAIController* AIC = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIC) return EBTNodeResult::Failed;
 	AEnemyBase* Enemy = AIC->GetControlledEnemy();
@@ -30,15 +52,15 @@ EBTNodeResult::Type UBTTask_CircleTarget::ExecuteTask(
 	if (!Target) return EBTNodeResult::Failed;
 
 	// Reset all state
-	TaskTimer = 0.0f;
-	RepositionTimer = 0.0f;
-	NextRepositionTime = RepositionInterval + FMath::RandRange(-RepositionVariation, RepositionVariation);
-	FeintAccumulator = 0.0f;
-	FeintState = EFeintState::None;
-	bReachedRingTarget = false;
+	Memory.TaskTimer = 0.0f;
+	Memory.RepositionTimer = 0.0f;
+	Memory.NextRepositionTime = RepositionInterval + FMath::RandRange(-RepositionVariation, RepositionVariation);
+	Memory.FeintAccumulator = 0.0f;
+	Memory.FeintState = ECircleFeintState::None;
+	Memory.bReachedRingTarget = false;
 
 	// Give each enemy a different sway phase so they don't all sway in sync
-	SwayPhase = FMath::FRand() * PI * 2.0f;
+	Memory.SwayPhase = FMath::FRand() * PI * 2.0f;
 
 	// Disable auto-orient — we control rotation manually (face the player)
 	if (auto* CMC = Enemy->GetCharacterMovement())
@@ -48,12 +70,12 @@ EBTNodeResult::Type UBTTask_CircleTarget::ExecuteTask(
 	Enemy->SetMovementSpeed(CircleSpeedMultiplier);
 
 	// Try to grab an inner flanking slot
-	bHasFlankSlot = false;
-	if (auto* Mgr = GetWorld()->GetSubsystem<UGroupCombatManager>())
-		bHasFlankSlot = Mgr->RequestFlankingSlot(Enemy);
+	Memory.bHasFlankSlot = false;
+	if (auto* Mgr = Enemy->GetWorld()->GetSubsystem<UGroupCombatManager>())
+		Memory.bHasFlankSlot = Mgr->RequestFlankingSlot(Enemy);
 
 	// Pick initial ring target (inner or outer)
-	PickNewRingTarget(Enemy, Target);
+	PickNewRingTarget(Memory, Enemy, Target);
 
 	return EBTNodeResult::InProgress;
 }
@@ -65,6 +87,10 @@ EBTNodeResult::Type UBTTask_CircleTarget::ExecuteTask(
 void UBTTask_CircleTarget::TickTask(
 	UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTCircleTargetTick, BehaviorTree);
+
+	FBTCircleTargetMemory& Memory = *CastInstanceNodeMemory<FBTCircleTargetMemory>(NodeMemory);
+
 	AEnemyAIController* AIC = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIC) { FinishLatentTask(OwnerComp, EBTNodeResult::Failed); return; }
 	AEnemyBase* Enemy = AIC->GetControlledEnemy();
@@ -72,27 +98,27 @@ void UBTTask_CircleTarget::TickTask(
 	AActor* Target = Enemy->GetCurrentTarget();
 	if (!Target) { FinishLatentTask(OwnerComp, EBTNodeResult::Failed); return; }
 
-	TaskTimer += DeltaSeconds;
-	RepositionTimer += DeltaSeconds;
+	Memory.TaskTimer += DeltaSeconds;
+	Memory.RepositionTimer += DeltaSeconds;
 
-	auto* Mgr = GetWorld()->GetSubsystem<UGroupCombatManager>();
+	auto* Mgr = Enemy->GetWorld()->GetSubsystem<UGroupCombatManager>();
 
 	// ──────────── 1. CHECK IF WE CAN ATTACK ────────────
 	if (Mgr && Mgr->CanEnemyAttack(Enemy))
 	{
-		CleanupState(Enemy);
+		CleanupState(Memory, Enemy);
 		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 		return;
 	}
 
 	// ──────────── 2. TRY TO UPGRADE TO INNER RING ────────────
-	if (!bHasFlankSlot && Mgr)
+	if (!Memory.bHasFlankSlot && Mgr)
 	{
-		bHasFlankSlot = Mgr->RequestFlankingSlot(Enemy);
-		if (bHasFlankSlot)
+		Memory.bHasFlankSlot = Mgr->RequestFlankingSlot(Enemy);
+		if (Memory.bHasFlankSlot)
 		{
-			PickNewRingTarget(Enemy, Target);
-			bReachedRingTarget = false;
+			PickNewRingTarget(Memory, Enemy, Target);
+			Memory.bReachedRingTarget = false;
 		}
 	}
 
@@ -100,55 +126,55 @@ void UBTTask_CircleTarget::TickTask(
 	FacePlayer(Enemy, Target, DeltaSeconds);
 
 	// ──────────── 4. FEINT SYSTEM (inner ring only) ────────────
-	if (FeintState != EFeintState::None)
+	if (Memory.FeintState != ECircleFeintState::None)
 	{
-		UpdateFeint(Enemy, Target, DeltaSeconds);
+		UpdateFeint(Memory, Enemy, Target, DeltaSeconds);
 		// During a feint we don't do regular movement
-		if (TaskTimer >= MaxTaskDuration) { CleanupState(Enemy); FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded); }
+		if (Memory.TaskTimer >= MaxTaskDuration) { CleanupState(Memory, Enemy); FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded); }
 		return;
 	}
 
-	if (bHasFlankSlot && bReachedRingTarget)
+	if (Memory.bHasFlankSlot && Memory.bReachedRingTarget)
 	{
 		// Roll for feint
-		FeintAccumulator += DeltaSeconds;
+		Memory.FeintAccumulator += DeltaSeconds;
 		float FeintRoll = FMath::FRand();
-		if (FeintRoll < FeintChancePerSecond * FeintAccumulator)
+		if (FeintRoll < FeintChancePerSecond * Memory.FeintAccumulator)
 		{
-			FeintAccumulator = 0.0f;
-			StartFeint(Enemy, Target);
+			Memory.FeintAccumulator = 0.0f;
+			StartFeint(Memory, Enemy, Target);
 			return;
 		}
 	}
 
 	// ──────────── 5. MOVE TO RING TARGET ────────────
-	float DistToTarget = FVector::Dist2D(Enemy->GetActorLocation(), CurrentRingTarget);
+	float DistToTarget = FVector::Dist2D(Enemy->GetActorLocation(), Memory.CurrentRingTarget);
 
 	if (DistToTarget > 60.0f)
 	{
-		bReachedRingTarget = false;
-		MoveTowardsFacingPlayer(Enemy, Target, CurrentRingTarget, DeltaSeconds);
+		Memory.bReachedRingTarget = false;
+		MoveTowardsFacingPlayer(Enemy, Target, Memory.CurrentRingTarget, DeltaSeconds);
 	}
 	else
 	{
-		bReachedRingTarget = true;
+		Memory.bReachedRingTarget = true;
 		// At ring position — apply lateral sway to look alive
-		ApplySway(Enemy, Target, DeltaSeconds);
+		ApplySway(Memory, Enemy, Target, DeltaSeconds);
 	}
 
 	// ──────────── 6. PERIODIC REPOSITION ────────────
-	if (RepositionTimer >= NextRepositionTime)
+	if (Memory.RepositionTimer >= Memory.NextRepositionTime)
 	{
-		RepositionTimer = 0.0f;
-		NextRepositionTime = RepositionInterval + FMath::RandRange(-RepositionVariation, RepositionVariation);
-		PickNewRingTarget(Enemy, Target);
-		bReachedRingTarget = false;
+		Memory.RepositionTimer = 0.0f;
+		Memory.NextRepositionTime = RepositionInterval + FMath::RandRange(-RepositionVariation, RepositionVariation);
+		PickNewRingTarget(Memory, Enemy, Target);
+		Memory.bReachedRingTarget = false;
 	}
 
 	// ──────────── 7. MAX DURATION ────────────
-	if (TaskTimer >= MaxTaskDuration)
+	if (Memory.TaskTimer >= MaxTaskDuration)
 	{
-		CleanupState(Enemy);
+		CleanupState(Memory, Enemy);
 		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 	}
 }
@@ -160,55 +186,57 @@ void UBTTask_CircleTarget::TickTask(
 void UBTTask_CircleTarget::OnTaskFinished(
 	UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTNodeResult::Type TaskResult)
 {
+	FBTCircleTargetMemory& Memory = *CastInstanceNodeMemory<FBTCircleTargetMemory>(NodeMemory);
+
 	if (AEnemyAIController* AIC = Cast<AEnemyAIController>(OwnerComp.GetAIOwner()))
 	{
 		if (AEnemyBase* Enemy = AIC->GetControlledEnemy())
-			CleanupState(Enemy);
+			CleanupState(Memory, Enemy);
 	}
 	Super::OnTaskFinished(OwnerComp, NodeMemory, TaskResult);
 }
 
-void UBTTask_CircleTarget::CleanupState(AEnemyBase* Enemy)
+void UBTTask_CircleTarget::CleanupState(FBTCircleTargetMemory& Memory, AEnemyBase* Enemy) const
 {
 	if (!Enemy) return;
 	if (auto* CMC = Enemy->GetCharacterMovement())
 		CMC->bOrientRotationToMovement = true;
 
-	if (bHasFlankSlot)
+	if (Memory.bHasFlankSlot)
 	{
-		if (auto* Mgr = GetWorld()->GetSubsystem<UGroupCombatManager>())
+		if (auto* Mgr = Enemy->GetWorld()->GetSubsystem<UGroupCombatManager>())
 			Mgr->ReleaseFlankingSlot(Enemy);
-		bHasFlankSlot = false;
+		Memory.bHasFlankSlot = false;
 	}
-	FeintState = EFeintState::None;
+	Memory.FeintState = ECircleFeintState::None;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
 // HELPERS
 // ═══════════════════════════════════════════════════════════════════════════
 
-void UBTTask_CircleTarget::PickNewRingTarget(AEnemyBase* Enemy, AActor* Target)
+void UBTTask_CircleTarget::PickNewRingTarget(FBTCircleTargetMemory& Memory, AEnemyBase* Enemy, AActor* Target) const
 {
-	auto* Mgr = GetWorld()->GetSubsystem<UGroupCombatManager>();
+	auto* Mgr = Enemy->GetWorld()->GetSubsystem<UGroupCombatManager>();
 	if (!Mgr)
 	{
 		// Fallback — orbit at ~500 units
 		FVector Away = (Enemy->GetActorLocation() - Target->GetActorLocation()).GetSafeNormal();
 		float Angle = FMath::RandRange(-70.0f, 70.0f);
-		CurrentRingTarget = Target->GetActorLocation() + Away.RotateAngleAxis(Angle, FVector::UpVector) * 500.0f;
+		Memory.CurrentRingTarget = Target->GetActorLocation() + Away.RotateAngleAxis(Angle, FVector::UpVector) * 500.0f;
 		return;
 	}
 
-	if (bHasFlankSlot)
-		CurrentRingTarget = Mgr->GetFlankingPosition(Enemy, Target);
+	if (Memory.bHasFlankSlot)
+		Memory.CurrentRingTarget = Mgr->GetFlankingPosition(Enemy, Target);
 	else
-		CurrentRingTarget = Mgr->GetOuterRingPosition(Enemy, Target);
+		Memory.CurrentRingTarget = Mgr->GetOuterRingPosition(Enemy, Target);
 
 	// Keep current Z
-	CurrentRingTarget.Z = Enemy->GetActorLocation().Z;
+	Memory.CurrentRingTarget.Z = Enemy->GetActorLocation().Z;
 }
 
-void UBTTask_CircleTarget::FacePlayer(AEnemyBase* Enemy, AActor* Target, float DeltaTime)
+void UBTTask_CircleTarget::FacePlayer(AEnemyBase* Enemy, AActor* Target, float DeltaTime) const
 {
 	FVector Dir = (Target->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal2D();
 	if (Dir.IsNearlyZero()) return;
@@ -221,7 +249,7 @@ void UBTTask_CircleTarget::FacePlayer(AEnemyBase* Enemy, AActor* Target, float D
 }
 
 void UBTTask_CircleTarget::MoveTowardsFacingPlayer(
-	AEnemyBase* Enemy, AActor* Target, const FVector& Destination, float DeltaTime)
+	AEnemyBase* Enemy, AActor* Target, const FVector& Destination, float DeltaTime) const
 {
 	FVector MoveDir = (Destination - Enemy->GetActorLocation()).GetSafeNormal2D();
 	if (MoveDir.IsNearlyZero()) return;
@@ -232,15 +260,15 @@ void UBTTask_CircleTarget::MoveTowardsFacingPlayer(
 	Enemy->AddMovementInput(MoveDir, 1.0f, false);
 }
 
-void UBTTask_CircleTarget::ApplySway(AEnemyBase* Enemy, AActor* Target, float DeltaTime)
+void UBTTask_CircleTarget::ApplySway(FBTCircleTargetMemory& Memory, AEnemyBase* Enemy, AActor* Target, float DeltaTime) const
 {
-	SwayPhase += DeltaTime * SwaySpeed;
+	Memory.SwayPhase += DeltaTime * SwaySpeed;
 
 	// Lateral direction = perpendicular to the line toward the player
 	FVector ToPlayer = (Target->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal2D();
 	FVector Lateral = FVector(-ToPlayer.Y, ToPlayer.X, 0.0f);  // perpendicular on XY
 
-	float SwayOffset = FMath::Sin(SwayPhase) * SwayAmplitude * DeltaTime;
+	float SwayOffset = FMath::Sin(Memory.SwayPhase) * SwayAmplitude * DeltaTime;
 	Enemy->AddMovementInput(Lateral, SwayOffset, false);
 }
 
@@ -248,55 +276,55 @@ void UBTTask_CircleTarget::ApplySway(AEnemyBase* Enemy, AActor* Target, float De
 // FEINT SYSTEM — creates tension by faking an attack
 // ═══════════════════════════════════════════════════════════════════════════
 
-void UBTTask_CircleTarget::StartFeint(AEnemyBase* Enemy, AActor* Target)
+void UBTTask_CircleTarget::StartFeint(FBTCircleTargetMemory& Memory, AEnemyBase* Enemy, AActor* Target) const
 {
-	FeintState = EFeintState::Lunging;
-	FeintTimer = 0.0f;
-	FeintOrigin = Enemy->GetActorLocation();
+	Memory.FeintState = ECircleFeintState::Lunging;
+	Memory.FeintTimer = 0.0f;
+	Memory.FeintOrigin = Enemy->GetActorLocation();
 
 	// Briefly speed up for the lunge
 	Enemy->SetMovementSpeed(0.9f);
 }
 
-void UBTTask_CircleTarget::UpdateFeint(AEnemyBase* Enemy, AActor* Target, float DeltaTime)
+void UBTTask_CircleTarget::UpdateFeint(FBTCircleTargetMemory& Memory, AEnemyBase* Enemy, AActor* Target, float DeltaTime) const
 {
-	FeintTimer += DeltaTime;
+	Memory.FeintTimer += DeltaTime;
 
-	switch (FeintState)
+	switch (Memory.FeintState)
 	{
-	case EFeintState::Lunging:
+	case ECircleFeintState::Lunging:
 	{
 		// Move TOWARDS the player quickly
 		FVector ToPlayer = (Target->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal2D();
 		Enemy->AddMovementInput(ToPlayer, 1.0f, false);
 
-		if (FeintTimer >= FeintLungeDuration)
+		if (Memory.FeintTimer >= FeintLungeDuration)
 		{
-			FeintState = EFeintState::Retreating;
-			FeintTimer = 0.0f;
+			Memory.FeintState = ECircleFeintState::Retreating;
+			Memory.FeintTimer = 0.0f;
 			// Slow down for the retreat
 			Enemy->SetMovementSpeed(CircleSpeedMultiplier * 0.8f);
 		}
 		break;
 	}
-	case EFeintState::Retreating:
+	case ECircleFeintState::Retreating:
 	{
 		// Move AWAY from the player (back to ring position)
 		FVector AwayFromPlayer = (Enemy->GetActorLocation() - Target->GetActorLocation()).GetSafeNormal2D();
 		Enemy->AddMovementInput(AwayFromPlayer, 1.0f, false);
 
-		if (FeintTimer >= FeintRetreatDuration)
+		if (Memory.FeintTimer >= FeintRetreatDuration)
 		{
-			FeintState = EFeintState::None;
-			FeintTimer = 0.0f;
-			FeintAccumulator = 0.0f;
+			Memory.FeintState = ECircleFeintState::None;
+			Memory.FeintTimer = 0.0f;
+			Memory.FeintAccumulator = 0.0f;
 			// Restore normal circle speed
 			Enemy->SetMovementSpeed(CircleSpeedMultiplier);
 		}
 		break;
 	}
 	default:
-		FeintState = EFeintState::None;
+		Memory.FeintState = ECircleFeintState::None;
 		break;
 	}
 }
@@ -1,12 +1,15 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "AI/Tasks/BTTask_FindPatrolPoint.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
 #include "AI/EnemyAIController.h"
 #include "Navigation/PatrolPath.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 
+DECLARE_CYCLE_STAT(TEXT("BT Find Patrol Point Execute"), STAT_Sairan_BTFindPatrolPointExecute, STATGROUP_SairanAI);
+
 UBTTask_FindPatrolPoint::UBTTask_FindPatrolPoint()
 {
 	NodeName = TEXT("Find Patrol Point");
@@ -14,6 +17,8 @@ UBTTask_FindPatrolPoint::UBTTask_FindPatrolPoint()
 
 EBTNodeResult::Type UBTTask_FindPatrolPoint::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTFindPatrolPointExecute, BehaviorTree);
+
 	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIController)
 	{
@@ -1,24 +1,42 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "AI/Tasks/BTTask_IdleBehavior.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
 #include "AI/EnemyAIController.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "AIController.h"
 
+DECLARE_CYCLE_STAT(TEXT("BT Idle Behavior Execute"), STAT_Sairan_BTIdleBehaviorExecute, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("BT Idle Behavior Tick"), STAT_Sairan_BTIdleBehaviorTick, STATGROUP_SairanAI);
+
 UBTTask_IdleBehavior::UBTTask_IdleBehavior()
 {
 	NodeName = TEXT("Idle Behavior (Random Pause)");
 	bNotifyTick = true;
-	bCreateNodeInstance = true;
-	
-	CurrentPauseTimer = 0.0f;
-	TargetPauseDuration = 0.0f;
-	bIsPausing = false;
+}
+
+uint16 UBTTask_IdleBehavior::GetInstanceMemorySize() const
+{
+	return sizeof(FBTIdleBehaviorMemory);
+}
+
+void UBTTask_IdleBehavior::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTIdleBehaviorMemory>(NodeMemory, InitType);
+}
+
+void UBTTask_IdleBehavior::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTIdleBehaviorMemory>(NodeMemory, CleanupType);
 }
 
 EBTNodeResult::Type UBTTask_IdleBehavior::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTIdleBehaviorExecute, BehaviorTree);
+
+	FBTIdleBehaviorMemory& Memory = *CastInstanceNodeMemory<FBTIdleBehaviorMemory>(NodeMemory);
+
 	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIController)
 	{
@@ -48,21 +66,21 @@ EBTNodeResult::Type UBTTask_IdleBehavior::ExecuteTask(UBehaviorTreeComponent& Ow
 	}
 
 	// Start pausing
-	bIsPausing = true;
+	Memory.bIsPausing = true;
 	
 	if (bUseEnemyConfig)
 	{
-		TargetPauseDuration = FMath::RandRange(
+		Memory.TargetPauseDuration = FMath::RandRange(
 			Enemy->BehaviorConfig.MinPauseDuration,
 			Enemy->BehaviorConfig.MaxPauseDuration
 		);
 	}
 	else
 	{
-		TargetPauseDuration = FMath::RandRange(MinPauseDuration, MaxPauseDuration);
+		Memory.TargetPauseDuration = FMath::RandRange(MinPauseDuration, MaxPauseDuration);
 	}
 	
-	CurrentPauseTimer = 0.0f;
+	Memory.CurrentPauseTimer = 0.0f;
 
 	// Stop movement
 	AIController->StopMovement();
@@ -76,14 +94,18 @@ EBTNodeResult::Type UBTTask_IdleBehavior::ExecuteTask(UBehaviorTreeComponent& Ow
 	// Notify enemy
 	Enemy->StartRandomPause();
 
-	UE_LOG(LogTemp, Verbose, TEXT("IdleBehavior: %s starting random pause for %.1f seconds"), *Enemy->GetName(), TargetPauseDuration);
+	UE_LOG(LogTemp, Verbose, TEXT("IdleBehavior: %s starting random pause for %.1f seconds"), *Enemy->GetName(), Memory.TargetPauseDuration);
 
 	return EBTNodeResult::InProgress;
 }
 
 void UBTTask_IdleBehavior::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
-	if (!bIsPausing)
+	SAIRAN_SCOPE(STAT_Sairan_BTIdleBehaviorTick, BehaviorTree);
+
+	FBTIdleBehaviorMemory& Memory = *CastInstanceNodeMemory<FBTIdleBehaviorMemory>(NodeMemory);
+
+	if (!Memory.bIsPausing)
 	{
 		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 		return;
@@ -95,17 +117,17 @@ void UBTTask_IdleBehavior::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* No
 	// Abort pause if alerted or has target
 	if (Enemy && (Enemy->GetCurrentTarget() != nullptr))
 	{
-		bIsPausing = false;
+		Memory.bIsPausing = false;
 		UE_LOG(LogTemp, Verbose, TEXT("IdleBehavior: %s pause interrupted (alerted)"), *Enemy->GetName());
 		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 		return;
 	}
 
-	CurrentPauseTimer += DeltaSeconds;
+	Memory.CurrentPauseTimer += DeltaSeconds;
 
-	if (CurrentPauseTimer >= TargetPauseDuration)
+	if (Memory.CurrentPauseTimer >= Memory.TargetPauseDuration)
 	{
-		bIsPausing = false;
+		Memory.bIsPausing = false;
 		UE_LOG(LogTemp, Verbose, TEXT("IdleBehavior: %s pause complete"), Enemy ? *Enemy->GetName() : TEXT("Unknown"));
 		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 	}
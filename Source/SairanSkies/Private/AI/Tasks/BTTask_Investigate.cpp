@@ -1,28 +1,45 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "AI/Tasks/BTTask_Investigate.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
 #include "AI/EnemyAIController.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "NavigationSystem.h"
 #include "AIController.h"
+#include "AI/EnemyNavigationCache.h"
+
+DECLARE_CYCLE_STAT(TEXT("BT Investigate Execute"), STAT_Sairan_BTInvestigateExecute, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("BT Investigate Tick"), STAT_Sairan_BTInvestigateTick, STATGROUP_SairanAI);
 
 UBTTask_Investigate::UBTTask_Investigate()
 {
 	NodeName = TEXT("Investigate Area");
 	bNotifyTick = true;
-	bCreateNodeInstance = true;
-	
-	CurrentInvestigationPoint = 0;
-	WaitTimer = 0.0f;
-	TotalInvestigationTime = 0.0f;
-	bWaitingAtPoint = false;
-	CurrentTargetLocation = FVector::ZeroVector;
+}
+
+uint16 UBTTask_Investigate::GetInstanceMemorySize() const
+{
+	return sizeof(FBTInvestigateMemory);
+}
+
+void UBTTask_Investigate::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTInvestigateMemory>(NodeMemory, InitType);
+}
+
+void UBTTask_Investigate::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTInvestigateMemory>(NodeMemory, CleanupType);
 }
 
 EBTNodeResult::Type UBTTask_Investigate::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTInvestigateExecute, BehaviorTree);
+
+	FBTInvestigateMemory& Memory = *CastInstanceNodeMemory<FBTInvestigateMemory>(NodeMemory);
+
 	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIController)
 	{
@@ -37,10 +54,10 @@ EBTNodeResult::Type UBTTask_Investigate::ExecuteTask(UBehaviorTreeComponent& Own
 
 	Enemy->SetEnemyState(EEnemyState::Investigating);
 
-	CurrentInvestigationPoint = 0;
-	WaitTimer = 0.0f;
-	TotalInvestigationTime = 0.0f;
-	bWaitingAtPoint = false;
+	Memory.CurrentInvestigationPoint = 0;
+	Memory.WaitTimer = 0.0f;
+	Memory.TotalInvestigationTime = 0.0f;
+	Memory.bWaitingAtPoint = false;
 
 	FVector LastKnownLocation = Enemy->GetLastKnownTargetLocation();
 	if (LastKnownLocation.IsZero())
@@ -48,28 +65,26 @@ EBTNodeResult::Type UBTTask_Investigate::ExecuteTask(UBehaviorTreeComponent& Own
 		return EBTNodeResult::Failed;
 	}
 
-	UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(Enemy->GetWorld());
-	if (NavSys)
+	FVector InvestigationPoint;
+	if (FindInvestigationPoint(Enemy, LastKnownLocation, InvestigationPoint))
 	{
-		FNavLocation NavLocation;
-		bool bFound = NavSys->GetRandomReachablePointInRadius(LastKnownLocation, Enemy->PerceptionConfig.InvestigationRadius, NavLocation);
-		if (bFound)
-		{
-			CurrentTargetLocation = NavLocation.Location;
-			AIController->MoveToLocation(CurrentTargetLocation, AcceptanceRadius);
-		}
-		else
-		{
-			CurrentTargetLocation = LastKnownLocation;
-			AIController->MoveToLocation(CurrentTargetLocation, AcceptanceRadius);
-		}
+		Memory.CurrentTargetLocation = InvestigationPoint;
 	}
+	else
+	{
+		Memory.CurrentTargetLocation = LastKnownLocation;
+	}
+	AIController->QueueMoveToLocation(Memory.CurrentTargetLocation, AcceptanceRadius);
 
 	return EBTNodeResult::InProgress;
 }
 
 void UBTTask_Investigate::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTInvestigateTick, BehaviorTree);
+
+	FBTInvestigateMemory& Memory = *CastInstanceNodeMemory<FBTInvestigateMemory>(NodeMemory);
+
 	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIController)
 	{
@@ -91,62 +106,81 @@ void UBTTask_Investigate::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* Nod
 		return;
 	}
 
-	TotalInvestigationTime += DeltaSeconds;
+	Memory.TotalInvestigationTime += DeltaSeconds;
 
-	if (TotalInvestigationTime >= Enemy->PerceptionConfig.InvestigationTime)
+	if (Memory.TotalInvestigationTime >= Enemy->PerceptionConfig.InvestigationTime)
 	{
 		Enemy->SetEnemyState(EEnemyState::Patrolling);
 		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 		return;
 	}
 
-	if (bWaitingAtPoint)
+	if (Memory.bWaitingAtPoint)
 	{
-		WaitTimer += DeltaSeconds;
+		Memory.WaitTimer += DeltaSeconds;
 
 		FRotator CurrentRotation = Enemy->GetActorRotation();
 		CurrentRotation.Yaw += 90.0f * DeltaSeconds;
 		Enemy->SetActorRotation(CurrentRotation);
 
-		if (WaitTimer >= WaitTimeAtPoint)
+		if (Memory.WaitTimer >= WaitTimeAtPoint)
 		{
-			bWaitingAtPoint = false;
-			WaitTimer = 0.0f;
-			CurrentInvestigationPoint++;
+			Memory.bWaitingAtPoint = false;
+			Memory.WaitTimer = 0.0f;
+			Memory.CurrentInvestigationPoint++;
 
-			if (CurrentInvestigationPoint >= InvestigationPoints)
+			if (Memory.CurrentInvestigationPoint >= InvestigationPoints)
 			{
 				Enemy->SetEnemyState(EEnemyState::Patrolling);
 				FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 				return;
 			}
 
-			FVector LastKnownLocation = Enemy->GetLastKnownTargetLocation();
-			UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(Enemy->GetWorld());
-			if (NavSys)
+			FVector InvestigationPoint;
+			if (FindInvestigationPoint(Enemy, Enemy->GetLastKnownTargetLocation(), InvestigationPoint))
 			{
-				FNavLocation NavLocation;
-				bool bFound = NavSys->GetRandomReachablePointInRadius(LastKnownLocation, Enemy->PerceptionConfig.InvestigationRadius, NavLocation);
-				if (bFound)
-				{
-					CurrentTargetLocation = NavLocation.Location;
-					AIController->MoveToLocation(CurrentTargetLocation, AcceptanceRadius);
-				}
+				Memory.CurrentTargetLocation = InvestigationPoint;
+				AIController->QueueMoveToLocation(Memory.CurrentTargetLocation, AcceptanceRadius);
 			}
 		}
 	}
 	else
 	{
-		float DistanceToPoint = FVector::Dist(Enemy->GetActorLocation(), CurrentTargetLocation);
+		if (AIController->HasQueuedMoveFailed())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Investigate: %s no path to investigation point"), *Enemy->GetName());
+			FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
+			return;
+		}
+
+		float DistanceToPoint = FVector::Dist(Enemy->GetActorLocation(), Memory.CurrentTargetLocation);
 		if (DistanceToPoint <= AcceptanceRadius)
 		{
-			bWaitingAtPoint = true;
-			WaitTimer = 0.0f;
+			Memory.bWaitingAtPoint = true;
+			Memory.WaitTimer = 0.0f;
 			AIController->StopMovement();
 		}
 	}
 }
 
+bool UBTTask_Investigate::FindInvestigationPoint(const AEnemyBase* Enemy, const FVector& Origin, FVector& OutPoint) const
+{
+	// Pre-sampled points around the patrolled areas; direct query only on a miss
+	if (UEnemyNavigationCache* NavCache = Enemy->GetWorld()->GetSubsystem<UEnemyNavigationCache>())
+	{
+		return NavCache->GetReachablePointInRadius(Origin, Enemy->PerceptionConfig.InvestigationRadius, OutPoint);
+	}
+
+	UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(Enemy->GetWorld());
+	FNavLocation NavLocation;
+	if (NavSys && NavSys->GetRandomReachablePointInRadius(Origin, Enemy->PerceptionConfig.InvestigationRadius, NavLocation))
+	{
+		OutPoint = NavLocation.Location;
+		return true;
+	}
+	return false;
+}
+
 EBTNodeResult::Type UBTTask_Investigate::AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
 	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
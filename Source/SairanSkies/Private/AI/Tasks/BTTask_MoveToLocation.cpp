@@ -1,22 +1,29 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "AI/Tasks/BTTask_MoveToLocation.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
 #include "AI/EnemyAIController.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Navigation/PathFollowingComponent.h"
+#include "Navigation/PatrolPath.h"
+#include "AI/EnemyNavigationCache.h"
 #include "AIController.h"
 
+DECLARE_CYCLE_STAT(TEXT("BT Move To Location Execute"), STAT_Sairan_BTMoveToLocationExecute, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("BT Move To Location Tick"), STAT_Sairan_BTMoveToLocationTick, STATGROUP_SairanAI);
+
 UBTTask_MoveToLocation::UBTTask_MoveToLocation()
 {
 	NodeName = TEXT("Move To Location");
 	bNotifyTick = true;
-	bCreateNodeInstance = true;
 }
 
 EBTNodeResult::Type UBTTask_MoveToLocation::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTMoveToLocationExecute, BehaviorTree);
+
 	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIController)
 	{
@@ -62,20 +69,35 @@ EBTNodeResult::Type UBTTask_MoveToLocation::ExecuteTask(UBehaviorTreeComponent&
 
 	UE_LOG(LogTemp, Log, TEXT("MoveToLocation: %s starting move to %s"), *Enemy->GetName(), *TargetLocation.ToString());
 
-	EPathFollowingRequestResult::Type MoveResult = AIController->MoveToLocation(
-		TargetLocation,
-		AcceptanceRadius,
-		true,  // bStopOnOverlap
-		true,  // bUsePathfinding
-		false, // bProjectDestinationToNavigation
-		true,  // bCanStrafe
-		TSubclassOf<UNavigationQueryFilter>(),
-		true   // bAllowPartialPath
-	);
+	// Patrol leg already pathfound by the navigation cache: follow it, no query
+	if (Enemy->PatrolPath && !Enemy->GetCurrentTarget())
+	{
+		if (UEnemyNavigationCache* NavCache = Enemy->GetWorld()->GetSubsystem<UEnemyNavigationCache>())
+		{
+			if (FNavPathSharedPtr CachedPath = NavCache->FindPatrolLeg(Enemy->PatrolPath, Enemy->GetActorLocation(), TargetLocation))
+			{
+				FAIMoveRequest MoveRequest(TargetLocation);
+				MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
+				MoveRequest.SetReachTestIncludesAgentRadius(true);
+				MoveRequest.SetCanStrafe(true);
+				MoveRequest.SetAllowPartialPath(true);
+				MoveRequest.SetProjectGoalLocation(false);
+
+				// Not RequestMove: a queued path or failure from the previous leg would hijack this one
+				if (AIController->FollowCachedPath(MoveRequest, CachedPath).IsValid())
+				{
+					return EBTNodeResult::InProgress;
+				}
+			}
+		}
+	}
+
+	// Pathfinding runs in the shared request queue; TickTask waits for the path
+	EPathFollowingRequestResult::Type MoveResult = AIController->QueueMoveToLocation(TargetLocation, AcceptanceRadius);
 
 	if (MoveResult == EPathFollowingRequestResult::Failed)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MoveToLocation: MoveToLocation FAILED for %s to %s"), *Enemy->GetName(), *TargetLocation.ToString());
+		UE_LOG(LogTemp, Warning, TEXT("MoveToLocation: QueueMoveToLocation FAILED for %s to %s"), *Enemy->GetName(), *TargetLocation.ToString());
 		return EBTNodeResult::Failed;
 	}
 
@@ -90,6 +112,8 @@ EBTNodeResult::Type UBTTask_MoveToLocation::ExecuteTask(UBehaviorTreeComponent&
 
 void UBTTask_MoveToLocation::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTMoveToLocationTick, BehaviorTree);
+
 	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIController)
 	{
@@ -131,6 +155,20 @@ void UBTTask_MoveToLocation::TickTask(UBehaviorTreeComponent& OwnerComp, uint8*
 		}
 	}
 
+	// Path still in the request queue: the status below belongs to the previous move
+	if (AIController->IsMoveQueued())
+	{
+		return;
+	}
+
+	// No path came back: path following is Idle but we never got there
+	if (AIController->HasQueuedMoveFailed())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("MoveToLocation: %s no path to destination"), *Enemy->GetName());
+		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
+		return;
+	}
+
 	EPathFollowingStatus::Type MoveStatus = AIController->GetMoveStatus();
 	
 	switch (MoveStatus)
@@ -1,17 +1,35 @@
 // SairanSkies - BT Task: Outer Circle Behavior
 
 #include "AI/Tasks/BTTask_OuterCircleBehavior.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
 #include "AI/EnemyAIController.h"
 #include "AI/GroupCombatManager.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
+DECLARE_CYCLE_STAT(TEXT("BT Outer Circle Behavior Execute"), STAT_Sairan_BTOuterCircleBehaviorExecute, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("BT Outer Circle Behavior Tick"), STAT_Sairan_BTOuterCircleBehaviorTick, STATGROUP_SairanAI);
+
 UBTTask_OuterCircleBehavior::UBTTask_OuterCircleBehavior()
 {
 	NodeName = TEXT("Outer Circle Behavior");
 	bNotifyTick = true;
-	bCreateNodeInstance = true;
+}
+
+uint16 UBTTask_OuterCircleBehavior::GetInstanceMemorySize() const
+{
+	return sizeof(FBTOuterCircleMemory);
+}
+
+void UBTTask_OuterCircleBehavior::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTOuterCircleMemory>(NodeMemory, InitType);
+}
+
+void UBTTask_OuterCircleBehavior::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTOuterCircleMemory>(NodeMemory, CleanupType);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -21,6 +39,10 @@ UBTTask_OuterCircleBehavior::UBTTask_OuterCircleBehavior()
 EBTNodeResult::Type UBTTask_OuterCircleBehavior::ExecuteTask(
 	UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTOuterCircleBehaviorExecute, BehaviorTree);
+
+	FBTOuterCircleMemory& Memory = *CastInstanceNodeMemory<FBTOuterCircleMemory>(NodeMemory);
+
 	AEnemyAIController* AIC = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIC) return EBTNodeResult::Failed;
 	AEnemyBase* Enemy = AIC->GetControlledEnemy();
@@ -29,19 +51,20 @@ EBTNodeResult::Type UBTTask_OuterCircleBehavior::ExecuteTask(
 	if (!Target) return EBTNodeResult::Failed;
 
 	// Reset state
-	TaskTimer = 0.0f;
-	RepositionTimer = 0.0f;
-	NextRepositionTime = RepositionInterval + FMath::RandRange(-RepositionVariation, RepositionVariation);
-	TauntAccumulator = 0.0f;
-	TauntState = ETauntState::None;
-	InnerCheckTimer = 0.0f;
-	bReachedTarget = false;
-	bWaitingToReposition = false;
-	ReactionDelay = 0.0f;
-	ReactionTimer = 0.0f;
-
-	SwayPhase = FMath::FRand() * PI * 2.0f;
-	LastPlayerPosition = Target->GetActorLocation();
+	Memory.TaskTimer = 0.0f;
+	Memory.RepositionTimer = 0.0f;
+	Memory.NextRepositionTime = RepositionInterval + FMath::RandRange(-RepositionVariation, RepositionVariation);
+	Memory.TauntAccumulator = 0.0f;
+	Memory.TauntState = EOuterCircleTauntState::None;
+	Memory.InnerCheckTimer = 0.0f;
+	Memory.bReachedTarget = false;
+	Memory.bWaitingToReposition = false;
+	Memory.ReactionDelay = 0.0f;
+	Memory.ReactionTimer = 0.0f;
+	Memory.RingVersion = 0;
+
+	Memory.SwayPhase = FMath::FRand() * PI * 2.0f;
+	Memory.LastPlayerPosition = Target->GetActorLocation();
 
 	// Disable auto-orient — we rotate manually to face the player
 	if (auto* CMC = Enemy->GetCharacterMovement())
@@ -52,7 +75,7 @@ EBTNodeResult::Type UBTTask_OuterCircleBehavior::ExecuteTask(
 	Enemy->SetEnemyState(EEnemyState::OuterCircle);
 
 	// Pick initial ring position
-	PickNewRingTarget(Enemy, Target);
+	PickNewRingTarget(Memory, Enemy, Target);
 
 	UE_LOG(LogTemp, Log, TEXT("OuterCircle: %s entrando al círculo exterior"), *Enemy->GetName());
 
@@ -66,57 +89,73 @@ EBTNodeResult::Type UBTTask_OuterCircleBehavior::ExecuteTask(
 void UBTTask_OuterCircleBehavior::TickTask(
 	UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTOuterCircleBehaviorTick, BehaviorTree);
+
+	FBTOuterCircleMemory& Memory = *CastInstanceNodeMemory<FBTOuterCircleMemory>(NodeMemory);
+
 	AEnemyAIController* AIC = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIC) { FinishLatentTask(OwnerComp, EBTNodeResult::Failed); return; }
 	AEnemyBase* Enemy = AIC->GetControlledEnemy();
 	if (!Enemy) { FinishLatentTask(OwnerComp, EBTNodeResult::Failed); return; }
 	AActor* Target = Enemy->GetCurrentTarget();
-	if (!Target) { CleanupState(Enemy); FinishLatentTask(OwnerComp, EBTNodeResult::Failed); return; }
+	if (!Target) { CleanupState(Memory, Enemy); FinishLatentTask(OwnerComp, EBTNodeResult::Failed); return; }
 
-	TaskTimer += DeltaSeconds;
-	RepositionTimer += DeltaSeconds;
-	InnerCheckTimer += DeltaSeconds;
+	Memory.TaskTimer += DeltaSeconds;
+	Memory.RepositionTimer += DeltaSeconds;
+	Memory.InnerCheckTimer += DeltaSeconds;
 
-	auto* Mgr = GetWorld()->GetSubsystem<UGroupCombatManager>();
+	auto* Mgr = Enemy->GetWorld()->GetSubsystem<UGroupCombatManager>();
 
 	// ──────────── 1. CHECK IF WE CAN ENTER INNER CIRCLE ────────────
-	if (InnerCheckTimer >= InnerCircleCheckInterval)
+	if (Memory.InnerCheckTimer >= InnerCircleCheckInterval)
 	{
-		InnerCheckTimer = 0.0f;
+		Memory.InnerCheckTimer = 0.0f;
 		if (Mgr && Mgr->RequestInnerCircleEntry(Enemy))
 		{
-			CleanupState(Enemy);
+			CleanupState(Memory, Enemy);
 			UE_LOG(LogTemp, Warning, TEXT("OuterCircle: %s → entrando al INNER CIRCLE"), *Enemy->GetName());
 			FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 			return;
 		}
 	}
 
-	// ──────────── 2. REACT TO PLAYER MOVEMENT (with delay) ────────────
-	float PlayerMoveDist = FVector::Dist2D(Target->GetActorLocation(), LastPlayerPosition);
-	if (PlayerMoveDist > 150.0f)
+	// ──────────── 2. REACT TO SLOT CHANGES / PLAYER MOVEMENT (with delay) ────────────
+	bool bShouldReact = false;
+	FVector AssignedSlot;
+	uint32 SlotVersion = 0;
+	if (Mgr && Mgr->GetAssignedRingSlot(Enemy, AssignedSlot, SlotVersion))
+	{
+		// The manager re-solves the ring when the player moves; only follow real slot changes
+		bShouldReact = SlotVersion != Memory.RingVersion;
+	}
+	else
 	{
-		if (!bWaitingToReposition)
+		bShouldReact = FVector::Dist2D(Target->GetActorLocation(), Memory.LastPlayerPosition) > 150.0f;
+	}
+
+	if (bShouldReact)
+	{
+		if (!Memory.bWaitingToReposition)
 		{
-			// Player moved significantly — set a random delay before reacting
-			bWaitingToReposition = true;
-			ReactionDelay = FMath::RandRange(
+			// Slot (or player) moved significantly — set a random delay before reacting
+			Memory.bWaitingToReposition = true;
+			Memory.ReactionDelay = FMath::RandRange(
 				Enemy->CombatConfig.PlayerMoveReactionDelayMin,
 				Enemy->CombatConfig.PlayerMoveReactionDelayMax);
-			ReactionTimer = 0.0f;
+			Memory.ReactionTimer = 0.0f;
 		}
 	}
 
-	if (bWaitingToReposition)
+	if (Memory.bWaitingToReposition)
 	{
-		ReactionTimer += DeltaSeconds;
-		if (ReactionTimer >= ReactionDelay)
+		Memory.ReactionTimer += DeltaSeconds;
+		if (Memory.ReactionTimer >= Memory.ReactionDelay)
 		{
 			// React: update ring target and player position
-			PickNewRingTarget(Enemy, Target);
-			LastPlayerPosition = Target->GetActorLocation();
-			bReachedTarget = false;
-			bWaitingToReposition = false;
+			PickNewRingTarget(Memory, Enemy, Target);
+			Memory.LastPlayerPosition = Target->GetActorLocation();
+			Memory.bReachedTarget = false;
+			Memory.bWaitingToReposition = false;
 			UE_LOG(LogTemp, Verbose, TEXT("OuterCircle: %s reacciona al movimiento del jugador"), *Enemy->GetName());
 		}
 	}
@@ -125,47 +164,47 @@ void UBTTask_OuterCircleBehavior::TickTask(
 	FacePlayer(Enemy, Target, DeltaSeconds);
 
 	// ──────────── 4. TAUNT SYSTEM ────────────
-	if (TauntState != ETauntState::None)
+	if (Memory.TauntState != EOuterCircleTauntState::None)
 	{
-		UpdateTaunt(Enemy, Target, DeltaSeconds);
+		UpdateTaunt(Memory, Enemy, Target, DeltaSeconds);
 		return; // During taunt, skip regular movement
 	}
 
 	// Roll for taunt when standing at ring position
-	if (bReachedTarget)
+	if (Memory.bReachedTarget)
 	{
-		TauntAccumulator += DeltaSeconds;
+		Memory.TauntAccumulator += DeltaSeconds;
 		float TauntRoll = FMath::FRand();
-		if (TauntRoll < TauntChancePerSecond * TauntAccumulator)
+		if (TauntRoll < TauntChancePerSecond * Memory.TauntAccumulator)
 		{
-			TauntAccumulator = 0.0f;
-			StartTaunt(Enemy, Target);
+			Memory.TauntAccumulator = 0.0f;
+			StartTaunt(Memory, Enemy, Target);
 			return;
 		}
 	}
 
 	// ──────────── 5. MOVE TO RING TARGET ────────────
-	float DistToRingTarget = FVector::Dist2D(Enemy->GetActorLocation(), CurrentRingTarget);
+	float DistToRingTarget = FVector::Dist2D(Enemy->GetActorLocation(), Memory.CurrentRingTarget);
 
 	if (DistToRingTarget > 80.0f)
 	{
-		bReachedTarget = false;
-		MoveTowardsFacingPlayer(Enemy, Target, CurrentRingTarget, DeltaSeconds);
+		Memory.bReachedTarget = false;
+		MoveTowardsFacingPlayer(Enemy, Target, Memory.CurrentRingTarget, DeltaSeconds);
 	}
 	else
 	{
-		bReachedTarget = true;
+		Memory.bReachedTarget = true;
 		// At ring position — apply lateral sway
-		ApplySway(Enemy, Target, DeltaSeconds);
+		ApplySway(Memory, Enemy, Target, DeltaSeconds);
 	}
 
 	// ──────────── 6. PERIODIC REPOSITION ────────────
-	if (RepositionTimer >= NextRepositionTime)
+	if (Memory.RepositionTimer >= Memory.NextRepositionTime)
 	{
-		RepositionTimer = 0.0f;
-		NextRepositionTime = RepositionInterval + FMath::RandRange(-RepositionVariation, RepositionVariation);
-		PickNewRingTarget(Enemy, Target);
-		bReachedTarget = false;
+		Memory.RepositionTimer = 0.0f;
+		Memory.NextRepositionTime = RepositionInterval + FMath::RandRange(-RepositionVariation, RepositionVariation);
+		PickNewRingTarget(Memory, Enemy, Target);
+		Memory.bReachedTarget = false;
 	}
 }
 
@@ -176,45 +215,51 @@ void UBTTask_OuterCircleBehavior::TickTask(
 void UBTTask_OuterCircleBehavior::OnTaskFinished(
 	UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTNodeResult::Type TaskResult)
 {
+	FBTOuterCircleMemory& Memory = *CastInstanceNodeMemory<FBTOuterCircleMemory>(NodeMemory);
+
 	if (AEnemyAIController* AIC = Cast<AEnemyAIController>(OwnerComp.GetAIOwner()))
 	{
 		if (AEnemyBase* Enemy = AIC->GetControlledEnemy())
-			CleanupState(Enemy);
+			CleanupState(Memory, Enemy);
 	}
 	Super::OnTaskFinished(OwnerComp, NodeMemory, TaskResult);
 }
 
-void UBTTask_OuterCircleBehavior::CleanupState(AEnemyBase* Enemy)
+void UBTTask_OuterCircleBehavior::CleanupState(FBTOuterCircleMemory& Memory, AEnemyBase* Enemy) const
 {
 	if (!Enemy) return;
 	if (auto* CMC = Enemy->GetCharacterMovement())
 		CMC->bOrientRotationToMovement = true;
-	TauntState = ETauntState::None;
+	Memory.TauntState = EOuterCircleTauntState::None;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
 // HELPERS
 // ═══════════════════════════════════════════════════════════════════════════
 
-void UBTTask_OuterCircleBehavior::PickNewRingTarget(AEnemyBase* Enemy, AActor* Target)
+void UBTTask_OuterCircleBehavior::PickNewRingTarget(FBTOuterCircleMemory& Memory, AEnemyBase* Enemy, AActor* Target) const
 {
-	auto* Mgr = GetWorld()->GetSubsystem<UGroupCombatManager>();
+	auto* Mgr = Enemy->GetWorld()->GetSubsystem<UGroupCombatManager>();
 	if (Mgr)
 	{
-		CurrentRingTarget = Mgr->GetOuterCirclePosition(Enemy, Target);
+		// Solved slot when published; otherwise a provisional point until the next solve
+		if (!Mgr->GetAssignedRingSlot(Enemy, Memory.CurrentRingTarget, Memory.RingVersion))
+		{
+			Memory.CurrentRingTarget = Mgr->GetOuterCirclePosition(Enemy, Target);
+		}
 	}
 	else
 	{
 		// Fallback
 		FVector Away = (Enemy->GetActorLocation() - Target->GetActorLocation()).GetSafeNormal();
 		float Angle = FMath::RandRange(-60.0f, 60.0f);
-		CurrentRingTarget = Target->GetActorLocation() +
+		Memory.CurrentRingTarget = Target->GetActorLocation() +
 			Away.RotateAngleAxis(Angle, FVector::UpVector) * Enemy->CombatConfig.OuterCircleRadius;
 	}
-	CurrentRingTarget.Z = Enemy->GetActorLocation().Z;
+	Memory.CurrentRingTarget.Z = Enemy->GetActorLocation().Z;
 }
 
-void UBTTask_OuterCircleBehavior::FacePlayer(AEnemyBase* Enemy, AActor* Target, float DeltaTime)
+void UBTTask_OuterCircleBehavior::FacePlayer(AEnemyBase* Enemy, AActor* Target, float DeltaTime) const
 {
 	FVector Dir = (Target->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal2D();
 	if (Dir.IsNearlyZero()) return;
@@ -227,19 +272,19 @@ void UBTTask_OuterCircleBehavior::FacePlayer(AEnemyBase* Enemy, AActor* Target,
 }
 
 void UBTTask_OuterCircleBehavior::MoveTowardsFacingPlayer(
-	AEnemyBase* Enemy, AActor* Target, const FVector& Dest, float DeltaTime)
+	AEnemyBase* Enemy, AActor* Target, const FVector& Dest, float DeltaTime) const
 {
 	FVector MoveDir = (Dest - Enemy->GetActorLocation()).GetSafeNormal2D();
 	if (MoveDir.IsNearlyZero()) return;
 	Enemy->AddMovementInput(MoveDir, 1.0f, false);
 }
 
-void UBTTask_OuterCircleBehavior::ApplySway(AEnemyBase* Enemy, AActor* Target, float DeltaTime)
+void UBTTask_OuterCircleBehavior::ApplySway(FBTOuterCircleMemory& Memory, AEnemyBase* Enemy, AActor* Target, float DeltaTime) const
 {
-	SwayPhase += DeltaTime * SwaySpeed;
+	Memory.SwayPhase += DeltaTime * SwaySpeed;
 	FVector ToPlayer = (Target->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal2D();
 	FVector Lateral = FVector(-ToPlayer.Y, ToPlayer.X, 0.0f);
-	float SwayOffset = FMath::Sin(SwayPhase) * SwayAmplitude * DeltaTime;
+	float SwayOffset = FMath::Sin(Memory.SwayPhase) * SwayAmplitude * DeltaTime;
 	Enemy->AddMovementInput(Lateral, SwayOffset, false);
 }
 
@@ -247,11 +292,11 @@ void UBTTask_OuterCircleBehavior::ApplySway(AEnemyBase* Enemy, AActor* Target, f
 // TAUNT SYSTEM — fake rush towards player, then retreat
 // ═══════════════════════════════════════════════════════════════════════════
 
-void UBTTask_OuterCircleBehavior::StartTaunt(AEnemyBase* Enemy, AActor* Target)
+void UBTTask_OuterCircleBehavior::StartTaunt(FBTOuterCircleMemory& Memory, AEnemyBase* Enemy, AActor* Target) const
 {
-	TauntState = ETauntState::Lunging;
-	TauntTimer = 0.0f;
-	TauntOrigin = Enemy->GetActorLocation();
+	Memory.TauntState = EOuterCircleTauntState::Lunging;
+	Memory.TauntTimer = 0.0f;
+	Memory.TauntOrigin = Enemy->GetActorLocation();
 
 	// Speed up briefly for the lunge
 	Enemy->SetMovementSpeed(0.6f);
@@ -259,47 +304,47 @@ void UBTTask_OuterCircleBehavior::StartTaunt(AEnemyBase* Enemy, AActor* Target)
 	UE_LOG(LogTemp, Verbose, TEXT("OuterCircle: %s TAUNT → lunge"), *Enemy->GetName());
 }
 
-void UBTTask_OuterCircleBehavior::UpdateTaunt(AEnemyBase* Enemy, AActor* Target, float DeltaTime)
+void UBTTask_OuterCircleBehavior::UpdateTaunt(FBTOuterCircleMemory& Memory, AEnemyBase* Enemy, AActor* Target, float DeltaTime) const
 {
-	TauntTimer += DeltaTime;
+	Memory.TauntTimer += DeltaTime;
 	FacePlayer(Enemy, Target, DeltaTime);
 
-	switch (TauntState)
+	switch (Memory.TauntState)
 	{
-	case ETauntState::Lunging:
+	case EOuterCircleTauntState::Lunging:
 	{
 		// Rush TOWARDS the player
 		FVector ToPlayer = (Target->GetActorLocation() - Enemy->GetActorLocation()).GetSafeNormal2D();
 		Enemy->AddMovementInput(ToPlayer, 1.0f, false);
 
 		// Check if we've gone far enough or hit the "invisible wall" (outer circle limit)
-		float LungedDist = FVector::Dist2D(Enemy->GetActorLocation(), TauntOrigin);
-		if (TauntTimer >= TauntLungeDuration || LungedDist >= TauntLungeDistance)
+		float LungedDist = FVector::Dist2D(Enemy->GetActorLocation(), Memory.TauntOrigin);
+		if (Memory.TauntTimer >= TauntLungeDuration || LungedDist >= TauntLungeDistance)
 		{
-			TauntState = ETauntState::Retreating;
-			TauntTimer = 0.0f;
+			Memory.TauntState = EOuterCircleTauntState::Retreating;
+			Memory.TauntTimer = 0.0f;
 			Enemy->SetMovementSpeed(CircleSpeedMultiplier * 0.7f);
 		}
 		break;
 	}
-	case ETauntState::Retreating:
+	case EOuterCircleTauntState::Retreating:
 	{
 		// Move BACK to ring position
-		FVector BackDir = (TauntOrigin - Enemy->GetActorLocation()).GetSafeNormal2D();
+		FVector BackDir = (Memory.TauntOrigin - Enemy->GetActorLocation()).GetSafeNormal2D();
 		if (!BackDir.IsNearlyZero())
 			Enemy->AddMovementInput(BackDir, 1.0f, false);
 
-		if (TauntTimer >= TauntRetreatDuration)
+		if (Memory.TauntTimer >= TauntRetreatDuration)
 		{
-			TauntState = ETauntState::None;
-			TauntTimer = 0.0f;
-			TauntAccumulator = 0.0f;
+			Memory.TauntState = EOuterCircleTauntState::None;
+			Memory.TauntTimer = 0.0f;
+			Memory.TauntAccumulator = 0.0f;
 			Enemy->SetMovementSpeed(CircleSpeedMultiplier);
 		}
 		break;
 	}
 	default:
-		TauntState = ETauntState::None;
+		Memory.TauntState = EOuterCircleTauntState::None;
 		break;
 	}
 }
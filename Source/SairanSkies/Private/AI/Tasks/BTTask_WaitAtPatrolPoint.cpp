@@ -1,29 +1,43 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "AI/Tasks/BTTask_WaitAtPatrolPoint.h"
+#include "Core/SairanStats.h"
 #include "Enemies/EnemyBase.h"
 #include "AI/EnemyAIController.h"
 #include "Animation/EnemyAnimInstance.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "AIController.h"
 
+DECLARE_CYCLE_STAT(TEXT("BT Wait At Patrol Point Execute"), STAT_Sairan_BTWaitAtPatrolPointExecute, STATGROUP_SairanAI);
+DECLARE_CYCLE_STAT(TEXT("BT Wait At Patrol Point Tick"), STAT_Sairan_BTWaitAtPatrolPointTick, STATGROUP_SairanAI);
+
 UBTTask_WaitAtPatrolPoint::UBTTask_WaitAtPatrolPoint()
 {
 	NodeName = TEXT("Wait At Patrol Point");
 	bNotifyTick = true;
-	bCreateNodeInstance = true;
-	
-	WaitTimer = 0.0f;
-	TargetWaitTime = 0.0f;
-	CurrentLookIndex = 0;
-	LookTimer = 0.0f;
-	bIsRotating = false;
-	bCheckedForConversation = false;
-	bInConversation = false;
+}
+
+uint16 UBTTask_WaitAtPatrolPoint::GetInstanceMemorySize() const
+{
+	return sizeof(FBTWaitAtPatrolPointMemory);
+}
+
+void UBTTask_WaitAtPatrolPoint::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTWaitAtPatrolPointMemory>(NodeMemory, InitType);
+}
+
+void UBTTask_WaitAtPatrolPoint::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTWaitAtPatrolPointMemory>(NodeMemory, CleanupType);
 }
 
 EBTNodeResult::Type UBTTask_WaitAtPatrolPoint::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTWaitAtPatrolPointExecute, BehaviorTree);
+
+	FBTWaitAtPatrolPointMemory& Memory = *CastInstanceNodeMemory<FBTWaitAtPatrolPointMemory>(NodeMemory);
+
 	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIController)
 	{
@@ -39,35 +53,31 @@ EBTNodeResult::Type UBTTask_WaitAtPatrolPoint::ExecuteTask(UBehaviorTreeComponen
 	// Calculate wait time with variation
 	if (bUseEnemyWaitTime)
 	{
-		TargetWaitTime = FMath::RandRange(
+		Memory.TargetWaitTime = FMath::RandRange(
 			Enemy->PatrolConfig.WaitTimeAtPatrolPoint,
 			Enemy->PatrolConfig.MaxWaitTimeAtPatrolPoint
 		);
 	}
 	else
 	{
-		TargetWaitTime = FMath::RandRange(CustomWaitTimeMin, CustomWaitTimeMax);
+		Memory.TargetWaitTime = FMath::RandRange(CustomWaitTimeMin, CustomWaitTimeMax);
 	}
 
-	WaitTimer = 0.0f;
+	Memory.WaitTimer = 0.0f;
 	AIController->StopMovement();
 
 	// Initialize conversation check state
-	bCheckedForConversation = false;
-	bInConversation = false;
+	Memory.bCheckedForConversation = false;
+	Memory.bInConversation = false;
 
 	// Initialize look around system - using animation system instead of rotating body
-	OriginalRotation = Enemy->GetActorRotation();
-	CurrentLookIndex = 0;
-	LookTimer = 0.0f;
-	bIsRotating = false;
+	Memory.CurrentLookIndex = 0;
+	Memory.LookTimer = 0.0f;
 
 	// Set initial random look direction via animation system
 	if (bLookAround && LookAroundCount > 0)
 	{
 		float RandomYaw = FMath::RandRange(-MaxLookAngle, MaxLookAngle);
-		TargetLookRotation = FRotator(0.0f, RandomYaw, 0.0f);
-		bIsRotating = true;
 		
 		// Use animation system if available
 		UEnemyAnimInstance* AnimInstance = Cast<UEnemyAnimInstance>(Enemy->GetMesh()->GetAnimInstance());
@@ -77,13 +87,17 @@ EBTNodeResult::Type UBTTask_WaitAtPatrolPoint::ExecuteTask(UBehaviorTreeComponen
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("WaitAtPatrolPoint: %s starting wait for %.1f seconds"), *Enemy->GetName(), TargetWaitTime);
+	UE_LOG(LogTemp, Log, TEXT("WaitAtPatrolPoint: %s starting wait for %.1f seconds"), *Enemy->GetName(), Memory.TargetWaitTime);
 
 	return EBTNodeResult::InProgress;
 }
 
 void UBTTask_WaitAtPatrolPoint::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	SAIRAN_SCOPE(STAT_Sairan_BTWaitAtPatrolPointTick, BehaviorTree);
+
+	FBTWaitAtPatrolPointMemory& Memory = *CastInstanceNodeMemory<FBTWaitAtPatrolPointMemory>(NodeMemory);
+
 	AEnemyAIController* AIController = Cast<AEnemyAIController>(OwnerComp.GetAIOwner());
 	if (!AIController)
 	{
@@ -119,15 +133,15 @@ void UBTTask_WaitAtPatrolPoint::TickTask(UBehaviorTreeComponent& OwnerComp, uint
 		return;
 	}
 
-	WaitTimer += DeltaSeconds;
+	Memory.WaitTimer += DeltaSeconds;
 
 	// ========== CONVERSATION SYSTEM ==========
 	// Check if we should look for a conversation partner
-	if (bCheckForConversation && !bCheckedForConversation && !bInConversation)
+	if (bCheckForConversation && !Memory.bCheckedForConversation && !Memory.bInConversation)
 	{
-		if (WaitTimer >= TimeBeforeConversationCheck)
+		if (Memory.WaitTimer >= TimeBeforeConversationCheck)
 		{
-			bCheckedForConversation = true;
+			Memory.bCheckedForConversation = true;
 			
 			// Look for nearby enemy to converse with
 			AEnemyBase* NearbyEnemy = Enemy->FindNearbyEnemyForConversation();
@@ -136,21 +150,21 @@ void UBTTask_WaitAtPatrolPoint::TickTask(UBehaviorTreeComponent& OwnerComp, uint
 				// Try to start conversation
 				if (Enemy->TryStartConversation(NearbyEnemy))
 				{
-					bInConversation = true;
+					Memory.bInConversation = true;
 					// Extend wait time to conversation duration
-					TargetWaitTime = Enemy->ConversationConfig.MaxConversationDuration + WaitTimer;
+					Memory.TargetWaitTime = Enemy->ConversationConfig.MaxConversationDuration + Memory.WaitTimer;
 					
 					UE_LOG(LogTemp, Log, TEXT("WaitAtPatrolPoint: %s starting conversation, extending wait to %.1f seconds"), 
-						*Enemy->GetName(), TargetWaitTime);
+						*Enemy->GetName(), Memory.TargetWaitTime);
 				}
 			}
 		}
 	}
 
 	// If in conversation, check if it ended
-	if (bInConversation && !Enemy->IsConversing())
+	if (Memory.bInConversation && !Enemy->IsConversing())
 	{
-		bInConversation = false;
+		Memory.bInConversation = false;
 		// End the task since conversation is over
 		if (AnimInstance)
 		{
@@ -162,26 +176,26 @@ void UBTTask_WaitAtPatrolPoint::TickTask(UBehaviorTreeComponent& OwnerComp, uint
 	}
 
 	// If in conversation, don't do normal look around behavior
-	if (bInConversation)
+	if (Memory.bInConversation)
 	{
 		// Just wait for conversation to end
 		return;
 	}
 
 	// Handle looking around behavior via animation system (head/torso only)
-	if (bLookAround && CurrentLookIndex < LookAroundCount)
+	if (bLookAround && Memory.CurrentLookIndex < LookAroundCount)
 	{
-		LookTimer += DeltaSeconds;
+		Memory.LookTimer += DeltaSeconds;
 		
-		if (LookTimer >= TimePerLookDirection)
+		if (Memory.LookTimer >= TimePerLookDirection)
 		{
-			CurrentLookIndex++;
-			LookTimer = 0.0f;
+			Memory.CurrentLookIndex++;
+			Memory.LookTimer = 0.0f;
 			
-			if (CurrentLookIndex < LookAroundCount)
+			if (Memory.CurrentLookIndex < LookAroundCount)
 			{
 				// Pick new look direction (alternating sides for more natural look)
-				float BaseAngle = (CurrentLookIndex % 2 == 0) ? MaxLookAngle : -MaxLookAngle;
+				float BaseAngle = (Memory.CurrentLookIndex % 2 == 0) ? MaxLookAngle : -MaxLookAngle;
 				float RandomVariation = FMath::RandRange(-20.0f, 20.0f);
 				float NewYaw = BaseAngle * FMath::RandRange(0.5f, 1.0f) + RandomVariation;
 				
@@ -203,7 +217,7 @@ void UBTTask_WaitAtPatrolPoint::TickTask(UBehaviorTreeComponent& OwnerComp, uint
 	}
 
 	// Check if wait is complete
-	if (WaitTimer >= TargetWaitTime)
+	if (Memory.WaitTimer >= Memory.TargetWaitTime)
 	{
 		// Clear any look at
 		if (AnimInstance)
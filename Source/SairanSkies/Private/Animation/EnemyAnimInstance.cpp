@@ -2,9 +2,12 @@
 
 #include "Animation/EnemyAnimInstance.h"
 #include "Enemies/EnemyBase.h"
+#include "Core/SairanStats.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 
+DECLARE_CYCLE_STAT(TEXT("Enemy Anim Update"), STAT_Sairan_EnemyAnimUpdate, STATGROUP_SairanAI);
+
 UEnemyAnimInstance::UEnemyAnimInstance()
 {
 	Speed = 0.0f;
@@ -51,6 +54,8 @@ void UEnemyAnimInstance::NativeInitializeAnimation()
 
 void UEnemyAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 {
+	SAIRAN_SCOPE(STAT_Sairan_EnemyAnimUpdate, Animation);
+
 	Super::NativeUpdateAnimation(DeltaSeconds);
 
 	if (!OwnerEnemy)
@@ -60,11 +65,18 @@ void UEnemyAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 		{
 			OwnerEnemy = Cast<AEnemyBase>(PawnOwner);
 		}
-		
-		if (!OwnerEnemy)
-		{
-			return;
-		}
+	}
+
+	GatherSnapshot();
+}
+
+void UEnemyAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	if (!Snapshot.bValid)
+	{
+		return;
 	}
 
 	UpdateMovementValues(DeltaSeconds);
@@ -73,47 +85,61 @@ void UEnemyAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 	UpdateTurnInPlace(DeltaSeconds);
 }
 
-void UEnemyAnimInstance::UpdateMovementValues(float DeltaSeconds)
+void UEnemyAnimInstance::GatherSnapshot()
 {
+	Snapshot.bValid = OwnerEnemy != nullptr;
 	if (!OwnerEnemy)
 	{
 		return;
 	}
 
-	// Get velocity
-	FVector Velocity = OwnerEnemy->GetVelocity();
-	Speed = Velocity.Size2D();
+	Snapshot.Velocity = OwnerEnemy->GetVelocity();
+	Snapshot.Location = OwnerEnemy->GetActorLocation();
+	Snapshot.Rotation = OwnerEnemy->GetActorRotation();
+
+	const UCharacterMovementComponent* MovementComp = OwnerEnemy->GetCharacterMovement();
+	Snapshot.bIsFalling = MovementComp && MovementComp->IsFalling();
+
+	Snapshot.State = OwnerEnemy->GetEnemyState();
+	Snapshot.bIsDead = OwnerEnemy->IsDead();
+	Snapshot.bIsInCombat = OwnerEnemy->IsInCombat();
+	Snapshot.bIsAlerted = OwnerEnemy->IsAlerted();
+	Snapshot.SuspicionLevel = OwnerEnemy->GetSuspicionLevel();
+	Snapshot.bIsInRandomPause = OwnerEnemy->IsInRandomPause();
+
+	Snapshot.bHasLookAtTarget = bPendingLookAtTarget;
+	Snapshot.LookAtTarget = PendingLookAtTarget;
+	bPendingLookAtTarget = false;
+
+	Snapshot.bHasLookAtRotation = bPendingLookAtRotation;
+	Snapshot.LookAtRotation = PendingLookAtRotation;
+	bPendingLookAtRotation = false;
+}
+
+void UEnemyAnimInstance::UpdateMovementValues(float DeltaSeconds)
+{
+	Speed = Snapshot.Velocity.Size2D();
 	bIsMoving = Speed > MovingSpeedThreshold;
 
 	// Calculate movement direction
 	MovementDirection = CalculateMovementDirection();
 
-	// Check if in air
-	UCharacterMovementComponent* MovementComp = OwnerEnemy->GetCharacterMovement();
-	if (MovementComp)
-	{
-		bIsInAir = MovementComp->IsFalling();
-	}
+	bIsInAir = Snapshot.bIsFalling;
 }
 
 void UEnemyAnimInstance::UpdateStateValues()
 {
-	if (!OwnerEnemy)
-	{
-		return;
-	}
-
 	// Store previous state for transition detection
 	PreviousState = LastFrameState;
 	LastFrameState = CurrentState;
 
 	// Get current state
-	CurrentState = OwnerEnemy->GetEnemyState();
-	bIsDead = OwnerEnemy->IsDead();
-	bIsInCombat = OwnerEnemy->IsInCombat();
-	bIsAlerted = OwnerEnemy->IsAlerted();
-	SuspicionLevel = OwnerEnemy->GetSuspicionLevel();
-	bIsInIdlePause = OwnerEnemy->IsInRandomPause();
+	CurrentState = Snapshot.State;
+	bIsDead = Snapshot.bIsDead;
+	bIsInCombat = Snapshot.bIsInCombat;
+	bIsAlerted = Snapshot.bIsAlerted;
+	SuspicionLevel = Snapshot.SuspicionLevel;
+	bIsInIdlePause = Snapshot.bIsInRandomPause;
 
 	// Determine if attacking based on state
 	bIsAttacking = (CurrentState == EEnemyState::Attacking);
@@ -121,6 +147,27 @@ void UEnemyAnimInstance::UpdateStateValues()
 
 void UEnemyAnimInstance::UpdateLookAt(float DeltaSeconds)
 {
+	if (Snapshot.bHasLookAtRotation)
+	{
+		TargetLookAtYaw = FMath::Clamp(Snapshot.LookAtRotation.Yaw, -MaxLookAtYaw, MaxLookAtYaw);
+		TargetLookAtPitch = FMath::Clamp(Snapshot.LookAtRotation.Pitch, -MaxLookAtPitch, MaxLookAtPitch);
+	}
+
+	// Resolve a SetLookAtTarget request against this frame's transform
+	if (Snapshot.bHasLookAtTarget)
+	{
+		const FVector EnemyEyeLocation = Snapshot.Location + FVector(0.0f, 0.0f, 80.0f); // Approximate eye height
+		const FRotator LookAtRotation = UKismetMathLibrary::FindLookAtRotation(EnemyEyeLocation, Snapshot.LookAtTarget);
+
+		// Calculate relative rotation
+		const float DeltaYaw = FMath::FindDeltaAngleDegrees(Snapshot.Rotation.Yaw, LookAtRotation.Yaw);
+		const float DeltaPitch = LookAtRotation.Pitch;
+
+		// Clamp to maximum values
+		TargetLookAtYaw = FMath::Clamp(DeltaYaw, -MaxLookAtYaw, MaxLookAtYaw);
+		TargetLookAtPitch = FMath::Clamp(DeltaPitch, -MaxLookAtPitch, MaxLookAtPitch);
+	}
+
 	// Smoothly interpolate look at values
 	LookAtYaw = FMath::FInterpTo(LookAtYaw, TargetLookAtYaw, DeltaSeconds, LookAtInterpSpeed);
 	LookAtPitch = FMath::FInterpTo(LookAtPitch, TargetLookAtPitch, DeltaSeconds, LookAtInterpSpeed);
@@ -144,7 +191,7 @@ void UEnemyAnimInstance::UpdateLookAt(float DeltaSeconds)
 
 void UEnemyAnimInstance::UpdateTurnInPlace(float DeltaSeconds)
 {
-	if (!OwnerEnemy || bIsMoving || bIsDead)
+	if (bIsMoving || bIsDead)
 	{
 		RootYawOffset = 0.0f;
 		bIsTurningInPlace = false;
@@ -165,17 +212,14 @@ void UEnemyAnimInstance::UpdateTurnInPlace(float DeltaSeconds)
 
 float UEnemyAnimInstance::CalculateMovementDirection() const
 {
-	if (!OwnerEnemy || !bIsMoving)
+	if (!bIsMoving)
 	{
 		return 0.0f;
 	}
 
-	FVector Velocity = OwnerEnemy->GetVelocity();
-	FRotator ActorRotation = OwnerEnemy->GetActorRotation();
-
 	// Calculate angle between velocity and forward vector
-	FVector Forward = ActorRotation.Vector();
-	FVector VelocityNormalized = Velocity.GetSafeNormal2D();
+	FVector Forward = Snapshot.Rotation.Vector();
+	FVector VelocityNormalized = Snapshot.Velocity.GetSafeNormal2D();
 
 	float DotProduct = FVector::DotProduct(Forward, VelocityNormalized);
 	float CrossProduct = FVector::CrossProduct(Forward, VelocityNormalized).Z;
@@ -192,37 +236,22 @@ float UEnemyAnimInstance::CalculateMovementDirection() const
 
 void UEnemyAnimInstance::SetLookAtTarget(FVector WorldLocation)
 {
-	if (!OwnerEnemy)
-	{
-		return;
-	}
-
-	// Calculate rotation from enemy to target
-	FVector EnemyLocation = OwnerEnemy->GetActorLocation();
-	FVector EnemyEyeLocation = EnemyLocation + FVector(0.0f, 0.0f, 80.0f); // Approximate eye height
-	
-	FRotator LookAtRotation = UKismetMathLibrary::FindLookAtRotation(EnemyEyeLocation, WorldLocation);
-	FRotator ActorRotation = OwnerEnemy->GetActorRotation();
-
-	// Calculate relative rotation
-	float DeltaYaw = FMath::FindDeltaAngleDegrees(ActorRotation.Yaw, LookAtRotation.Yaw);
-	float DeltaPitch = LookAtRotation.Pitch;
-
-	// Clamp to maximum values
-	TargetLookAtYaw = FMath::Clamp(DeltaYaw, -MaxLookAtYaw, MaxLookAtYaw);
-	TargetLookAtPitch = FMath::Clamp(DeltaPitch, -MaxLookAtPitch, MaxLookAtPitch);
+	// Resolved in the next thread-safe update
+	bPendingLookAtRotation = false;
+	bPendingLookAtTarget = true;
+	PendingLookAtTarget = WorldLocation;
 }
 
 void UEnemyAnimInstance::SetLookAtRotation(float Yaw, float Pitch)
 {
-	TargetLookAtYaw = FMath::Clamp(Yaw, -MaxLookAtYaw, MaxLookAtYaw);
-	TargetLookAtPitch = FMath::Clamp(Pitch, -MaxLookAtPitch, MaxLookAtPitch);
+	bPendingLookAtTarget = false;
+	bPendingLookAtRotation = true;
+	PendingLookAtRotation = FRotator(Pitch, Yaw, 0.0f);
 }
 
 void UEnemyAnimInstance::ClearLookAt()
 {
-	TargetLookAtYaw = 0.0f;
-	TargetLookAtPitch = 0.0f;
+	SetLookAtRotation(0.0f, 0.0f);
 }
 
 void UEnemyAnimInstance::PlayActionMontage(UAnimMontage* Montage, float PlayRate)
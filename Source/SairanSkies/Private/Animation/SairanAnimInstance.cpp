@@ -17,35 +17,51 @@ void USairanAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 {
 	Super::NativeUpdateAnimation(DeltaSeconds);
 
+	Snapshot.bValid = OwnerCharacter != nullptr;
 	if (!OwnerCharacter) return;
 
+	Snapshot.Velocity = OwnerCharacter->GetVelocity();
+	Snapshot.Rotation = OwnerCharacter->GetActorRotation();
+	Snapshot.bIsFalling = OwnerCharacter->GetCharacterMovement()->IsFalling();
+	Snapshot.bIsSprinting = OwnerCharacter->bIsSprinting;
+	Snapshot.bIsWeaponDrawn = OwnerCharacter->bIsWeaponDrawn;
+
+	// Combat state (se conserva el último valor si no hay CombatComponent)
+	if (OwnerCharacter->CombatComponent)
+	{
+		Snapshot.bIsAttacking = OwnerCharacter->CombatComponent->IsAttacking();
+	}
+}
+
+void USairanAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	if (!Snapshot.bValid) return;
+
 	// Get velocity
-	FVector Velocity = OwnerCharacter->GetVelocity();
+	const FVector& Velocity = Snapshot.Velocity;
 	Speed = Velocity.Size2D();
 
 	// Calculate direction relative to character facing
 	if (Speed > 0.0f)
 	{
-		FRotator ActorRotation = OwnerCharacter->GetActorRotation();
 		Direction = UKismetMathLibrary::NormalizedDeltaRotator(
 			Velocity.ToOrientationRotator(),
-			ActorRotation
+			Snapshot.Rotation
 		).Yaw;
 	}
 
 	// Air state
-	bIsInAir = OwnerCharacter->GetCharacterMovement()->IsFalling();
+	bIsInAir = Snapshot.bIsFalling;
 	VerticalVelocity = Velocity.Z;
 
 	// Sprint state
-	bIsSprinting = OwnerCharacter->bIsSprinting;
+	bIsSprinting = Snapshot.bIsSprinting;
 
 	// Combat state
-	if (OwnerCharacter->CombatComponent)
-	{
-		bIsAttacking = OwnerCharacter->CombatComponent->IsAttacking();
-	}
+	bIsAttacking = Snapshot.bIsAttacking;
 
 	// Weapon state
-	bIsWeaponDrawn = OwnerCharacter->bIsWeaponDrawn;
+	bIsWeaponDrawn = Snapshot.bIsWeaponDrawn;
 }
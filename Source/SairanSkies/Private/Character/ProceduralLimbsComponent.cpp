@@ -1,6 +1,7 @@
 // SairanSkies - Procedural Limbs Component Implementation
 
 #include "Character/ProceduralLimbsComponent.h"
+#include "Core/SairanStats.h"
 #include "Character/SairanCharacter.h"
 #include "Combat/GrappleComponent.h"
 #include "Weapons/WeaponBase.h"
@@ -13,9 +14,11 @@
 #include "Character/UltimateComponent.h"
 #include "Camera/CameraComponent.h"
 #include "DrawDebugHelpers.h"
-#include "Materials/MaterialInstanceDynamic.h"
+#include "Core/HitFlashSubsystem.h"
 #include "Materials/Material.h"
 
+DECLARE_CYCLE_STAT(TEXT("Procedural Limbs Tick"), STAT_Sairan_ProceduralLimbsTick, STATGROUP_SairanVFX);
+
 // ── UE5 BasicShapes dimensions at scale 1.0 ─────────────────────────────────
 //   Sphere   : radius  50 (diameter 100)
 //   Cone     : height 100 (from base at -50Z to tip at +50Z), base radius 50
@@ -143,6 +146,8 @@ void UProceduralLimbsComponent::BeginPlay()
 void UProceduralLimbsComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 	FActorComponentTickFunction* ThisTickFunction)
 {
+	SAIRAN_SCOPE(STAT_Sairan_ProceduralLimbsTick, VFX);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	if (!bInitialized || !OwnerCharacter) return;
@@ -606,75 +611,17 @@ FVector UProceduralLimbsComponent::SolveTwoBoneIK(
 
 void UProceduralLimbsComponent::StartHitFlash()
 {
-	// Crear instancia de material de flash rojo la primera vez
-	if (!FlashMaterialInstance)
-	{
-		UMaterial* Base = LoadObject<UMaterial>(
-			nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
-		if (!Base) return;
-		FlashMaterialInstance = UMaterialInstanceDynamic::Create(Base, this);
-		if (FlashMaterialInstance)
-			FlashMaterialInstance->SetVectorParameterValue(FName("Color"), HitFlashColor);
-	}
-	if (!FlashMaterialInstance) return;
-
-	// Cachear materiales originales la primera vez — uno por componente
-	if (!bMaterialsCached)
-	{
-		if (BodySphere) OrigBodyMat  = BodySphere->GetMaterial(0);
-		if (RightHand)  OrigHandRMat = RightHand->GetMaterial(0);
-		if (LeftHand)   OrigHandLMat = LeftHand->GetMaterial(0);
-		if (RightFoot)  OrigFootRMat = RightFoot->GetMaterial(0);
-		if (LeftFoot)   OrigFootLMat = LeftFoot->GetMaterial(0);
-		if (TashMesh)
-		{
-			OrigTashMats.Empty();
-			for (int32 i = 0; i < TashMesh->GetNumMaterials(); i++)
-				OrigTashMats.Add(TashMesh->GetMaterial(i));
-		}
-		bMaterialsCached = true;
-	}
-
-	// Aplicar flash a primitivas estáticas
-	if (BodySphere) BodySphere->SetMaterial(0, FlashMaterialInstance);
-	if (RightHand)  RightHand->SetMaterial(0, FlashMaterialInstance);
-	if (LeftHand)   LeftHand->SetMaterial(0, FlashMaterialInstance);
-	if (RightFoot)  RightFoot->SetMaterial(0, FlashMaterialInstance);
-	if (LeftFoot)   LeftFoot->SetMaterial(0, FlashMaterialInstance);
-
-	// Aplicar flash a TashMesh (todos los slots)
-	if (TashMesh)
-	{
-		for (int32 i = 0; i < TashMesh->GetNumMaterials(); i++)
-			TashMesh->SetMaterial(i, FlashMaterialInstance);
-	}
-
-	// Programar restauración
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(HitFlashTimerHandle);
-		World->GetTimerManager().SetTimer(HitFlashTimerHandle, this,
-			&UProceduralLimbsComponent::StopHitFlash, HitFlashDuration, false);
-	}
-}
-
-void UProceduralLimbsComponent::StopHitFlash()
-{
-	if (!bMaterialsCached) return;
-
-	// Restaurar primitivas estáticas
-	if (BodySphere && OrigBodyMat)  BodySphere->SetMaterial(0, OrigBodyMat);
-	if (RightHand  && OrigHandRMat) RightHand->SetMaterial(0, OrigHandRMat);
-	if (LeftHand   && OrigHandLMat) LeftHand->SetMaterial(0, OrigHandLMat);
-	if (RightFoot  && OrigFootRMat) RightFoot->SetMaterial(0, OrigFootRMat);
-	if (LeftFoot   && OrigFootLMat) LeftFoot->SetMaterial(0, OrigFootLMat);
+	UWorld* World = GetWorld();
+	UHitFlashSubsystem* HitFlash = World ? World->GetSubsystem<UHitFlashSubsystem>() : nullptr;
+	if (!HitFlash) return;
 
-	// Restaurar TashMesh
-	if (TashMesh)
+	// Sin cambio de materiales: los materiales de las extremidades leen el flash
+	UPrimitiveComponent* const Limbs[] = { BodySphere, RightHand, LeftHand, RightFoot, LeftFoot, TashMesh };
+	for (UPrimitiveComponent* Limb : Limbs)
 	{
-		for (int32 i = 0; i < OrigTashMats.Num() && i < TashMesh->GetNumMaterials(); i++)
+		if (Limb)
 		{
-			if (OrigTashMats[i]) TashMesh->SetMaterial(i, OrigTashMats[i]);
+			HitFlash->Flash(Limb, HitFlashColor, HitFlashDuration);
 		}
 	}
 }
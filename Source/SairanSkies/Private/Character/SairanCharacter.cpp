@@ -1,6 +1,7 @@
 // SairanSkies - Character Principal Implementation
 
 #include "Character/SairanCharacter.h"
+#include "Character/SairanCharacterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -25,10 +26,13 @@
 #include "NiagaraSystem.h"
 #include "Sound/SoundBase.h"
 
-ASairanCharacter::ASairanCharacter()
+ASairanCharacter::ASairanCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USairanCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	PrimaryActorTick.bCanEverTick = true;
 
+	SairanMovement = Cast<USairanCharacterMovementComponent>(GetCharacterMovement());
+
 	// Capsule setup
 	// Sphere hitbox: radius == half-height → perfect sphere at 1.5m total height (150 units)
 	GetCapsuleComponent()->InitCapsuleSize(75.0f, 75.0f);
@@ -188,6 +192,12 @@ void ASairanCharacter::BeginPlay()
 	}
 
 
+	// El dash lo integra el movimiento; aquí solo se cierra el estado
+	if (SairanMovement)
+	{
+		SairanMovement->OnDashFinished.AddUObject(this, &ASairanCharacter::HandleDashFinished);
+	}
+
 	// Spawn weapon
 	SpawnWeapon();
 
@@ -223,6 +233,9 @@ float ASairanCharacter::TakeDamage(float DamageAmount, struct FDamageEvent const
 {
 	if (CurrentHealth <= 0.0f) return 0.0f;
 
+	// bCanBeDamaged = false (benchmarks, cheats): ignore everything
+	if (!CanBeDamaged()) return 0.0f;
+
 	// Dash i-frames: invulnerable during dash
 	if (bIsDashing || CurrentState == ECharacterState::Dashing)
 	{
@@ -409,8 +422,8 @@ void ASairanCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCom
 
 void ASairanCharacter::Landed(const FHitResult& Hit)
 {
+	// CurrentJumpCount se reinicia en USairanCharacterMovementComponent al tocar suelo
 	Super::Landed(Hit);
-	CurrentJumpCount = 0;
 
 	// Check if we should suppress landing SFX (after teleport)
 	if (bSuppressLandingSFX)
@@ -496,7 +509,10 @@ void ASairanCharacter::JumpStart(const FInputActionValue& Value)
 		if (CurrentJumpCount > 0)
 		{
 			// Double jump - reset velocity for consistent jump height
-			LaunchCharacter(FVector(0, 0, GetCharacterMovement()->JumpZVelocity), false, true);
+			if (SairanMovement)
+			{
+				SairanMovement->DoAirJump();
+			}
 			
 			// Double jump SFX/VFX
 			if (DoubleJumpSound)
@@ -679,11 +695,15 @@ void ASairanCharacter::PerformDash()
 
 	DashDirection = DashDir;
 
-	// Calculate dash velocity
-	FVector DashVelocity = DashDir * (DashDistance / DashDuration);
-	
-	// Launch character
-	LaunchCharacter(DashVelocity, true, true);
+	// Constant-speed dash mode; HandleDashFinished runs when it ends
+	if (SairanMovement)
+	{
+		SairanMovement->StartDash(DashDir, DashDistance, DashDuration);
+	}
+	if (!SairanMovement || !SairanMovement->IsDashing())
+	{
+		HandleDashFinished();
+	}
 
 	// Dash SFX
 	if (DashSound)
@@ -698,14 +718,6 @@ void ASairanCharacter::PerformDash()
 			DashDir.Rotation(), FVector(1.0f), true, true);
 	}
 
-	// End dash after duration
-	FTimerHandle DashEndTimer;
-	GetWorld()->GetTimerManager().SetTimer(DashEndTimer, [this]()
-	{
-		bIsDashing = false;
-		SetCharacterState(ECharacterState::Idle);
-	}, DashDuration, false);
-
 	// Start cooldown
 	GetWorld()->GetTimerManager().SetTimer(DashCooldownTimer, this, &ASairanCharacter::ResetDash, DashCooldown, false);
 }
@@ -715,6 +727,12 @@ void ASairanCharacter::ResetDash()
 	bCanDash = true;
 }
 
+void ASairanCharacter::HandleDashFinished()
+{
+	bIsDashing = false;
+	SetCharacterState(ECharacterState::Idle);
+}
+
 // ========== WEAPON FUNCTIONS ==========
 
 void ASairanCharacter::SpawnWeapon()
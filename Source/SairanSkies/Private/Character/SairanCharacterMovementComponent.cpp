@@ -0,0 +1,348 @@
+// SairanSkies - Sairan Character Movement Component
+
+#include "Character/SairanCharacterMovementComponent.h"
+#include "Character/SairanCharacter.h"
+#include "Core/SairanStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Player Movement"), STAT_Sairan_PlayerMovement, STATGROUP_SairanTraversal);
+
+void USairanCharacterMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	SAIRAN_SCOPE(STAT_Sairan_PlayerMovement, Traversal);
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+}
+
+// ── Grapple ───────────────────────────────────────────────────────────────────
+
+void USairanCharacterMovementComponent::StartGrapple(const FSairanGrapplePull& Pull)
+{
+	if (!HasValidData())
+	{
+		return;
+	}
+
+	ActivePull = Pull;
+
+	// Plano de suelta: perpendicular a la dirección de disparo y por el ancla
+	const FVector Start = UpdatedComponent->GetComponentLocation();
+	GrapplePlaneNormal = (Pull.TargetPoint - Start).GetSafeNormal();
+	InitialPullDistance = FMath::Max(FVector::Dist(Start, Pull.TargetPoint), 1.0f);
+	DampeningTimeRemaining = 0.0f;
+
+	// Todos los tirones parten del mismo estado, sin la inercia previa
+	Velocity = GetPullDirection(Start) * Pull.PullSpeed;
+
+	SetMovementMode(MOVE_Custom, static_cast<uint8>(ESairanMovementMode::Grapple));
+}
+
+void USairanCharacterMovementComponent::StopGrapple()
+{
+	if (IsGrappling() || IsGrappleReleasing())
+	{
+		SetMovementMode(MOVE_Falling);
+	}
+}
+
+FVector USairanCharacterMovementComponent::GetPullDirection(const FVector& Location) const
+{
+	// Apuntar un poco por debajo del ancla para no chocar con la superficie
+	FRotator Direction = (ActivePull.TargetPoint - Location).GetSafeNormal().Rotation();
+	Direction.Pitch -= ActivePull.AngleOffset;
+	return Direction.Vector();
+}
+
+void USairanCharacterMovementComponent::ReleaseGrapple(float RemainingTime, int32 Iterations)
+{
+	SetMovementMode(MOVE_Custom, static_cast<uint8>(ESairanMovementMode::GrappleRelease));
+	OnGrappleReleased.Broadcast();
+
+	// Listeners may have cancelled the grapple; simulate whatever mode is left
+	StartNewPhysics(RemainingTime, Iterations);
+}
+
+void USairanCharacterMovementComponent::PhysGrapple(float deltaTime, int32 Iterations)
+{
+	if (deltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	float RemainingTime = deltaTime;
+	while (RemainingTime >= MIN_TICK_TIME && Iterations < MaxSimulationIterations && HasValidData())
+	{
+		Iterations++;
+		const float TimeTick = FMath::Min(RemainingTime, MaxCustomSubstep);
+		RemainingTime -= TimeTick;
+		bJustTeleported = false;
+
+		const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+
+		// Signed distance to the release plane; released ReleaseDistance before crossing it
+		if (FVector::DotProduct(OldLocation - ActivePull.TargetPoint, GrapplePlaneNormal) >= -ActivePull.ReleaseDistance)
+		{
+			ReleaseGrapple(RemainingTime + TimeTick, Iterations);
+			return;
+		}
+
+		// Más velocidad lejos del ancla, menos al llegar (llegada suave)
+		const FVector PullDirection = GetPullDirection(OldLocation);
+		const float DistanceRatio = FMath::Clamp(FVector::Dist(OldLocation, ActivePull.TargetPoint) / InitialPullDistance, MinPullSpeedRatio, 1.0f);
+		const FVector DesiredVelocity = PullDirection * ActivePull.PullSpeed * DistanceRatio;
+
+		// Exact exponential steer: the same curve whatever the frame rate
+		Velocity = FMath::Lerp(Velocity, DesiredVelocity, 1.0f - FMath::Exp(-GrappleSteering * TimeTick));
+
+		FRotator TargetRotation = PullDirection.Rotation();
+		TargetRotation.Pitch = 0.0f;
+		TargetRotation.Roll = 0.0f;
+		const FQuat NewRotation = FMath::RInterpTo(UpdatedComponent->GetComponentRotation(), TargetRotation, TimeTick, GrappleRotationSpeed).Quaternion();
+
+		const FVector Delta = Velocity * TimeTick;
+		FHitResult Hit(1.0f);
+		SafeMoveUpdatedComponent(Delta, NewRotation, true, Hit);
+
+		if (Hit.IsValidBlockingHit())
+		{
+			// De frente contra una pared: soltar aquí en vez de empujar contra ella
+			if (FVector::DotProduct(Velocity.GetSafeNormal(), Hit.Normal) <= GrappleHeadOnHitDot)
+			{
+				ReleaseGrapple(RemainingTime + TimeTick * (1.0f - Hit.Time), Iterations);
+				return;
+			}
+
+			HandleImpact(Hit, TimeTick, Delta);
+			SlideAlongSurface(Delta, 1.0f - Hit.Time, Hit.Normal, Hit, true);
+		}
+
+		// Velocity follows what the capsule actually did (slides, blocks)
+		if (!bJustTeleported)
+		{
+			Velocity = (UpdatedComponent->GetComponentLocation() - OldLocation) / TimeTick;
+		}
+	}
+}
+
+void USairanCharacterMovementComponent::PhysGrappleRelease(float deltaTime, int32 Iterations)
+{
+	if (deltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	// Exact decay of the horizontal velocity (gravity keeps the vertical one)
+	const float DampenedTime = FMath::Min(deltaTime, DampeningTimeRemaining);
+	if (ActivePull.DampeningDuration > 0.0f && DampenedTime > 0.0f)
+	{
+		const float Decay = FMath::Exp(-(ActivePull.DampeningFactor / ActivePull.DampeningDuration) * DampenedTime);
+		Velocity.X *= Decay;
+		Velocity.Y *= Decay;
+	}
+
+	DampeningTimeRemaining -= deltaTime;
+	if (DampeningTimeRemaining <= 0.0f)
+	{
+		// Frenada terminada: caída normal
+		DampeningTimeRemaining = 0.0f;
+		SetMovementMode(MOVE_Falling);
+		StartNewPhysics(deltaTime, Iterations);
+		return;
+	}
+
+	// IsFalling() is true in this mode, so PhysFalling lands us as usual
+	PhysFalling(deltaTime, Iterations);
+}
+
+// ── Dash ──────────────────────────────────────────────────────────────────────
+
+void USairanCharacterMovementComponent::StartDash(const FVector& Direction, float Distance, float Duration)
+{
+	if (!HasValidData() || Duration <= 0.0f)
+	{
+		return;
+	}
+
+	bDashOnGround = IsMovingOnGround();
+	DashVelocity = Direction.GetSafeNormal2D() * (Distance / Duration);
+	DashTimeRemaining = Duration;
+	Velocity = DashVelocity;
+
+	SetMovementMode(MOVE_Custom, static_cast<uint8>(ESairanMovementMode::Dash));
+}
+
+void USairanCharacterMovementComponent::PhysDash(float deltaTime, int32 Iterations)
+{
+	if (deltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	float RemainingTime = deltaTime;
+	while (RemainingTime >= MIN_TICK_TIME && Iterations < MaxSimulationIterations && HasValidData())
+	{
+		if (DashTimeRemaining <= 0.0f)
+		{
+			// Dash terminado: conserva la velocidad y deja frenar al modo normal
+			SetMovementMode(bDashOnGround ? MOVE_Walking : MOVE_Falling);
+			StartNewPhysics(RemainingTime, Iterations);
+			return;
+		}
+
+		Iterations++;
+		const float TimeTick = FMath::Min3(RemainingTime, MaxCustomSubstep, DashTimeRemaining);
+		RemainingTime -= TimeTick;
+		DashTimeRemaining -= TimeTick;
+		bJustTeleported = false;
+
+		const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+		const FVector Delta = DashVelocity * TimeTick;
+
+		FHitResult Hit(1.0f);
+		SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+		if (Hit.IsValidBlockingHit())
+		{
+			// Bordillos / escalones: sube como PhysWalking en vez de quedarse atascado
+			if (bDashOnGround && !IsWalkable(Hit) && CanStepUp(Hit)
+				&& StepUp(GetGravityDirection(), Delta * (1.0f - Hit.Time), Hit, nullptr))
+			{
+				// The step's vertical offset is not dash velocity
+				bJustTeleported = true;
+			}
+			else
+			{
+				HandleImpact(Hit, TimeTick, Delta);
+				SlideAlongSurface(Delta, 1.0f - Hit.Time, Hit.Normal, Hit, true);
+			}
+		}
+
+		if (bDashOnGround)
+		{
+			FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, false);
+			if (!CurrentFloor.IsWalkableFloor())
+			{
+				// Se acabó el suelo: el dash termina y cae con su inercia
+				Velocity = DashVelocity;
+				SetMovementMode(MOVE_Falling);
+				StartNewPhysics(RemainingTime, Iterations);
+				return;
+			}
+			AdjustFloorHeight();
+		}
+
+		Velocity = bJustTeleported ? DashVelocity : (UpdatedComponent->GetComponentLocation() - OldLocation) / TimeTick;
+	}
+}
+
+// ── Jump ──────────────────────────────────────────────────────────────────────
+
+void USairanCharacterMovementComponent::DoAirJump()
+{
+	if (!HasValidData())
+	{
+		return;
+	}
+
+	Velocity.Z = JumpZVelocity;
+
+	if (IsGrappling())
+	{
+		// Saltar durante el tirón suelta la cuerda (frenada incluida)
+		SetMovementMode(MOVE_Custom, static_cast<uint8>(ESairanMovementMode::GrappleRelease));
+		OnGrappleReleased.Broadcast();
+	}
+	else if (!IsGrappleReleasing())
+	{
+		SetMovementMode(MOVE_Falling);
+	}
+}
+
+// ── Movement mode ─────────────────────────────────────────────────────────────
+
+bool USairanCharacterMovementComponent::IsFalling() const
+{
+	return Super::IsFalling() || IsGrappling() || IsGrappleReleasing();
+}
+
+float USairanCharacterMovementComponent::GetMaxSpeed() const
+{
+	if (MovementMode == MOVE_Custom)
+	{
+		switch (static_cast<ESairanMovementMode>(CustomMovementMode))
+		{
+			case ESairanMovementMode::Grapple:
+				return ActivePull.PullSpeed;
+			case ESairanMovementMode::GrappleRelease:
+				return MaxWalkSpeed;
+			case ESairanMovementMode::Dash:
+				return DashVelocity.Size();
+			default:
+				break;
+		}
+	}
+	return Super::GetMaxSpeed();
+}
+
+float USairanCharacterMovementComponent::GetMaxBrakingDeceleration() const
+{
+	return IsGrappleReleasing() ? BrakingDecelerationFalling : Super::GetMaxBrakingDeceleration();
+}
+
+void USairanCharacterMovementComponent::PhysCustom(float deltaTime, int32 Iterations)
+{
+	switch (static_cast<ESairanMovementMode>(CustomMovementMode))
+	{
+		case ESairanMovementMode::Grapple:
+			PhysGrapple(deltaTime, Iterations);
+			break;
+		case ESairanMovementMode::GrappleRelease:
+			PhysGrappleRelease(deltaTime, Iterations);
+			break;
+		case ESairanMovementMode::Dash:
+			PhysDash(deltaTime, Iterations);
+			break;
+		default:
+			Super::PhysCustom(deltaTime, Iterations);
+			break;
+	}
+}
+
+void USairanCharacterMovementComponent::PhysicsRotation(float DeltaTime)
+{
+	// The pull rotates the capsule inside its own sweep
+	if (IsGrappling())
+	{
+		return;
+	}
+	Super::PhysicsRotation(DeltaTime);
+}
+
+void USairanCharacterMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
+{
+	Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+
+	ASairanCharacter* SairanCharacter = Cast<ASairanCharacter>(CharacterOwner);
+
+	if (IsMovingOnGround())
+	{
+		// En el suelo se recuperan todos los saltos
+		if (SairanCharacter) SairanCharacter->CurrentJumpCount = 0;
+	}
+	else if (IsGrappling())
+	{
+		// Ya en el aire: el primer salto disponible es el aéreo
+		if (SairanCharacter) SairanCharacter->CurrentJumpCount = FMath::Max(SairanCharacter->CurrentJumpCount, 1);
+	}
+	else if (IsGrappleReleasing())
+	{
+		// Solo un salto extra tras el gancho (MaxJumps - 1)
+		DampeningTimeRemaining = ActivePull.DampeningDuration;
+		if (SairanCharacter) SairanCharacter->CurrentJumpCount = 1;
+	}
+
+	const bool bWasDashing = PreviousMovementMode == MOVE_Custom && PreviousCustomMode == static_cast<uint8>(ESairanMovementMode::Dash);
+	if (bWasDashing && !IsDashing())
+	{
+		OnDashFinished.Broadcast();
+	}
+}
@@ -1,6 +1,7 @@
 // SairanSkies - Combat Component Implementation
 
 #include "Combat/CombatComponent.h"
+#include "Core/SairanStats.h"
 #include "Character/SairanCharacter.h"
 #include "Combat/TargetingComponent.h"
 #include "Animation/AnimInstance.h"
@@ -22,6 +23,9 @@
 
 #include <initializer_list>
 
+DECLARE_CYCLE_STAT(TEXT("Combat Tick"), STAT_Sairan_CombatTick, STATGROUP_SairanCombat);
+DECLARE_CYCLE_STAT(TEXT("Hit Detection"), STAT_Sairan_HitDetection, STATGROUP_SairanCombat);
+
 UCombatComponent::UCombatComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -53,6 +57,8 @@ void UCombatComponent::BeginPlay()
 
 void UCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	SAIRAN_SCOPE(STAT_Sairan_CombatTick, Combat);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	// Update charge time when holding heavy attack
@@ -477,6 +483,8 @@ void UCombatComponent::DisableHitDetection()
 
 void UCombatComponent::PerformHitDetection()
 {
+	SAIRAN_SCOPE(STAT_Sairan_HitDetection, Combat);
+
 	if (!OwnerCharacter) return;
 
 	// Calculate hit detection position - in front of character, elevated to avoid ground
@@ -498,6 +506,7 @@ void UCombatComponent::PerformHitDetection()
 	// Debug visualization
 	EDrawDebugTrace::Type DebugType = bShowHitDebug ? EDrawDebugTrace::ForOneFrame : EDrawDebugTrace::None;
 
+	SAIRAN_COUNT(STAT_Sairan_CombatTraces, TracesIssued, 1);
 	bool bHit = UKismetSystemLibrary::SphereTraceMulti(
 		GetWorld(),
 		TraceStart,
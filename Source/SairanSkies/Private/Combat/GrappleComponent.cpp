@@ -1,7 +1,11 @@
 // SairanSkies - Grapple Hook Component Implementation Complete
 
 #include "Combat/GrappleComponent.h"
+#include "Combat/GrapplePointComponent.h"
+#include "Combat/GrapplePointSubsystem.h"
+#include "Core/SairanStats.h"
 #include "Character/SairanCharacter.h"
+#include "Character/SairanCharacterMovementComponent.h"
 #include "Weapons/GrappleHookActor.h"
 #include "UI/GrappleCrosshairWidget.h"
 #include "GameFramework/SpringArmComponent.h"
@@ -14,9 +18,18 @@
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/GameViewportClient.h"
+#include "SceneView.h"
+#include "SceneManagement.h"
+#include "ConvexVolume.h"
 #include "Components/AudioComponent.h"
 #include "CableComponent.h"
 
+DECLARE_CYCLE_STAT(TEXT("Grapple Tick"), STAT_Sairan_GrappleTick, STATGROUP_SairanTraversal);
+DECLARE_CYCLE_STAT(TEXT("Grapple Aim Trace"), STAT_Sairan_GrappleAimTrace, STATGROUP_SairanTraversal);
+DECLARE_CYCLE_STAT(TEXT("Find Best Grapple Target"), STAT_Sairan_FindBestGrappleTarget, STATGROUP_SairanTraversal);
+
 UGrappleComponent::UGrappleComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -41,11 +54,24 @@ void UGrappleComponent::BeginPlay()
 		bOriginalEnableCameraLag = OwnerCharacter->CameraBoom->bEnableCameraLag;
 	}
 
-	// Store original rotation setting and gravity
+	// Store original rotation setting
 	if (OwnerCharacter && OwnerCharacter->GetCharacterMovement())
 	{
 		bOriginalOrientRotationToMovement = OwnerCharacter->GetCharacterMovement()->bOrientRotationToMovement;
-		OriginalGravityScale = OwnerCharacter->GetCharacterMovement()->GravityScale;
+	}
+
+	// El tirón y la frenada los integra el movimiento; aquí solo se reacciona a la suelta
+	SairanMovement = OwnerCharacter ? OwnerCharacter->GetSairanMovement() : nullptr;
+	if (SairanMovement)
+	{
+		SairanMovement->OnGrappleReleased.AddUObject(this, &UGrappleComponent::HandleGrappleReleased);
+	}
+
+	// Anclajes registrados; los actores con GrappleTag se recogen una vez por nivel
+	GrapplePoints = GetWorld()->GetSubsystem<UGrapplePointSubsystem>();
+	if (GrapplePoints)
+	{
+		GrapplePoints->RegisterTaggedActors(GrappleTag);
 	}
 
 	// Spawn the grapple hook visual actor
@@ -57,6 +83,8 @@ void UGrappleComponent::BeginPlay()
 
 void UGrappleComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	SAIRAN_SCOPE(STAT_Sairan_GrappleTick, Traversal);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	switch (CurrentState)
@@ -71,12 +99,8 @@ void UGrappleComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 			UpdatePulling(DeltaTime);
 			break;
 		case EGrappleState::Releasing:
-			// Apply velocity dampening after grapple release
-			if (bIsDampeningVelocity)
-			{
-				UpdateVelocityDampening(DeltaTime);
-			}
-			else
+			// The movement component dampens the velocity after the release
+			if (!SairanMovement || !SairanMovement->IsGrappleReleasing())
 			{
 				// Dampening finished - grapple is now available to use again
 				// Reset to Idle immediately (don't wait for landing)
@@ -192,6 +216,7 @@ void UGrappleComponent::StopAiming()
 	bHasValidTarget = false;
 	AimTargetLocation = FVector::ZeroVector;
 	CurrentSoftLockTarget = nullptr;
+	SoftLockAnchor.Reset();
 
 	OnGrappleAimEnd.Broadcast();
 
@@ -211,17 +236,7 @@ void UGrappleComponent::FireGrapple()
 	}
 
 	// Store grapple data
-	GrappleStartPoint = OwnerCharacter->GetActorLocation();
 	GrappleTargetPoint = AimTargetLocation;
-	InitialDistanceToTarget = FVector::Dist(GrappleStartPoint, GrappleTargetPoint);
-
-	// Calculate midpoint (where we'll release) - it's the horizontal position of the target
-	GrappleMidpoint = GrappleTargetPoint;
-
-	// Build the release plane: perpendicular to the grapple direction, centred on the target.
-	// Normal = unit vector from player to target at fire time.
-	// Player is released as soon as they cross this plane (reach the target's "altitude layer").
-	GrapplePlaneNormal = (GrappleTargetPoint - GrappleStartPoint).GetSafeNormal();
 
 	SetState(EGrappleState::Pulling);
 
@@ -249,22 +264,23 @@ void UGrappleComponent::FireGrapple()
 	if (OwnerCharacter->GetCharacterMovement())
 	{
 		OwnerCharacter->GetCharacterMovement()->bOrientRotationToMovement = bOriginalOrientRotationToMovement;
-		// Disable gravity during pull for clean, direct movement
-		OwnerCharacter->GetCharacterMovement()->GravityScale = 0.0f;
-		
-		// Reset velocity to zero so all grapples start from a clean state
-		// This prevents momentum from affecting the grapple trajectory
-		OwnerCharacter->GetCharacterMovement()->Velocity = FVector::ZeroVector;
 	}
 	OwnerCharacter->bUseControllerRotationYaw = false;
 
-	// Calculate direction with angle offset (like Batman - hook retracting)
-	FVector GrappleDirection = CalculateGrappleDirection();
-	
-	// Use LaunchCharacter for physics-based movement (like Batman Arkham)
-	// This gives a natural arc and respects collision
-	FVector LaunchVelocity = GrappleDirection * GrapplePullSpeed;
-	OwnerCharacter->LaunchCharacter(LaunchVelocity, true, true);
+	// Pull mode of the movement component (like Batman - hook retracting): no gravity,
+	// aimed GrappleAngleOffset below the target, released before the release plane
+	if (SairanMovement)
+	{
+		FSairanGrapplePull Pull;
+		Pull.TargetPoint = GrappleTargetPoint;
+		Pull.PullSpeed = GrapplePullSpeed;
+		Pull.AngleOffset = GrappleAngleOffset;
+		// Baked clearance before the anchor (only known for the soft-locked anchor)
+		Pull.ReleaseDistance = MidpointReleaseDistance + (CurrentSoftLockTarget ? SoftLockReleaseDistance : 0.0f);
+		Pull.DampeningFactor = DampeningFactor;
+		Pull.DampeningDuration = DampeningDuration;
+		SairanMovement->StartGrapple(Pull);
+	}
 
 	// Lock camera during pull (sense of being dragged)
 	LockCamera();
@@ -295,13 +311,7 @@ void UGrappleComponent::CancelGrapple()
 		return;
 	}
 
-	// Restore movement and gravity
-	if (OwnerCharacter && OwnerCharacter->GetCharacterMovement())
-	{
-		OwnerCharacter->GetCharacterMovement()->SetMovementMode(MOVE_Falling);
-		OwnerCharacter->GetCharacterMovement()->GravityScale = OriginalGravityScale;
-	}
-
+	// ResetGrapple hands the character back to normal falling
 	ResetGrapple();
 
 	if (bShowDebug)
@@ -315,7 +325,8 @@ void UGrappleComponent::CancelGrapple()
 void UGrappleComponent::UpdateAiming(float DeltaTime)
 {
 	// PRIORITY 1: Aim assist - find tagged grappleable targets in screen area
-	AActor* BestTarget = FindBestGrappleTarget();
+	FVector DesiredLocation;
+	AActor* BestTarget = FindBestGrappleTarget(DesiredLocation);
 	
 	if (BestTarget)
 	{
@@ -324,7 +335,6 @@ void UGrappleComponent::UpdateAiming(float DeltaTime)
 		bHasValidTarget = true;
 		
 		// Smooth interpolation towards the target for "sticky" feel
-		FVector DesiredLocation = BestTarget->GetActorLocation();
 		AimTargetLocation = FMath::VInterpTo(AimTargetLocation, DesiredLocation, DeltaTime, AimAssistStickySpeed);
 
 		if (bShowDebug)
@@ -341,6 +351,7 @@ void UGrappleComponent::UpdateAiming(float DeltaTime)
 	// This catches surfaces/actors with the Grapple tag that aren't picked up by aim assist,
 	// or any surface if bRequireGrappleTag is false
 	CurrentSoftLockTarget = nullptr;
+	SoftLockAnchor.Reset();
 
 	FHitResult HitResult = PerformAimTrace();
 	
@@ -383,83 +394,63 @@ void UGrappleComponent::UpdatePulling(float DeltaTime)
 		return;
 	}
 
-	// Check if we've passed the midpoint
-	if (HasPassedMidpoint())
+	// The pull itself runs in the movement component; if something else took the
+	// character out of it (jump, knockback, teleport), drop the grapple
+	if (!SairanMovement || !SairanMovement->IsGrappling())
 	{
-		// Release - let physics take over naturally
-		SetState(EGrappleState::Releasing);
-		
-		// Restore gravity so physics takes over naturally
-		if (OwnerCharacter->GetCharacterMovement())
-		{
-			OwnerCharacter->GetCharacterMovement()->GravityScale = OriginalGravityScale;
-		}
-		
-		// Unlock camera (player can control again)
-		UnlockCamera();
-		
-		// Stop particle trail
-		StopGrappleTrailParticles();
+		ResetGrapple();
+		return;
+	}
 
-		// Ocultar la cuerda al soltar el gancho
-		StopGrappleRope();
+	// Actualizar la posición de la cuerda visual cada tick
+	UpdateGrappleRope();
 
-		// Stop pull SFX, play release SFX
-		if (PullingAudioComponent)
-		{
-			PullingAudioComponent->Stop();
-			PullingAudioComponent = nullptr;
-		}
-		if (ReleaseSound && OwnerCharacter)
-		{
-			UGameplayStatics::PlaySoundAtLocation(GetWorld(), ReleaseSound, OwnerCharacter->GetActorLocation());
-		}
+	if (bShowDebug)
+	{
+		DrawDebugLine(GetWorld(), OwnerCharacter->GetActorLocation(), GrappleTargetPoint, FColor::Cyan, false, -1.0f, 0, 3.0f);
+		DrawDebugSphere(GetWorld(), GrappleTargetPoint, 50.0f, 16, FColor::Cyan, false, -1.0f, 0, 2.0f);
+	}
+}
 
-		// Return camera to normal
-		TargetCameraDistance = OwnerCharacter->DefaultCameraDistance;
-		TargetCameraOffset = OriginalCameraOffset;
+void UGrappleComponent::HandleGrappleReleased()
+{
+	if (CurrentState != EGrappleState::Pulling || !OwnerCharacter)
+	{
+		return;
+	}
 
-		// Give only 1 extra jump after grapple (set to MaxJumps - 1)
-		OwnerCharacter->CurrentJumpCount = 1;
+	// Release - the movement component switched to its dampened fall
+	SetState(EGrappleState::Releasing);
 
-		// Start velocity dampening (reduce 80% over 1 second)
-		bIsDampeningVelocity = true;
-		DampeningTimeRemaining = DampeningDuration;
+	// Unlock camera (player can control again)
+	UnlockCamera();
 
-		OnGrappleComplete.Broadcast();
+	// Stop particle trail
+	StopGrappleTrailParticles();
 
-		if (bShowDebug)
-		{
-			GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Blue, TEXT("Grapple: Passed midpoint, releasing"));
-		}
-		return;
-	}
+	// Ocultar la cuerda al soltar el gancho
+	StopGrappleRope();
 
-	// Apply continuous force towards target (like hook retracting - Batman style)
-	FVector GrappleDirection = CalculateGrappleDirection();
-	
-	// Calculate how much force to apply based on distance
-	// More force when far, less when close for smoother arrival
-	float CurrentDistance = FVector::Dist(OwnerCharacter->GetActorLocation(), GrappleTargetPoint);
-	float DistanceRatio = FMath::Clamp(CurrentDistance / InitialDistanceToTarget, 0.3f, 1.0f);
-	
-	// Apply force (physics-based, respects collision)
-	FVector PullForce = GrappleDirection * GrapplePullSpeed * DistanceRatio * DeltaTime * 50.0f;
-	OwnerCharacter->LaunchCharacter(PullForce, false, false);
+	// Stop pull SFX, play release SFX
+	if (PullingAudioComponent)
+	{
+		PullingAudioComponent->Stop();
+		PullingAudioComponent = nullptr;
+	}
+	if (ReleaseSound)
+	{
+		UGameplayStatics::PlaySoundAtLocation(GetWorld(), ReleaseSound, OwnerCharacter->GetActorLocation());
+	}
 
-	// Rotate character to face movement direction
-	FRotator TargetRotation = GrappleDirection.Rotation();
-	TargetRotation.Pitch = 0.0f;
-	TargetRotation.Roll = 0.0f;
-	OwnerCharacter->SetActorRotation(FMath::RInterpTo(OwnerCharacter->GetActorRotation(), TargetRotation, DeltaTime, 10.0f));
+	// Return camera to normal
+	TargetCameraDistance = OwnerCharacter->DefaultCameraDistance;
+	TargetCameraOffset = OriginalCameraOffset;
 
-	// Actualizar la posición de la cuerda visual cada tick
-	UpdateGrappleRope();
+	OnGrappleComplete.Broadcast();
 
 	if (bShowDebug)
 	{
-		DrawDebugLine(GetWorld(), OwnerCharacter->GetActorLocation(), GrappleTargetPoint, FColor::Cyan, false, -1.0f, 0, 3.0f);
-		DrawDebugSphere(GetWorld(), GrappleTargetPoint, 50.0f, 16, FColor::Cyan, false, -1.0f, 0, 2.0f);
+		GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Blue, TEXT("Grapple: Passed midpoint, releasing"));
 	}
 }
 
@@ -492,6 +483,8 @@ void UGrappleComponent::UpdateCamera(float DeltaTime)
 
 FHitResult UGrappleComponent::PerformAimTrace()
 {
+	SAIRAN_SCOPE(STAT_Sairan_GrappleAimTrace, Traversal);
+
 	FHitResult HitResult;
 	
 	if (!OwnerCharacter || !OwnerCharacter->FollowCamera)
@@ -507,8 +500,8 @@ FHitResult UGrappleComponent::PerformAimTrace()
 	FCollisionQueryParams QueryParams;
 	QueryParams.AddIgnoredActor(OwnerCharacter);
 	QueryParams.AddIgnoredActor(GetOwner());
-	QueryParams.bTraceComplex = true;
 
+	SAIRAN_COUNT(STAT_Sairan_TraversalTraces, TracesIssued, 1);
 	GetWorld()->LineTraceSingleByChannel(
 		HitResult,
 		CameraLocation,
@@ -517,10 +510,11 @@ FHitResult UGrappleComponent::PerformAimTrace()
 		QueryParams
 	);
 
-	// Tag filter: only accept hits on actors with the Grapple tag (if required)
+	// Tag filter: only accept hits on grapple actors (tag or UGrapplePointComponent) if required
 	if (bRequireGrappleTag && HitResult.bBlockingHit && HitResult.GetActor())
 	{
-		if (!HitResult.GetActor()->ActorHasTag(GrappleTag))
+		const AActor* HitActor = HitResult.GetActor();
+		if (!HitActor->ActorHasTag(GrappleTag) && !HitActor->FindComponentByClass<UGrapplePointComponent>())
 		{
 			HitResult.bBlockingHit = false;
 		}
@@ -529,130 +523,92 @@ FHitResult UGrappleComponent::PerformAimTrace()
 	return HitResult;
 }
 
-AActor* UGrappleComponent::FindBestGrappleTarget()
+AActor* UGrappleComponent::FindBestGrappleTarget(FVector& OutTargetLocation)
 {
-	if (!OwnerCharacter || !OwnerCharacter->FollowCamera)
+	SAIRAN_SCOPE(STAT_Sairan_FindBestGrappleTarget, Traversal);
+
+	if (!OwnerCharacter || !OwnerCharacter->FollowCamera || !GrapplePoints || GrapplePoints->GetNumPoints() == 0)
 	{
 		return nullptr;
 	}
 
 	APlayerController* PC = Cast<APlayerController>(OwnerCharacter->GetController());
-	if (!PC)
+	const ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+
+	FSceneViewProjectionData Projection;
+	if (!LocalPlayer || !LocalPlayer->ViewportClient ||
+		!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, Projection))
 	{
 		return nullptr;
 	}
 
-	// Get all actors with the Grapple tag
-	TArray<AActor*> GrappleActors;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), GrappleTag, GrappleActors);
+	// One view-projection for the frustum pre-filter and every projection below
+	const FMatrix ViewProjection = Projection.ComputeViewProjectionMatrix();
+	const FIntRect ViewRect = Projection.GetConstrainedViewRect();
+	const FVector2D ScreenCenter = FVector2D(ViewRect.Min) + FVector2D(ViewRect.Size()) * 0.5;
+
+	FConvexVolume Frustum;
+	GetViewFrustumBounds(Frustum, ViewProjection, false);
 
-	if (GrappleActors.Num() == 0)
+	// Only anchors in nearby cells, within range and inside the view
+	const FVector CharacterLocation = OwnerCharacter->GetActorLocation();
+	GrapplePoints->GatherCandidates(CharacterLocation, MaxGrappleRange, Frustum, CandidatePoints);
+	if (CandidatePoints.Num() == 0)
 	{
 		return nullptr;
 	}
 
-	// Get viewport size for screen-space calculations
-	int32 ViewportSizeX, ViewportSizeY;
-	PC->GetViewportSize(ViewportSizeX, ViewportSizeY);
-	FVector2D ScreenCenter(ViewportSizeX * 0.5f, ViewportSizeY * 0.5f);
-
-	AActor* BestTarget = nullptr;
-	float BestScreenDistance = AimAssistScreenRadius; // Only consider targets within this screen radius
-
-	FVector CharacterLocation = OwnerCharacter->GetActorLocation();
-
-	for (AActor* Actor : GrappleActors)
+	// Score by distance to screen centre; the current soft-lock gets hysteresis so it doesn't flicker
+	const USceneComponent* CurrentAnchor = SoftLockAnchor.Get();
+	ScoredCandidates.Reset();
+	for (int32 PointIndex : CandidatePoints)
 	{
-		if (!Actor) continue;
-
-		// Check world-space distance
-		float WorldDistance = FVector::Dist(CharacterLocation, Actor->GetActorLocation());
-		if (WorldDistance > MaxGrappleRange)
-		{
-			continue; // Too far
-		}
-
-		// Check line of sight
-		FHitResult LOSHit;
-		FCollisionQueryParams LOSParams;
-		LOSParams.AddIgnoredActor(OwnerCharacter);
-		LOSParams.AddIgnoredActor(Actor);
-
-		FVector CameraLoc = OwnerCharacter->FollowCamera->GetComponentLocation();
-		bool bBlocked = GetWorld()->LineTraceSingleByChannel(
-			LOSHit,
-			CameraLoc,
-			Actor->GetActorLocation(),
-			ECC_Visibility,
-			LOSParams
-		);
+		const FGrapplePoint& Point = GrapplePoints->GetPoint(PointIndex);
 
-		if (bBlocked && LOSHit.GetActor() != Actor)
-		{
-			continue; // Line of sight blocked
-		}
-
-		// Project actor to screen space
 		FVector2D ScreenPosition;
-		bool bOnScreen = PC->ProjectWorldLocationToScreen(Actor->GetActorLocation(), ScreenPosition, true);
+		if (!FSceneView::ProjectWorldToScreen(Point.Location, ViewRect, ViewProjection, ScreenPosition)) continue;
 
-		if (!bOnScreen)
-		{
-			continue; // Not on screen
-		}
+		const bool bCurrent = CurrentAnchor && Point.Anchor.Get() == CurrentAnchor;
+		const float MaxDistance = bCurrent ? AimAssistScreenRadius * SoftLockRadiusScale : AimAssistScreenRadius;
 
-		// Calculate screen-space distance from center
 		float ScreenDistance = FVector2D::Distance(ScreenCenter, ScreenPosition);
+		if (ScreenDistance >= MaxDistance) continue;
 
-		if (ScreenDistance < BestScreenDistance)
+		if (bCurrent)
 		{
-			BestScreenDistance = ScreenDistance;
-			BestTarget = Actor;
+			ScreenDistance *= SoftLockStickiness;
 		}
-	}
 
-	return BestTarget;
-}
+		// Baked approach (table lookup): a blocked bucket only ranks the anchor lower,
+		// the pull itself still releases on a head-on hit
+		float ReleaseDistance = 0.0f;
+		if (!GrapplePoints->GetApproach(PointIndex, CharacterLocation, ReleaseDistance))
+		{
+			ScreenDistance += BlockedApproachPenalty;
+		}
 
-FVector UGrappleComponent::CalculateGrappleDirection() const
-{
-	if (!OwnerCharacter)
-	{
-		return FVector::ForwardVector;
+		FGrappleCandidate& Candidate = ScoredCandidates.AddDefaulted_GetRef();
+		Candidate.Point = PointIndex;
+		Candidate.ScreenDistance = ScreenDistance;
+		Candidate.ReleaseDistance = ReleaseDistance;
 	}
 
-	FVector CurrentLocation = OwnerCharacter->GetActorLocation();
-	FVector DirectionToTarget = (GrappleTargetPoint - CurrentLocation).GetSafeNormal();
+	ScoredCandidates.Sort([](const FGrappleCandidate& A, const FGrappleCandidate& B) { return A.ScreenDistance < B.ScreenDistance; });
 
-	// Apply angle offset (aim slightly below the target point)
-	// This prevents collision with the surface we're grappling to
-	FRotator DirectionRotator = DirectionToTarget.Rotation();
-	DirectionRotator.Pitch -= GrappleAngleOffset; // Lower the aim by 15 degrees
-	
-	return DirectionRotator.Vector();
-}
-
-bool UGrappleComponent::HasPassedMidpoint() const
-{
-	if (!OwnerCharacter || GrapplePlaneNormal.IsNearlyZero())
+	// Best first: line of sight (baked or cached by the subsystem)
+	const FVector CameraLocation = OwnerCharacter->FollowCamera->GetComponentLocation();
+	for (const FGrappleCandidate& Candidate : ScoredCandidates)
 	{
-		return true;
-	}
-
-	FVector CurrentLocation = OwnerCharacter->GetActorLocation();
+		if (!GrapplePoints->HasLineOfSight(Candidate.Point, CameraLocation, OwnerCharacter)) continue;
 
-	// Release-plane check: the plane is perpendicular to the launch direction and
-	// passes through GrappleTargetPoint (normal = GrapplePlaneNormal).
-	//
-	// Signed distance of the player from the plane:
-	//   Negative  → player is still on the approach side (hasn't crossed yet)
-	//   Zero / +  → player has crossed the plane → release
-	//
-	// We trigger early by MidpointReleaseDistance units so the grapple ends cleanly
-	// before the player collides with the grapple surface.
-	float SignedDist = FVector::DotProduct(CurrentLocation - GrappleTargetPoint, GrapplePlaneNormal);
+		const FGrapplePoint& Point = GrapplePoints->GetPoint(Candidate.Point);
+		SoftLockAnchor = Point.Anchor;
+		SoftLockReleaseDistance = Candidate.ReleaseDistance;
+		OutTargetLocation = Point.Location;
+		return Point.GetActor();
+	}
 
-	return SignedDist >= -MidpointReleaseDistance;
+	return nullptr;
 }
 
 void UGrappleComponent::SetState(EGrappleState NewState)
@@ -666,22 +622,21 @@ void UGrappleComponent::ResetGrapple()
 	bHasValidTarget = false;
 	GrappleTargetPoint = FVector::ZeroVector;
 	AimTargetLocation = FVector::ZeroVector;
-	GrappleStartPoint = FVector::ZeroVector;
-	GrappleMidpoint = FVector::ZeroVector;
-	GrapplePlaneNormal = FVector::ZeroVector;
-	InitialDistanceToTarget = 0.0f;
-	bIsDampeningVelocity = false;
-	DampeningTimeRemaining = 0.0f;
 	CurrentSoftLockTarget = nullptr;
+	SoftLockAnchor.Reset();
 
-	// Restore character rotation behavior and gravity
+	// Leave the pull / release modes (no-op once they have ended)
+	if (SairanMovement)
+	{
+		SairanMovement->StopGrapple();
+	}
+
+	// Restore character rotation behavior
 	if (OwnerCharacter)
 	{
 		if (OwnerCharacter->GetCharacterMovement())
 		{
 			OwnerCharacter->GetCharacterMovement()->bOrientRotationToMovement = bOriginalOrientRotationToMovement;
-			// Ensure gravity is always restored
-			OwnerCharacter->GetCharacterMovement()->GravityScale = OriginalGravityScale;
 		}
 		OwnerCharacter->bUseControllerRotationYaw = false;
 	}
@@ -1047,56 +1002,3 @@ void UGrappleComponent::StopGrappleRope()
 		RopeVisualMesh = nullptr;
 	}
 }
-
-// ─────────────────────────────────────────────────────────────────────────────
-
-void UGrappleComponent::UpdateVelocityDampening(float DeltaTime)
-{
-	if (!OwnerCharacter || !OwnerCharacter->GetCharacterMovement())
-	{
-		bIsDampeningVelocity = false;
-		return;
-	}
-
-	DampeningTimeRemaining -= DeltaTime;
-
-	if (DampeningTimeRemaining <= 0.0f)
-	{
-		// Dampening complete
-		bIsDampeningVelocity = false;
-		DampeningTimeRemaining = 0.0f;
-
-		if (bShowDebug)
-		{
-			GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Yellow, TEXT("Grapple: Velocity dampening complete"));
-		}
-		return;
-	}
-
-	// Calculate how much to reduce velocity this frame
-	// We want to reduce DampeningFactor (80%) of the velocity over DampeningDuration (1 second)
-	// So each frame we reduce: (DampeningFactor / DampeningDuration) * DeltaTime
-	float ReductionThisFrame = (DampeningFactor / DampeningDuration) * DeltaTime;
-
-	// Get current velocity
-	FVector CurrentVelocity = OwnerCharacter->GetCharacterMovement()->Velocity;
-	
-	// Only dampen horizontal velocity (let gravity handle vertical)
-	FVector HorizontalVelocity = FVector(CurrentVelocity.X, CurrentVelocity.Y, 0.0f);
-	FVector VerticalVelocity = FVector(0.0f, 0.0f, CurrentVelocity.Z);
-
-	// Apply reduction to horizontal velocity
-	HorizontalVelocity *= (1.0f - ReductionThisFrame);
-
-	// Combine and set new velocity
-	OwnerCharacter->GetCharacterMovement()->Velocity = HorizontalVelocity + VerticalVelocity;
-
-	if (bShowDebug)
-	{
-		GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, 
-			FString::Printf(TEXT("Grapple: Dampening velocity (%.1f%% remaining)"), 
-				(DampeningTimeRemaining / DampeningDuration) * 100.0f));
-	}
-}
-
-
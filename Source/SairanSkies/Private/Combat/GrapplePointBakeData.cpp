@@ -0,0 +1,135 @@
+// SairanSkies - Grapple Point Bake Data
+
+#include "Combat/GrapplePointBakeData.h"
+#include "Algo/BinarySearch.h"
+
+namespace GrappleBake
+{
+	constexpr int32 NumAzimuthSectors = 8;
+	constexpr int32 NumElevationBands = 4;
+
+	// Band edges in degrees: [-90,-30) [-30,0) [0,30) [30,90]
+	constexpr float ElevationCenters[NumElevationBands] = { -60.0f, -15.0f, 15.0f, 60.0f };
+}
+
+void UGrapplePointBakeData::PostLoad()
+{
+	Super::PostLoad();
+	BuildLookup();
+}
+
+void UGrapplePointBakeData::BuildLookup()
+{
+	PointByLocation.Reset();
+	PointByLocation.Reserve(PointLocations.Num());
+	for (int32 i = 0; i < PointLocations.Num(); ++i)
+	{
+		PointByLocation.Add(QuantizeLocation(PointLocations[i]), i);
+	}
+}
+
+FIntVector UGrapplePointBakeData::QuantizeLocation(const FVector& Location)
+{
+	return FIntVector(
+		FMath::RoundToInt32(Location.X),
+		FMath::RoundToInt32(Location.Y),
+		FMath::RoundToInt32(Location.Z));
+}
+
+int32 UGrapplePointBakeData::FindPoint(const FVector& Location) const
+{
+	const int32* Index = PointByLocation.Find(QuantizeLocation(Location));
+	return Index ? *Index : INDEX_NONE;
+}
+
+// ── Grid ──────────────────────────────────────────────────────────────────────
+
+int32 UGrapplePointBakeData::GetCellIndex(const FVector& Location) const
+{
+	const FVector Local = (Location - GridOrigin) / FMath::Max(CellSize, 1.0f);
+	const int32 X = FMath::FloorToInt32(Local.X);
+	const int32 Y = FMath::FloorToInt32(Local.Y);
+	const int32 Z = FMath::FloorToInt32(Local.Z);
+
+	if (X < 0 || Y < 0 || Z < 0 || X >= GridSize.X || Y >= GridSize.Y || Z >= GridSize.Z)
+	{
+		return INDEX_NONE;
+	}
+	return (Z * GridSize.Y + Y) * GridSize.X + X;
+}
+
+FVector UGrapplePointBakeData::GetCellCenter(int32 CellIndex) const
+{
+	const int32 X = CellIndex % GridSize.X;
+	const int32 Y = (CellIndex / GridSize.X) % GridSize.Y;
+	const int32 Z = CellIndex / (GridSize.X * GridSize.Y);
+	return GridOrigin + (FVector(X, Y, Z) + 0.5) * CellSize;
+}
+
+EGrappleBakedVisibility UGrapplePointBakeData::GetVisibility(const FVector& PlayerLocation, int32 PointIndex) const
+{
+	const int32 Cell = GetCellIndex(PlayerLocation);
+	if (Cell == INDEX_NONE || !CellBaked.IsValidIndex(Cell) || !CellBaked[Cell] || !PointLocations.IsValidIndex(PointIndex))
+	{
+		return EGrappleBakedVisibility::Unknown;
+	}
+
+	const int32 Start = CellStart[Cell];
+	const TArrayView<const uint32> Entries(CellEntries.GetData() + Start, CellStart[Cell + 1] - Start);
+
+	// Entries are sorted by anchor index, so the bare key is a lower bound
+	const uint32 Key = uint32(PointIndex) << 2;
+	const int32 Found = Algo::LowerBound(Entries, Key);
+	if (Entries.IsValidIndex(Found) && (Entries[Found] >> 2) == uint32(PointIndex))
+	{
+		return static_cast<EGrappleBakedVisibility>(Entries[Found] & 3u);
+	}
+
+	// Not listed (out of the baked range or not sampled): no claim either way
+	return EGrappleBakedVisibility::Unknown;
+}
+
+// ── Approach ──────────────────────────────────────────────────────────────────
+
+bool UGrapplePointBakeData::GetApproach(int32 PointIndex, const FVector& From, float& OutReleaseDistance) const
+{
+	OutReleaseDistance = 0.0f;
+	if (!ApproachMasks.IsValidIndex(PointIndex)) return true;
+
+	const int32 Bucket = GetApproachBucket(PointLocations[PointIndex] - From);
+	if (!(ApproachMasks[PointIndex] & (1u << Bucket)))
+	{
+		return false;
+	}
+
+	OutReleaseDistance = ReleaseDistances[PointIndex * NumApproachBuckets + Bucket] * ReleaseDistanceUnit;
+	return true;
+}
+
+int32 UGrapplePointBakeData::GetApproachBucket(const FVector& Direction)
+{
+	const FVector Dir = Direction.GetSafeNormal();
+
+	const float Azimuth = FMath::RadiansToDegrees(FMath::Atan2(Dir.Y, Dir.X)) + 180.0f;
+	const int32 Sector = FMath::Clamp(FMath::FloorToInt32(Azimuth / (360.0f / GrappleBake::NumAzimuthSectors)), 0, GrappleBake::NumAzimuthSectors - 1);
+
+	const float Elevation = FMath::RadiansToDegrees(FMath::Asin(FMath::Clamp(Dir.Z, -1.0, 1.0)));
+	const int32 Band = Elevation < -30.0f ? 0 : Elevation < 0.0f ? 1 : Elevation < 30.0f ? 2 : 3;
+
+	return Band * GrappleBake::NumAzimuthSectors + Sector;
+}
+
+FVector UGrapplePointBakeData::GetApproachDirection(int32 Bucket)
+{
+	const int32 Sector = Bucket % GrappleBake::NumAzimuthSectors;
+	const int32 Band = Bucket / GrappleBake::NumAzimuthSectors;
+
+	const float SectorSize = 360.0f / GrappleBake::NumAzimuthSectors;
+	const float Azimuth = FMath::DegreesToRadians((Sector + 0.5f) * SectorSize - 180.0f);
+	const float Elevation = FMath::DegreesToRadians(GrappleBake::ElevationCenters[Band]);
+
+	return FVector(
+		FMath::Cos(Elevation) * FMath::Cos(Azimuth),
+		FMath::Cos(Elevation) * FMath::Sin(Azimuth),
+		FMath::Sin(Elevation));
+}
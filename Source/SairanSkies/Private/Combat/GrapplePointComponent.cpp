@@ -0,0 +1,45 @@
+// SairanSkies - Grapple Point Component
+
+#include "Combat/GrapplePointComponent.h"
+#include "Combat/GrapplePointSubsystem.h"
+#include "Engine/World.h"
+
+UGrapplePointComponent::UGrapplePointComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// Solo los anclajes que se mueven pagan la actualización
+	bWantsOnUpdateTransform = true;
+}
+
+void UGrapplePointComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UGrapplePointSubsystem* GrapplePoints = GetWorld()->GetSubsystem<UGrapplePointSubsystem>())
+	{
+		GrapplePoints->RegisterPoint(this);
+	}
+}
+
+void UGrapplePointComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGrapplePointSubsystem* GrapplePoints = GetWorld() ? GetWorld()->GetSubsystem<UGrapplePointSubsystem>() : nullptr)
+	{
+		GrapplePoints->UnregisterPoint(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UGrapplePointComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+	if (!HasBegunPlay()) return;
+
+	if (UGrapplePointSubsystem* GrapplePoints = GetWorld()->GetSubsystem<UGrapplePointSubsystem>())
+	{
+		GrapplePoints->UpdatePoint(this);
+	}
+}
@@ -0,0 +1,409 @@
+// SairanSkies - Grapple Point Subsystem
+
+#include "Combat/GrapplePointSubsystem.h"
+#include "Combat/GrapplePointComponent.h"
+#include "Combat/GrapplePointBakeData.h"
+#include "Core/SairanStats.h"
+#include "ConvexVolume.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+
+DECLARE_CYCLE_STAT(TEXT("Grapple Points Tick"), STAT_Sairan_GrapplePointsTick, STATGROUP_SairanTraversal);
+DECLARE_CYCLE_STAT(TEXT("Grapple Points Gather"), STAT_Sairan_GrapplePointsGather, STATGROUP_SairanTraversal);
+DECLARE_CYCLE_STAT(TEXT("Grapple Points Line Of Sight"), STAT_Sairan_GrapplePointsLOS, STATGROUP_SairanTraversal);
+
+void UGrapplePointSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Bake opcional del nivel: sin él todo va por trazas en runtime
+	const FString MapName = UWorld::RemovePIEPrefix(FPackageName::GetShortName(InWorld.GetOutermost()));
+	const FString AssetName = TEXT("GB_") + MapName;
+	const FString ObjectPath = FString::Printf(TEXT("%s/%s.%s"), *BakeDataDirectory, *AssetName, *AssetName);
+	if (!FPackageName::DoesPackageExist(BakeDataDirectory / AssetName))
+	{
+		return;
+	}
+
+	BakeData = LoadObject<UGrapplePointBakeData>(nullptr, *ObjectPath);
+	if (!BakeData) return;
+
+	// Older layouts read unlisted anchors as hidden: ignore them until rebaked
+	if (BakeData->Version != UGrapplePointBakeData::CurrentVersion)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GrapplePointSubsystem: %s is version %d (expected %d), rebake it; using runtime traces"),
+			*ObjectPath, BakeData->Version, UGrapplePointBakeData::CurrentVersion);
+		BakeData = nullptr;
+		return;
+	}
+
+	// Anchors that registered before the bake was loaded
+	int32 NumMatched = 0;
+	for (FGrapplePoint& Point : Points)
+	{
+		Point.BakedIndex = FindBakedIndex(Point.Location);
+		NumMatched += Point.BakedIndex != INDEX_NONE ? 1 : 0;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("GrapplePointSubsystem: loaded %s (%d baked anchors, %d matched)"),
+		*ObjectPath, BakeData->PointLocations.Num(), NumMatched);
+}
+
+void UGrapplePointSubsystem::Deinitialize()
+{
+	for (const TPair<TObjectKey<USceneComponent>, FDelegateHandle>& Pair : MovableTaggedAnchors)
+	{
+		if (USceneComponent* Root = Pair.Key.ResolveObjectPtr())
+		{
+			Root->TransformUpdated.Remove(Pair.Value);
+		}
+	}
+	MovableTaggedAnchors.Empty();
+
+	Points.Empty();
+	IndexByAnchor.Empty();
+	Cells.Empty();
+	RegisteredTags.Empty();
+	QueriedPoints.Empty();
+	PendingTraces.Empty();
+	BakeData = nullptr;
+	Super::Deinitialize();
+}
+
+TStatId UGrapplePointSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGrapplePointSubsystem, STATGROUP_Tickables);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// INTERNAL HELPERS
+// ═══════════════════════════════════════════════════════════════════════════
+
+FIntPoint UGrapplePointSubsystem::ToCell(const FVector& Location) const
+{
+	const float InvCell = 1.0f / FMath::Max(CellSize, 1.0f);
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X * InvCell),
+		FMath::FloorToInt32(Location.Y * InvCell));
+}
+
+void UGrapplePointSubsystem::AddToCell(const FIntPoint& Cell, int32 PointIndex)
+{
+	Cells.FindOrAdd(Cell).Add(PointIndex);
+}
+
+void UGrapplePointSubsystem::RemoveFromCell(const FIntPoint& Cell, int32 PointIndex)
+{
+	if (TArray<int32>* Bucket = Cells.Find(Cell))
+	{
+		Bucket->RemoveSingleSwap(PointIndex, EAllowShrinking::No);
+		if (Bucket->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UGrapplePointSubsystem::RemovePointAt(int32 Index)
+{
+	const int32 LastIndex = Points.Num() - 1;
+
+	RemoveFromCell(Points[Index].Cell, Index);
+	IndexByAnchor.Remove(Points[Index].Key);
+
+	if (Index != LastIndex)
+	{
+		// The last point is about to move into Index: retarget its references
+		FGrapplePoint& Moved = Points[LastIndex];
+		if (TArray<int32>* Bucket = Cells.Find(Moved.Cell))
+		{
+			const int32 Slot = Bucket->IndexOfByKey(LastIndex);
+			if (Slot != INDEX_NONE)
+			{
+				(*Bucket)[Slot] = Index;
+			}
+		}
+		IndexByAnchor.Add(Moved.Key, Index);
+	}
+
+	Points.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+int32 UGrapplePointSubsystem::FindBakedIndex(const FVector& Location) const
+{
+	return BakeData ? BakeData->FindPoint(Location) : INDEX_NONE;
+}
+
+bool UGrapplePointSubsystem::IsPending(const TObjectKey<USceneComponent>& Key) const
+{
+	return PendingTraces.ContainsByPredicate([&Key](const FPendingTrace& Pending) { return Pending.Key == Key; });
+}
+
+FCollisionQueryParams UGrapplePointSubsystem::MakeTraceParams(const FGrapplePoint& Point) const
+{
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(GrapplePointLineOfSight), false);
+	Params.AddIgnoredActor(LastViewer.Get());
+	Params.AddIgnoredActor(Point.GetActor());
+	return Params;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REGISTRATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UGrapplePointSubsystem::RegisterPoint(USceneComponent* Anchor)
+{
+	if (!IsValid(Anchor) || IndexByAnchor.Contains(Anchor)) return;
+
+	FGrapplePoint& Point = Points.AddDefaulted_GetRef();
+	Point.Anchor = Anchor;
+	Point.Key = Anchor;
+	Point.Location = Anchor->GetComponentLocation();
+	Point.Cell = ToCell(Point.Location);
+	Point.BakedIndex = FindBakedIndex(Point.Location);
+
+	const int32 Index = Points.Num() - 1;
+	IndexByAnchor.Add(Point.Key, Index);
+	AddToCell(Point.Cell, Index);
+}
+
+void UGrapplePointSubsystem::UnregisterPoint(USceneComponent* Anchor)
+{
+	// An in-flight trace is dropped when its key no longer resolves
+	if (const int32* Index = IndexByAnchor.Find(Anchor))
+	{
+		RemovePointAt(*Index);
+	}
+}
+
+void UGrapplePointSubsystem::UpdatePoint(USceneComponent* Anchor)
+{
+	const int32* Index = IndexByAnchor.Find(Anchor);
+	if (!Index) return;
+
+	FGrapplePoint& Point = Points[*Index];
+	Point.Location = Anchor->GetComponentLocation();
+	Point.BakedIndex = FindBakedIndex(Point.Location);
+
+	// Only touch the hash when crossing a cell boundary
+	const FIntPoint NewCell = ToCell(Point.Location);
+	if (NewCell != Point.Cell)
+	{
+		RemoveFromCell(Point.Cell, *Index);
+		Point.Cell = NewCell;
+		AddToCell(NewCell, *Index);
+	}
+}
+
+void UGrapplePointSubsystem::RegisterTaggedActors(FName Tag)
+{
+	if (Tag.IsNone() || RegisteredTags.Contains(Tag)) return;
+	RegisteredTags.Add(Tag);
+
+	// Una sola pasada por nivel; los actores que nazcan después deben llevar UGrapplePointComponent
+	TArray<AActor*> TaggedActors;
+	UGameplayStatics::GetAllActorsWithTag(GetWorld(), Tag, TaggedActors);
+
+	for (AActor* Actor : TaggedActors)
+	{
+		if (!Actor || !Actor->GetRootComponent() || Actor->FindComponentByClass<UGrapplePointComponent>()) continue;
+
+		USceneComponent* Root = Actor->GetRootComponent();
+		RegisterPoint(Root);
+		Actor->OnEndPlay.AddUniqueDynamic(this, &UGrapplePointSubsystem::HandleTaggedActorEndPlay);
+
+		// Platforms, lifts...: same refresh the component gets from OnUpdateTransform
+		if (Root->Mobility == EComponentMobility::Movable && !MovableTaggedAnchors.Contains(Root))
+		{
+			MovableTaggedAnchors.Add(Root, Root->TransformUpdated.AddUObject(this, &UGrapplePointSubsystem::HandleTaggedAnchorMoved));
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("GrapplePointSubsystem: %d anchors after sweeping tag '%s'"), Points.Num(), *Tag.ToString());
+}
+
+void UGrapplePointSubsystem::HandleTaggedActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	if (!Actor) return;
+
+	USceneComponent* Root = Actor->GetRootComponent();
+	FDelegateHandle Handle;
+	if (Root && MovableTaggedAnchors.RemoveAndCopyValue(Root, Handle))
+	{
+		Root->TransformUpdated.Remove(Handle);
+	}
+	UnregisterPoint(Root);
+}
+
+void UGrapplePointSubsystem::HandleTaggedAnchorMoved(USceneComponent* Anchor, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	UpdatePoint(Anchor);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// QUERIES
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UGrapplePointSubsystem::GatherCandidates(const FVector& Origin, float Range, const FConvexVolume& Frustum, TArray<int32>& OutPoints) const
+{
+	SAIRAN_SCOPE(STAT_Sairan_GrapplePointsGather, Traversal);
+
+	OutPoints.Reset();
+
+	const FIntPoint MinCell = ToCell(Origin - FVector(Range, Range, 0.0f));
+	const FIntPoint MaxCell = ToCell(Origin + FVector(Range, Range, 0.0f));
+	const double RangeSq = FMath::Square(Range);
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const TArray<int32>* Bucket = Cells.Find(FIntPoint(X, Y));
+			if (!Bucket) continue;
+
+			for (int32 PointIndex : *Bucket)
+			{
+				const FGrapplePoint& Point = Points[PointIndex];
+				if (FVector::DistSquared(Origin, Point.Location) > RangeSq) continue;
+				if (!Frustum.IntersectSphere(Point.Location, PointRadius)) continue;
+				if (!Point.Anchor.IsValid()) continue;
+
+				OutPoints.Add(PointIndex);
+			}
+		}
+	}
+}
+
+bool UGrapplePointSubsystem::HasLineOfSight(int32 PointIndex, const FVector& ViewOrigin, const AActor* Viewer)
+{
+	SAIRAN_SCOPE(STAT_Sairan_GrapplePointsLOS, Traversal);
+
+	if (!Points.IsValidIndex(PointIndex)) return false;
+
+	FGrapplePoint& Point = Points[PointIndex];
+	const uint64 Frame = GFrameCounter;
+
+	// Baked table first: no trace for anchors hidden from, or fully seen from, the player's
+	// cell. Unlisted / partial / unknown fall through to the cached trace
+	if (BakeData && Point.BakedIndex != INDEX_NONE && Viewer)
+	{
+		const EGrappleBakedVisibility Baked = BakeData->GetVisibility(Viewer->GetActorLocation(), Point.BakedIndex);
+		if (Baked == EGrappleBakedVisibility::Hidden) return false;
+		if (Baked == EGrappleBakedVisibility::Visible && bTrustBakedVisibility) return true;
+	}
+
+	LastViewOrigin = ViewOrigin;
+	LastViewer = Viewer;
+
+	// The refresh set only holds anchors asked about on the latest query frame
+	if (QueryFrame != Frame)
+	{
+		QueryFrame = Frame;
+		QueriedPoints.Reset();
+	}
+	QueriedPoints.AddUnique(Point.Key);
+
+	// Async refresh starts at LineOfSightCacheFrames; twice that leaves room for it to land
+	if (Point.bLineOfSightValid && Frame - Point.LineOfSightFrame <= uint64(LineOfSightCacheFrames) * 2)
+	{
+		return Point.bVisible;
+	}
+
+	// Unknown or long stale (anchor just entered the view): trace now and seed the cache
+	SAIRAN_COUNT(STAT_Sairan_TraversalTraces, TracesIssued, 1);
+	FHitResult Hit;
+	const bool bBlocked = GetWorld()->LineTraceSingleByChannel(Hit, ViewOrigin, Point.Location, TraceChannel, MakeTraceParams(Point));
+
+	Point.bLineOfSightValid = true;
+	Point.bVisible = !bBlocked;
+	Point.LineOfSightFrame = Frame;
+	return Point.bVisible;
+}
+
+bool UGrapplePointSubsystem::GetApproach(int32 PointIndex, const FVector& From, float& OutReleaseDistance) const
+{
+	OutReleaseDistance = 0.0f;
+	if (!BakeData || !Points.IsValidIndex(PointIndex) || Points[PointIndex].BakedIndex == INDEX_NONE)
+	{
+		return true;
+	}
+	return BakeData->GetApproach(Points[PointIndex].BakedIndex, From, OutReleaseDistance);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FRAME
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UGrapplePointSubsystem::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_GrapplePointsTick, Traversal);
+
+	if (PendingTraces.Num() > 0)
+	{
+		PollPendingTraces();
+	}
+
+	// Nobody aimed last frame: nothing to keep warm
+	if (QueriedPoints.Num() > 0 && QueryFrame + 1 >= GFrameCounter)
+	{
+		IssueTraces();
+	}
+}
+
+void UGrapplePointSubsystem::PollPendingTraces()
+{
+	UWorld* World = GetWorld();
+	for (int32 i = PendingTraces.Num() - 1; i >= 0; --i)
+	{
+		const FPendingTrace& Pending = PendingTraces[i];
+
+		// Lost (e.g. the async buffer was flushed): drop it, the next refresh re-issues
+		FTraceDatum Data;
+		const bool bLost = !World->IsTraceHandleValid(Pending.Handle, false);
+		if (!bLost && !World->QueryTraceData(Pending.Handle, Data))
+		{
+			continue;
+		}
+
+		const int32* Index = IndexByAnchor.Find(Pending.Key);
+		if (!bLost && Index)
+		{
+			FGrapplePoint& Point = Points[*Index];
+
+			// Never overwrite a newer synchronous seed with older data
+			if (!Point.bLineOfSightValid || Point.LineOfSightFrame <= Pending.Frame)
+			{
+				Point.bLineOfSightValid = true;
+				Point.bVisible = !Data.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+				Point.LineOfSightFrame = Pending.Frame;
+			}
+		}
+		PendingTraces.RemoveAtSwap(i, 1, EAllowShrinking::No);
+	}
+}
+
+void UGrapplePointSubsystem::IssueTraces()
+{
+	UWorld* World = GetWorld();
+	const uint64 Frame = GFrameCounter;
+	int32 Issued = 0;
+
+	for (const TObjectKey<USceneComponent>& Key : QueriedPoints)
+	{
+		if (Issued >= MaxTracesPerFrame) break;
+
+		const int32* Index = IndexByAnchor.Find(Key);
+		if (!Index || IsPending(Key)) continue;
+
+		const FGrapplePoint& Point = Points[*Index];
+		if (Point.bLineOfSightValid && Frame - Point.LineOfSightFrame < uint64(LineOfSightCacheFrames)) continue;
+
+		SAIRAN_COUNT(STAT_Sairan_TraversalTraces, TracesIssued, 1);
+		FPendingTrace& Pending = PendingTraces.AddDefaulted_GetRef();
+		Pending.Key = Key;
+		Pending.Frame = Frame;
+		Pending.Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, LastViewOrigin, Point.Location, TraceChannel, MakeTraceParams(Point));
+		++Issued;
+	}
+}
@@ -1,6 +1,7 @@
 // SairanSkies - Targeting Component Implementation (Arkham-style)
 
 #include "Combat/TargetingComponent.h"
+#include "Core/SairanStats.h"
 #include "Character/SairanCharacter.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/KismetMathLibrary.h"
@@ -8,6 +9,10 @@
 #include "Components/CapsuleComponent.h"
 #include "DrawDebugHelpers.h"
 
+DECLARE_CYCLE_STAT(TEXT("Targeting Tick"), STAT_Sairan_TargetingTick, STATGROUP_SairanCombat);
+DECLARE_CYCLE_STAT(TEXT("Find Best Target"), STAT_Sairan_FindBestTarget, STATGROUP_SairanCombat);
+DECLARE_CYCLE_STAT(TEXT("Targets In Range"), STAT_Sairan_TargetsInRange, STATGROUP_SairanCombat);
+
 UTargetingComponent::UTargetingComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -22,6 +27,8 @@ void UTargetingComponent::BeginPlay()
 
 void UTargetingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	SAIRAN_SCOPE(STAT_Sairan_TargetingTick, Combat);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	// Update snap movement if in progress
@@ -33,6 +40,8 @@ void UTargetingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 
 AActor* UTargetingComponent::FindBestTarget()
 {
+	SAIRAN_SCOPE(STAT_Sairan_FindBestTarget, Combat);
+
 	TArray<AActor*> ValidTargets = GetAllTargetsInRange();
 	
 	if (ValidTargets.Num() == 0)
@@ -60,6 +69,8 @@ AActor* UTargetingComponent::FindBestTarget()
 
 TArray<AActor*> UTargetingComponent::GetAllTargetsInRange()
 {
+	SAIRAN_SCOPE(STAT_Sairan_TargetsInRange, Combat);
+
 	TArray<AActor*> ValidTargets;
 	
 	if (!OwnerCharacter) return ValidTargets;
@@ -71,6 +82,7 @@ TArray<AActor*> UTargetingComponent::GetAllTargetsInRange()
 
 	FVector OwnerLocation = OwnerCharacter->GetActorLocation();
 
+	SAIRAN_COUNT(STAT_Sairan_CombatTraces, TracesIssued, 1);
 	bool bHit = UKismetSystemLibrary::SphereTraceMulti(
 		GetWorld(),
 		OwnerLocation,
@@ -132,6 +144,7 @@ bool UTargetingComponent::HasLineOfSightToTarget(AActor* Target) const
 	QueryParams.AddIgnoredActor(OwnerCharacter);
 	QueryParams.AddIgnoredActor(Target);
 
+	SAIRAN_COUNT(STAT_Sairan_CombatTraces, TracesIssued, 1);
 	bool bBlocked = GetWorld()->LineTraceSingleByChannel(
 		HitResult,
 		Start,
@@ -214,6 +227,7 @@ void UTargetingComponent::SnapToTarget(AActor* Target)
 	QueryParams.AddIgnoredActor(OwnerCharacter);
 	QueryParams.AddIgnoredActor(Target);
 	
+	SAIRAN_COUNT(STAT_Sairan_CombatTraces, TracesIssued, 1);
 	bool bHitGround = GetWorld()->LineTraceSingleByChannel(
 		GroundHit,
 		TraceStart,
@@ -0,0 +1,220 @@
+// SairanSkies - Benchmark Timers
+
+#include "Core/BenchmarkTimers.h"
+#include "Misc/CoreDelegates.h"
+#include "HAL/IConsoleManager.h"
+
+namespace SairanBenchmark
+{
+	bool bRecording = false;
+	uint64 BucketCycles[NumBuckets] = {};
+	uint32 Counters[NumCounters] = {};
+
+	namespace
+	{
+		FOnFrameSampled OnFrameSampled;
+		int32 NumRecorders = 0;
+		FDelegateHandle BeginFrameHandle;
+		FDelegateHandle EndFrameHandle;
+		uint64 FrameStartCycles = 0;
+
+		/** Innermost open scope on the game thread */
+		FScope* CurrentScope = nullptr;
+
+		void OnBeginFrame()
+		{
+			FMemory::Memzero(BucketCycles);
+			FMemory::Memzero(Counters);
+			CurrentScope = nullptr;
+			bRecording = true;
+			FrameStartCycles = FPlatformTime::Cycles64();
+		}
+
+		void OnEndFrame()
+		{
+			if (!bRecording) return;
+			bRecording = false;
+
+			FFrameSample Sample;
+			Sample.FrameMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FrameStartCycles);
+			for (int32 i = 0; i < NumBuckets; ++i)
+			{
+				Sample.BucketMs[i] = FPlatformTime::ToMilliseconds64(BucketCycles[i]);
+			}
+			FMemory::Memcpy(Sample.Counters, Counters, sizeof(Counters));
+
+			OnFrameSampled.Broadcast(Sample);
+		}
+	}
+
+	const TCHAR* GetBucketName(EBenchmarkBucket Bucket)
+	{
+		switch (Bucket)
+		{
+		case EBenchmarkBucket::AITick:			return TEXT("AITick");
+		case EBenchmarkBucket::BehaviorTree:	return TEXT("BehaviorTree");
+		case EBenchmarkBucket::Perception:		return TEXT("Perception");
+		case EBenchmarkBucket::Movement:		return TEXT("Movement");
+		case EBenchmarkBucket::Animation:		return TEXT("Animation");
+		case EBenchmarkBucket::GroupCombat:		return TEXT("GroupCombat");
+		case EBenchmarkBucket::Combat:			return TEXT("Combat");
+		case EBenchmarkBucket::Traversal:		return TEXT("Traversal");
+		case EBenchmarkBucket::UI:				return TEXT("UI");
+		case EBenchmarkBucket::VFX:				return TEXT("VFX");
+		default:								return TEXT("Unknown");
+		}
+	}
+
+	const TCHAR* GetCounterName(EBenchmarkCounter Counter)
+	{
+		switch (Counter)
+		{
+		case EBenchmarkCounter::EnemiesTicked:	return TEXT("EnemiesTicked");
+		case EBenchmarkCounter::TracesIssued:	return TEXT("TracesIssued");
+		case EBenchmarkCounter::WidgetsSpawned:	return TEXT("WidgetsSpawned");
+		default:								return TEXT("Unknown");
+		}
+	}
+
+	FDelegateHandle AddRecorder(FOnFrameSampled::FDelegate&& Recorder)
+	{
+		if (NumRecorders++ == 0)
+		{
+			BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddStatic(&OnBeginFrame);
+			EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&OnEndFrame);
+		}
+		return OnFrameSampled.Add(MoveTemp(Recorder));
+	}
+
+	void RemoveRecorder(FDelegateHandle Handle)
+	{
+		if (!OnFrameSampled.Remove(Handle)) return;
+
+		if (--NumRecorders == 0)
+		{
+			FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+			FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+			bRecording = false;
+			CurrentScope = nullptr;
+		}
+	}
+
+	void FScope::Enter()
+	{
+		// Worker-thread scopes (parallel anim update...) are not part of the game-thread breakdown
+		if (!IsInGameThread()) return;
+
+		const uint64 Now = FPlatformTime::Cycles64();
+		Parent = CurrentScope;
+		if (Parent)
+		{
+			BucketCycles[static_cast<int32>(Parent->Bucket)] += Now - Parent->StartCycles;
+		}
+		StartCycles = Now;
+		CurrentScope = this;
+		bActive = true;
+	}
+
+	void FScope::Exit()
+	{
+		const uint64 Now = FPlatformTime::Cycles64();
+
+		// Recording stopped / frame restarted while we were open: just unwind
+		if (CurrentScope == this)
+		{
+			BucketCycles[static_cast<int32>(Bucket)] += Now - StartCycles;
+			CurrentScope = Parent;
+			if (Parent)
+			{
+				Parent->StartCycles = Now;
+			}
+		}
+	}
+
+	// ── Console: Sairan.FrameBreakdown [Frames] ───────────────────────────────
+
+	namespace
+	{
+		struct FFrameBreakdown
+		{
+			FDelegateHandle Handle;
+			int32 FramesLeft = 0;
+			int32 NumFrames = 0;
+			double SumFrameMs = 0.0;
+			double MaxFrameMs = 0.0;
+			double SumBucketMs[NumBuckets] = {};
+			double MaxBucketMs[NumBuckets] = {};
+			uint64 SumCounters[NumCounters] = {};
+
+			void Start(int32 Frames)
+			{
+				if (Handle.IsValid())
+				{
+					UE_LOG(LogTemp, Warning, TEXT("Sairan.FrameBreakdown: ya hay una captura en curso (%d frames restantes)"), FramesLeft);
+					return;
+				}
+
+				*this = FFrameBreakdown();
+				FramesLeft = FMath::Max(1, Frames);
+				Handle = AddRecorder(FOnFrameSampled::FDelegate::CreateRaw(this, &FFrameBreakdown::OnFrame));
+				UE_LOG(LogTemp, Display, TEXT("Sairan.FrameBreakdown: capturando %d frames..."), FramesLeft);
+			}
+
+			void OnFrame(const FFrameSample& Sample)
+			{
+				++NumFrames;
+				SumFrameMs += Sample.FrameMs;
+				MaxFrameMs = FMath::Max(MaxFrameMs, Sample.FrameMs);
+				for (int32 i = 0; i < NumBuckets; ++i)
+				{
+					SumBucketMs[i] += Sample.BucketMs[i];
+					MaxBucketMs[i] = FMath::Max(MaxBucketMs[i], Sample.BucketMs[i]);
+				}
+				for (int32 i = 0; i < NumCounters; ++i)
+				{
+					SumCounters[i] += Sample.Counters[i];
+				}
+
+				if (--FramesLeft <= 0)
+				{
+					Dump();
+					RemoveRecorder(Handle);
+					Handle.Reset();
+				}
+			}
+
+			void Dump() const
+			{
+				const double AvgFrameMs = SumFrameMs / NumFrames;
+				double Attributed = 0.0;
+
+				UE_LOG(LogTemp, Display, TEXT("── Frame breakdown (%d frames) ── frame avg %.2f ms, max %.2f ms"), NumFrames, AvgFrameMs, MaxFrameMs);
+				UE_LOG(LogTemp, Display, TEXT("  %-14s %9s %9s %7s"), TEXT("System"), TEXT("Avg ms"), TEXT("Max ms"), TEXT("Frame%"));
+				for (int32 i = 0; i < NumBuckets; ++i)
+				{
+					const double Avg = SumBucketMs[i] / NumFrames;
+					Attributed += Avg;
+					UE_LOG(LogTemp, Display, TEXT("  %-14s %9.3f %9.3f %6.1f%%"), GetBucketName(static_cast<EBenchmarkBucket>(i)),
+						Avg, MaxBucketMs[i], AvgFrameMs > 0.0 ? 100.0 * Avg / AvgFrameMs : 0.0);
+				}
+				UE_LOG(LogTemp, Display, TEXT("  %-14s %9.3f %9s %6.1f%%"), TEXT("Other"), AvgFrameMs - Attributed, TEXT("-"),
+					AvgFrameMs > 0.0 ? 100.0 * (AvgFrameMs - Attributed) / AvgFrameMs : 0.0);
+				for (int32 i = 0; i < NumCounters; ++i)
+				{
+					UE_LOG(LogTemp, Display, TEXT("  %-14s %9.1f /frame"), GetCounterName(static_cast<EBenchmarkCounter>(i)),
+						static_cast<double>(SumCounters[i]) / NumFrames);
+				}
+			}
+		};
+
+		FFrameBreakdown GFrameBreakdown;
+
+		FAutoConsoleCommand FrameBreakdownCommand(
+			TEXT("Sairan.FrameBreakdown"),
+			TEXT("Sairan.FrameBreakdown [Frames=120] — records the next frames and logs game-thread ms per system (AI, BT, perception, movement, animation, combat, traversal, UI, VFX) plus counters."),
+			FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+			{
+				GFrameBreakdown.Start(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 120);
+			}));
+	}
+}
@@ -0,0 +1,152 @@
+// SairanSkies - Enemy Benchmark Commandlet
+
+#include "Core/EnemyBenchmarkCommandlet.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+UEnemyBenchmarkCommandlet::UEnemyBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UEnemyBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString Map = TEXT("/Game/Levels/Enemy_Level_Demo");
+	FString CountsParam = TEXT("25,50,100,200");
+	FString OutDir = FPaths::ProfilingDir() / TEXT("EnemyBenchmark") / FDateTime::Now().ToString();
+	int32 Frames = 1800;
+	int32 Warmup = 300;
+	int32 FPS = 30;
+
+	FParse::Value(*Params, TEXT("Map="), Map);
+	FParse::Value(*Params, TEXT("Counts="), CountsParam, false);
+	FParse::Value(*Params, TEXT("Out="), OutDir);
+	FParse::Value(*Params, TEXT("Frames="), Frames);
+	FParse::Value(*Params, TEXT("Warmup="), Warmup);
+	FParse::Value(*Params, TEXT("FPS="), FPS);
+	OutDir = FPaths::ConvertRelativePathToFull(OutDir);
+
+	TArray<FString> CountStrings;
+	CountsParam.ParseIntoArray(CountStrings, TEXT(","));
+
+	TArray<FString> SummaryRows;
+	bool bAllSucceeded = true;
+
+	for (const FString& CountString : CountStrings)
+	{
+		const int32 NumEnemies = FCString::Atoi(*CountString);
+		if (NumEnemies <= 0) continue;
+
+		const FString CsvPath = OutDir / FString::Printf(TEXT("Enemies_%d.csv"), NumEnemies);
+		UE_LOG(LogTemp, Display, TEXT("EnemyBenchmark: %d enemigos en %s..."), NumEnemies, *Map);
+
+		if (!RunBenchmark(Map, NumEnemies, Frames, Warmup, FPS, CsvPath) || !SummarizeRun(CsvPath, NumEnemies, SummaryRows))
+		{
+			UE_LOG(LogTemp, Error, TEXT("EnemyBenchmark: la ejecución con %d enemigos falló"), NumEnemies);
+			bAllSucceeded = false;
+		}
+	}
+
+	const FString SummaryPath = OutDir / TEXT("Summary.csv");
+	if (SummaryRows.Num() > 1)
+	{
+		FFileHelper::SaveStringArrayToFile(SummaryRows, *SummaryPath);
+		UE_LOG(LogTemp, Display, TEXT("EnemyBenchmark: resumen en %s"), *SummaryPath);
+	}
+
+	return bAllSucceeded ? 0 : 1;
+}
+
+bool UEnemyBenchmarkCommandlet::RunBenchmark(const FString& Map, int32 NumEnemies, int32 Frames, int32 Warmup, int32 FPS, const FString& CsvPath) const
+{
+	// Stale file from an earlier run must not count as a result
+	IFileManager::Get().Delete(*CsvPath, false, true, true);
+
+	const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+	const FString Args = FString::Printf(
+		TEXT("\"%s\" %s -game -nullrhi -nosound -unattended -nosplash -stdout -benchmark -fps=%d -deterministic ")
+		TEXT("-EnemyBenchmark -BenchEnemies=%d -BenchFrames=%d -BenchWarmup=%d -BenchCSV=\"%s\""),
+		*ProjectPath, *Map, FPS, NumEnemies, Frames, Warmup, *CsvPath);
+
+	FProcHandle Process = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *Args,
+		false, true, true, nullptr, 0, nullptr, nullptr);
+	if (!Process.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("EnemyBenchmark: no se pudo lanzar %s"), FPlatformProcess::ExecutablePath());
+		return false;
+	}
+
+	FPlatformProcess::WaitForProc(Process);
+	int32 ReturnCode = -1;
+	FPlatformProcess::GetProcReturnCode(Process, &ReturnCode);
+	FPlatformProcess::CloseProc(Process);
+
+	return ReturnCode == 0 && IFileManager::Get().FileExists(*CsvPath);
+}
+
+bool UEnemyBenchmarkCommandlet::SummarizeRun(const FString& CsvPath, int32 NumEnemies, TArray<FString>& SummaryRows) const
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *CsvPath) || Lines.Num() < 2)
+	{
+		return false;
+	}
+
+	// Columns 0/1 are Frame / Phase; the rest are numbers
+	TArray<FString> Columns;
+	Lines[0].ParseIntoArray(Columns, TEXT(","));
+	const int32 NumValues = Columns.Num() - 2;
+	if (NumValues <= 0) return false;
+
+	if (SummaryRows.Num() == 0)
+	{
+		FString Header = TEXT("Enemies,Phase,Frames");
+		for (int32 c = 2; c < Columns.Num(); ++c)
+		{
+			Header += FString::Printf(TEXT(",Mean_%s,P95_%s,Max_%s"), *Columns[c], *Columns[c], *Columns[c]);
+		}
+		SummaryRows.Add(Header);
+	}
+
+	// Phase → one array of samples per column
+	TMap<FString, TArray<TArray<double>>> Samples;
+	TArray<FString> Fields;
+	for (int32 Row = 1; Row < Lines.Num(); ++Row)
+	{
+		Lines[Row].ParseIntoArray(Fields, TEXT(","));
+		if (Fields.Num() != Columns.Num()) continue;
+
+		for (const FString& Phase : { Fields[1], FString(TEXT("All")) })
+		{
+			TArray<TArray<double>>& PhaseSamples = Samples.FindOrAdd(Phase);
+			PhaseSamples.SetNum(NumValues);
+			for (int32 c = 0; c < NumValues; ++c)
+			{
+				PhaseSamples[c].Add(FCString::Atod(*Fields[c + 2]));
+			}
+		}
+	}
+
+	for (TPair<FString, TArray<TArray<double>>>& Pair : Samples)
+	{
+		FString SummaryRow = FString::Printf(TEXT("%d,%s,%d"), NumEnemies, *Pair.Key, Pair.Value[0].Num());
+		for (TArray<double>& Values : Pair.Value)
+		{
+			Values.Sort();
+			double Sum = 0.0;
+			for (const double Value : Values)
+			{
+				Sum += Value;
+			}
+			const int32 P95Index = FMath::Clamp(FMath::CeilToInt32(Values.Num() * 0.95) - 1, 0, Values.Num() - 1);
+			SummaryRow += FString::Printf(TEXT(",%.3f,%.3f,%.3f"), Sum / Values.Num(), Values[P95Index], Values.Last());
+		}
+		SummaryRows.Add(MoveTemp(SummaryRow));
+	}
+	return true;
+}
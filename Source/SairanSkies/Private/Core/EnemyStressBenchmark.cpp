@@ -0,0 +1,368 @@
+// SairanSkies - Enemy Stress Benchmark
+
+#include "Core/EnemyStressBenchmark.h"
+#include "Core/WaveZone.h"
+#include "Enemies/EnemyBase.h"
+#include "Enemies/Types/NormalEnemy.h"
+#include "Navigation/PatrolPath.h"
+#include "AI/EnemyPoolSubsystem.h"
+#include "AI/EnemyRegistrySubsystem.h"
+#include "Components/BoxComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "NavigationSystem.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectArray.h"
+#include "RenderCore.h"
+#include "Engine/World.h"
+
+bool UEnemyStressBenchmark::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("EnemyBenchmark")) && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UEnemyStressBenchmark::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyStressBenchmark::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("BenchEnemies="), NumEnemies);
+	FParse::Value(CommandLine, TEXT("BenchFrames="), NumMeasuredFrames);
+	FParse::Value(CommandLine, TEXT("BenchWarmup="), WarmupFrames);
+	FParse::Value(CommandLine, TEXT("BenchRadius="), ArenaRadius);
+	FParse::Value(CommandLine, TEXT("BenchEnemyClass="), EnemyClassPath);
+	if (!FParse::Value(CommandLine, TEXT("BenchCSV="), CsvPath))
+	{
+		CsvPath = FPaths::ProfilingDir() / TEXT("EnemyBenchmark") /
+			FString::Printf(TEXT("Enemies_%d_%s.csv"), NumEnemies, *FDateTime::Now().ToString());
+	}
+
+	NumEnemies = FMath::Max(1, NumEnemies);
+	NumMeasuredFrames = FMath::Max(3, NumMeasuredFrames);
+	WarmupFrames = FMath::Max(0, WarmupFrames);
+
+	UE_LOG(LogTemp, Warning, TEXT("EnemyBenchmark: %d enemigos, %d frames (+%d warmup) → %s"),
+		NumEnemies, NumMeasuredFrames, WarmupFrames, *CsvPath);
+}
+
+void UEnemyStressBenchmark::Deinitialize()
+{
+	SairanBenchmark::RemoveRecorder(RecorderHandle);
+
+	// World torn down mid-run (map change, manual quit): keep what was measured
+	if (Phase != EPhase::Done && CsvRows.Num() > 1)
+	{
+		FFileHelper::SaveStringArrayToFile(CsvRows, *CsvPath);
+	}
+
+	PatrolPaths.Empty();
+	WaveZone = nullptr;
+	CsvRows.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UEnemyStressBenchmark::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyStressBenchmark, STATGROUP_Tickables);
+}
+
+const TCHAR* UEnemyStressBenchmark::GetPhaseName(EPhase InPhase)
+{
+	switch (InPhase)
+	{
+	case EPhase::Setup:		return TEXT("Setup");
+	case EPhase::Warmup:	return TEXT("Warmup");
+	case EPhase::Patrol:	return TEXT("Patrol");
+	case EPhase::Chase:		return TEXT("Chase");
+	case EPhase::Combat:	return TEXT("Combat");
+	default:				return TEXT("Done");
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SETUP
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool UEnemyStressBenchmark::TrySetup()
+{
+	UWorld* World = GetWorld();
+	APawn* Player = UGameplayStatics::GetPlayerPawn(World, 0);
+	if (!Player) return false;
+
+	// Patrol legs and wave spawns need the navmesh
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	if (!NavSys || NavSys->IsNavigationBuildInProgress() || !NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate))
+	{
+		return false;
+	}
+
+	EnemyClass = LoadClass<AEnemyBase>(nullptr, *EnemyClassPath);
+	if (!EnemyClass)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EnemyBenchmark: clase %s no encontrada, usando ANormalEnemy"), *EnemyClassPath);
+		EnemyClass = ANormalEnemy::StaticClass();
+	}
+
+	Player->SetCanBeDamaged(false);
+	ArenaCenter = Player->GetActorLocation();
+
+	// Combat spot between the centre and the patrol ring, away from where the chase circle starts
+	CombatPoint = ArenaCenter + FVector(-ArenaRadius * 0.35f, 0.0f, 0.0f);
+
+	const int32 NumPatrol = NumEnemies / 2;
+	const int32 NumWave = NumEnemies - NumPatrol;
+
+	if (UEnemyPoolSubsystem* Pool = World->GetSubsystem<UEnemyPoolSubsystem>())
+	{
+		Pool->MaxEnemiesPerClass = FMath::Max(Pool->MaxEnemiesPerClass, NumEnemies);
+		Pool->Prewarm(EnemyClass, NumEnemies, ArenaCenter);
+	}
+
+	SpawnPatrolEnemies(NumPatrol);
+	SpawnWaveZone(NumWave);
+
+	// Header
+	FString Header = TEXT("Frame,Phase,FrameMs,GameThreadMs");
+	for (int32 i = 0; i < SairanBenchmark::NumBuckets; ++i)
+	{
+		Header += FString::Printf(TEXT(",%sMs"), SairanBenchmark::GetBucketName(static_cast<EBenchmarkBucket>(i)));
+	}
+	for (int32 i = 0; i < SairanBenchmark::NumCounters; ++i)
+	{
+		Header += FString::Printf(TEXT(",%s"), SairanBenchmark::GetCounterName(static_cast<EBenchmarkCounter>(i)));
+	}
+	Header += TEXT(",Enemies,UsedPhysicalMB,UsedVirtualMB,UObjects");
+	CsvRows.Reset(NumMeasuredFrames + 1);
+	CsvRows.Add(Header);
+
+	UE_LOG(LogTemp, Warning, TEXT("EnemyBenchmark: arena en %s — %d patrullando, %d en la oleada"),
+		*ArenaCenter.ToString(), NumPatrol, NumWave);
+	return true;
+}
+
+void UEnemyStressBenchmark::SpawnPatrolEnemies(int32 Count)
+{
+	if (Count <= 0) return;
+
+	UWorld* World = GetWorld();
+	UEnemyPoolSubsystem* Pool = World->GetSubsystem<UEnemyPoolSubsystem>();
+	const int32 NumPaths = FMath::DivideAndRoundUp(Count, EnemiesPerPatrolPath);
+
+	for (int32 PathIndex = 0; PathIndex < NumPaths; ++PathIndex)
+	{
+		const float Angle = 2.0f * PI * PathIndex / NumPaths;
+		const FVector PathLocation = ArenaCenter + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * ArenaRadius;
+
+		// Points must be in place before BeginPlay (navigation cache registration)
+		APatrolPath* Path = World->SpawnActorDeferred<APatrolPath>(APatrolPath::StaticClass(), FTransform(PathLocation));
+		if (!Path) continue;
+
+		Path->PatrolPoints = {
+			FVector(-300.0f, -300.0f, 0.0f),
+			FVector( 300.0f, -300.0f, 0.0f),
+			FVector( 300.0f,  300.0f, 0.0f),
+			FVector(-300.0f,  300.0f, 0.0f) };
+		Path->FinishSpawning(FTransform(PathLocation));
+		PatrolPaths.Add(Path);
+
+		const int32 OnThisPath = FMath::Min(EnemiesPerPatrolPath, Count - PathIndex * EnemiesPerPatrolPath);
+		for (int32 i = 0; i < OnThisPath; ++i)
+		{
+			const FVector Location = Path->GetPatrolPoint(i % Path->GetNumPatrolPoints()) +
+				FVector(FMath::RandRange(-80.0f, 80.0f), FMath::RandRange(-80.0f, 80.0f), 0.0f);
+
+			// The path must be set before the enemy starts: BeginPlay / ResetForReuse pick Patrolling from it
+			if (Pool)
+			{
+				Pool->AcquireEnemy(EnemyClass, Location, FRotator(0.0f, FMath::RandRange(0.0f, 360.0f), 0.0f), Path);
+			}
+			else if (AEnemyBase* Enemy = World->SpawnActorDeferred<AEnemyBase>(EnemyClass, FTransform(Location), nullptr, nullptr,
+				ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn))
+			{
+				Enemy->PatrolPath = Path;
+				Enemy->FinishSpawning(FTransform(Location));
+			}
+		}
+	}
+}
+
+void UEnemyStressBenchmark::SpawnWaveZone(int32 Count)
+{
+	if (Count <= 0) return;
+
+	WaveZone = GetWorld()->SpawnActorDeferred<AWaveZone>(AWaveZone::StaticClass(), FTransform(CombatPoint));
+	if (!WaveZone) return;
+
+	WaveZone->EnemyClass = EnemyClass;
+	WaveZone->BaseEnemyCount = Count;
+	WaveZone->MaxWaves = 1;
+	WaveZone->PrewarmCount = Count;
+	WaveZone->SpawnRadius = 800.0f;
+	WaveZone->SpawnStagger = 0.02f;
+	WaveZone->ZoneTrigger->InitBoxExtent(FVector(400.0f, 400.0f, 300.0f));
+	WaveZone->FinishSpawning(FTransform(CombatPoint));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SCRIPTED PLAYER
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyStressBenchmark::Tick(float DeltaTime)
+{
+	switch (Phase)
+	{
+	case EPhase::Setup:
+		if (TrySetup())
+		{
+			Phase = EPhase::Warmup;
+			PhaseFrame = 0;
+		}
+		else if (++PhaseFrame > MaxSetupFrames)
+		{
+			UE_LOG(LogTemp, Error, TEXT("EnemyBenchmark: sin jugador o navmesh tras %d frames"), MaxSetupFrames);
+			Finish(false);
+		}
+		return;
+
+	case EPhase::Warmup:
+		if (++PhaseFrame >= WarmupFrames)
+		{
+			Phase = EPhase::Patrol;
+			PhaseFrame = 0;
+			RecorderHandle = SairanBenchmark::AddRecorder(
+				SairanBenchmark::FOnFrameSampled::FDelegate::CreateUObject(this, &UEnemyStressBenchmark::OnFrameSampled));
+		}
+		return;
+
+	case EPhase::Done:
+		return;
+
+	default:
+		break;
+	}
+
+	DrivePlayer(DeltaTime);
+
+	// Measured phases each take a third of the frames
+	const int32 FramesPerPhase = NumMeasuredFrames / 3;
+	if (++PhaseFrame >= FramesPerPhase && Phase != EPhase::Combat)
+	{
+		Phase = (Phase == EPhase::Patrol) ? EPhase::Chase : EPhase::Combat;
+		PhaseFrame = 0;
+		UE_LOG(LogTemp, Warning, TEXT("EnemyBenchmark: fase %s"), GetPhaseName(Phase));
+	}
+}
+
+void UEnemyStressBenchmark::DrivePlayer(float DeltaTime)
+{
+	switch (Phase)
+	{
+	case EPhase::Patrol:
+		// Idle in the centre, patrol ring out of sight
+		break;
+
+	case EPhase::Chase:
+	{
+		// Circle just inside the patrol ring: every patrol group spots the player once
+		ChaseAngle += 0.35f * DeltaTime;
+		const FVector Point = ArenaCenter + FVector(FMath::Cos(ChaseAngle), FMath::Sin(ChaseAngle), 0.0f) * (ArenaRadius * 0.7f);
+		MovePlayerTowards(Point, 0.0f);
+		break;
+	}
+
+	case EPhase::Combat:
+		// Stand in the wave zone (starts the wave) and let everyone engage
+		MovePlayerTowards(CombatPoint, 100.0f);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void UEnemyStressBenchmark::MovePlayerTowards(const FVector& Point, float AcceptanceRadius)
+{
+	APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	if (!Player) return;
+
+	const FVector ToPoint = (Point - Player->GetActorLocation()).GetSafeNormal2D();
+	if (FVector::Dist2D(Point, Player->GetActorLocation()) > AcceptanceRadius && !ToPoint.IsNearlyZero())
+	{
+		Player->AddMovementInput(ToPoint, 1.0f);
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// RECORDING
+// ═══════════════════════════════════════════════════════════════════════════
+
+void UEnemyStressBenchmark::OnFrameSampled(const SairanBenchmark::FFrameSample& Sample)
+{
+	if (Phase == EPhase::Done) return;
+
+	FString Row = FString::Printf(TEXT("%d,%s,%.3f,%.3f"), MeasuredFrame, GetPhaseName(Phase),
+		Sample.FrameMs, FPlatformTime::ToMilliseconds(GGameThreadTime));
+
+	SumFrameMs += Sample.FrameMs;
+	for (int32 i = 0; i < SairanBenchmark::NumBuckets; ++i)
+	{
+		SumBucketMs[i] += Sample.BucketMs[i];
+		Row += FString::Printf(TEXT(",%.3f"), Sample.BucketMs[i]);
+	}
+	for (int32 i = 0; i < SairanBenchmark::NumCounters; ++i)
+	{
+		Row += FString::Printf(TEXT(",%u"), Sample.Counters[i]);
+	}
+
+	const UEnemyRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UEnemyRegistrySubsystem>();
+	const FPlatformMemoryStats Memory = FPlatformMemory::GetStats();
+	Row += FString::Printf(TEXT(",%d,%.1f,%.1f,%d"),
+		Registry ? Registry->GetNumEnemies() : 0,
+		Memory.UsedPhysical / (1024.0 * 1024.0),
+		Memory.UsedVirtual / (1024.0 * 1024.0),
+		GUObjectArray.GetObjectArrayNumMinusAvailable());
+
+	CsvRows.Add(MoveTemp(Row));
+
+	if (++MeasuredFrame >= NumMeasuredFrames)
+	{
+		Finish(true);
+	}
+}
+
+void UEnemyStressBenchmark::Finish(bool bSuccess)
+{
+	Phase = EPhase::Done;
+	SairanBenchmark::RemoveRecorder(RecorderHandle);
+	RecorderHandle.Reset();
+
+	if (bSuccess)
+	{
+		if (FFileHelper::SaveStringArrayToFile(CsvRows, *CsvPath))
+		{
+			FString Summary = FString::Printf(TEXT("frame %.2f ms"), SumFrameMs / FMath::Max(1, MeasuredFrame));
+			for (int32 i = 0; i < SairanBenchmark::NumBuckets; ++i)
+			{
+				Summary += FString::Printf(TEXT(", %s %.3f ms"), SairanBenchmark::GetBucketName(static_cast<EBenchmarkBucket>(i)),
+					SumBucketMs[i] / FMath::Max(1, MeasuredFrame));
+			}
+			UE_LOG(LogTemp, Warning, TEXT("EnemyBenchmark: %d enemigos, %d frames — media: %s"), NumEnemies, MeasuredFrame, *Summary);
+			UE_LOG(LogTemp, Warning, TEXT("EnemyBenchmark: CSV escrito en %s"), *CsvPath);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("EnemyBenchmark: no se pudo escribir %s"), *CsvPath);
+			bSuccess = false;
+		}
+	}
+	CsvRows.Empty();
+
+	FPlatformMisc::RequestExitWithStatus(false, bSuccess ? 0 : 1, TEXT("UEnemyStressBenchmark"));
+}
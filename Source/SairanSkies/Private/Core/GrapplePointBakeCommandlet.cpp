@@ -0,0 +1,362 @@
+// SairanSkies - Grapple Point Bake Commandlet
+
+#include "Core/GrapplePointBakeCommandlet.h"
+#include "Combat/GrapplePointBakeData.h"
+#include "Combat/GrapplePointComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/LevelStreaming.h"
+#include "EngineUtils.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+UGrapplePointBakeCommandlet::UGrapplePointBakeCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGrapplePointBakeCommandlet::Main(const FString& Params)
+{
+	FBakeSettings Settings;
+	FString MapsParam;
+	FString TagParam = Settings.Tag.ToString();
+
+	FParse::Value(*Params, TEXT("Maps="), MapsParam, false);
+	FParse::Value(*Params, TEXT("Tag="), TagParam);
+	FParse::Value(*Params, TEXT("Out="), Settings.OutDir);
+	FParse::Value(*Params, TEXT("Range="), Settings.Range);
+	FParse::Value(*Params, TEXT("CellSize="), Settings.CellSize);
+	FParse::Value(*Params, TEXT("ApproachLength="), Settings.ApproachLength);
+	FParse::Value(*Params, TEXT("MaxRelease="), Settings.MaxRelease);
+	FParse::Value(*Params, TEXT("CapsuleRadius="), Settings.CapsuleRadius);
+	FParse::Value(*Params, TEXT("CapsuleHalfHeight="), Settings.CapsuleHalfHeight);
+	FParse::Value(*Params, TEXT("ViewRadius="), Settings.ViewRadius);
+	FParse::Value(*Params, TEXT("SamplesPerAxis="), Settings.SamplesPerAxis);
+	Settings.Tag = FName(*TagParam);
+	Settings.CellSize = FMath::Max(Settings.CellSize, 50.0f);
+	Settings.Range = FMath::Max(Settings.Range, 100.0f);
+	Settings.ViewRadius = FMath::Max(Settings.ViewRadius, 0.0f);
+	Settings.SamplesPerAxis = FMath::Clamp(Settings.SamplesPerAxis, 2, 8);
+
+	// Release distances are stored as uint8 steps
+	Settings.MaxRelease = FMath::Min(Settings.MaxRelease, 255.0f * UGrapplePointBakeData::ReleaseDistanceUnit);
+
+	TArray<FString> Maps;
+	MapsParam.ParseIntoArray(Maps, TEXT(","));
+	if (Maps.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GrapplePointBake: falta -Maps=/Game/...,/Game/..."));
+		return 1;
+	}
+
+	bool bAllSucceeded = true;
+	for (const FString& Map : Maps)
+	{
+		if (!BakeMap(Map, Settings))
+		{
+			UE_LOG(LogTemp, Error, TEXT("GrapplePointBake: falló el horneado de %s"), *Map);
+			bAllSucceeded = false;
+		}
+	}
+
+	return bAllSucceeded ? 0 : 1;
+}
+
+// ── World ─────────────────────────────────────────────────────────────────────
+
+UWorld* UGrapplePointBakeCommandlet::LoadWorld(const FString& Map) const
+{
+	UPackage* Package = LoadPackage(nullptr, *Map, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (!World) return nullptr;
+
+	World->AddToRoot();
+	World->WorldType = EWorldType::Editor;
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Editor);
+	WorldContext.SetCurrentWorld(World);
+
+	// Only collision is needed: physics scene, no navigation / AI / audio
+	World->InitWorld(UWorld::InitializationValues()
+		.AllowAudioPlayback(false)
+		.CreatePhysicsScene(true)
+		.RequiresHitProxies(false)
+		.CreateNavigation(false)
+		.CreateAISystem(false)
+		.ShouldSimulatePhysics(false)
+		.SetTransactional(false));
+
+	// Anchors and occluders may live in any sublevel
+	for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+	{
+		if (StreamingLevel)
+		{
+			StreamingLevel->SetShouldBeLoaded(true);
+			StreamingLevel->SetShouldBeVisible(true);
+		}
+	}
+	World->FlushLevelStreaming(EFlushLevelStreamingType::Full);
+	World->UpdateWorldComponents(true, false);
+
+	return World;
+}
+
+void UGrapplePointBakeCommandlet::ReleaseWorld(UWorld* World) const
+{
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+}
+
+// ── Bake ──────────────────────────────────────────────────────────────────────
+
+bool UGrapplePointBakeCommandlet::BakeMap(const FString& Map, const FBakeSettings& Settings) const
+{
+	UWorld* World = LoadWorld(Map);
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GrapplePointBake: no se pudo cargar %s"), *Map);
+		return false;
+	}
+
+	// Same anchors UGrapplePointSubsystem registers at runtime
+	TArray<FVector> Locations;
+	TArray<AActor*> PointActors;
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+
+		TInlineComponentArray<UGrapplePointComponent*> PointComponents(Actor);
+		for (const UGrapplePointComponent* PointComponent : PointComponents)
+		{
+			Locations.Add(PointComponent->GetComponentLocation());
+			PointActors.Add(Actor);
+		}
+
+		if (PointComponents.Num() == 0 && Actor->ActorHasTag(Settings.Tag) && Actor->GetRootComponent())
+		{
+			Locations.Add(Actor->GetActorLocation());
+			PointActors.Add(Actor);
+		}
+	}
+
+	const FString AssetName = TEXT("GB_") + FPackageName::GetShortName(Map);
+	const FString PackageName = Settings.OutDir / AssetName;
+	UPackage* Package = CreatePackage(*PackageName);
+	UGrapplePointBakeData* Data = NewObject<UGrapplePointBakeData>(Package, *AssetName, RF_Public | RF_Standalone);
+	Data->Version = UGrapplePointBakeData::CurrentVersion;
+	Data->PointLocations = Locations;
+
+	UE_LOG(LogTemp, Display, TEXT("GrapplePointBake: %s, %d anclajes"), *Map, Locations.Num());
+
+	if (Locations.Num() > 0)
+	{
+		BakeApproach(World, PointActors, Settings, Data);
+		BakeVisibility(World, PointActors, Settings, Data);
+	}
+
+	ReleaseWorld(World);
+
+	Data->BuildLookup();
+	return SaveBakeData(Data, PackageName);
+}
+
+void UGrapplePointBakeCommandlet::BakeApproach(UWorld* World, const TArray<AActor*>& PointActors, const FBakeSettings& Settings, UGrapplePointBakeData* Data) const
+{
+	constexpr int32 NumBuckets = UGrapplePointBakeData::NumApproachBuckets;
+	const FCollisionShape Capsule = FCollisionShape::MakeCapsule(Settings.CapsuleRadius, Settings.CapsuleHalfHeight);
+
+	Data->ApproachMasks.SetNumZeroed(Data->PointLocations.Num());
+	Data->ReleaseDistances.SetNumZeroed(Data->PointLocations.Num() * NumBuckets);
+
+	for (int32 p = 0; p < Data->PointLocations.Num(); ++p)
+	{
+		const FVector Anchor = Data->PointLocations[p];
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(GrappleBakeApproach), false, PointActors[p]);
+
+		for (int32 b = 0; b < NumBuckets; ++b)
+		{
+			// Player capsule flying in along this direction: how far before the anchor does it stop?
+			// A start inside geometry says nothing about the path: retry from closer in
+			const FVector Direction = UGrapplePointBakeData::GetApproachDirection(b);
+			float Length = Settings.ApproachLength;
+			float Clearance = 0.0f;
+			bool bClear = false;
+			for (int32 Attempt = 0; Attempt < 3; ++Attempt, Length *= 0.5f)
+			{
+				FHitResult Hit;
+				if (!World->SweepSingleByChannel(Hit, Anchor - Direction * Length, Anchor, FQuat::Identity, ECC_Pawn, Capsule, Params))
+				{
+					bClear = true;
+					break;
+				}
+				if (!Hit.bStartPenetrating)
+				{
+					Clearance = (1.0f - Hit.Time) * Length;
+					bClear = Clearance <= Settings.MaxRelease;
+					break;
+				}
+			}
+			if (!bClear) continue;
+
+			Data->ApproachMasks[p] |= 1u << b;
+			Data->ReleaseDistances[p * NumBuckets + b] =
+				uint8(FMath::Clamp(FMath::CeilToInt32(Clearance / UGrapplePointBakeData::ReleaseDistanceUnit), 0, 255));
+		}
+	}
+}
+
+void UGrapplePointBakeCommandlet::BakeVisibility(UWorld* World, const TArray<AActor*>& PointActors, const FBakeSettings& Settings, UGrapplePointBakeData* Data) const
+{
+	// Grid: anchor bounds grown by the range; cells grow if the grid gets too big
+	constexpr int64 MaxCells = 4 * 1024 * 1024;
+
+	FBox Bounds(Data->PointLocations);
+	Bounds = Bounds.ExpandBy(Settings.Range);
+
+	float CellSize = Settings.CellSize;
+	FIntVector GridSize;
+	for (;;)
+	{
+		const FVector Extent = Bounds.GetSize() / CellSize;
+		GridSize = FIntVector(FMath::CeilToInt32(Extent.X), FMath::CeilToInt32(Extent.Y), FMath::CeilToInt32(Extent.Z));
+		if (int64(GridSize.X) * GridSize.Y * GridSize.Z <= MaxCells) break;
+		CellSize *= 1.25f;
+	}
+	const int32 NumCells = GridSize.X * GridSize.Y * GridSize.Z;
+
+	Data->GridOrigin = Bounds.Min;
+	Data->CellSize = CellSize;
+	Data->GridSize = GridSize;
+
+	Data->CellBaked.SetNumZeroed(NumCells);
+	Data->CellStart.SetNumUninitialized(NumCells + 1);
+	Data->CellStart[0] = 0;
+	Data->CellEntries.Reset();
+
+	UE_LOG(LogTemp, Display, TEXT("GrapplePointBake: rejilla %dx%dx%d, celda %.0f cm"), GridSize.X, GridSize.Y, GridSize.Z, CellSize);
+
+	// Lattice over the cell grown by the camera radius: the runtime trace starts at
+	// the follow camera, anywhere within ViewRadius of the player
+	const FCollisionShape Probe = FCollisionShape::MakeSphere(Settings.CapsuleRadius);
+	const int32 N = Settings.SamplesPerAxis;
+	const float HalfExtent = CellSize * 0.5f + Settings.ViewRadius;
+
+	TArray<FVector> SampleOffsets;
+	SampleOffsets.Reserve(N * N * N);
+	for (int32 z = 0; z < N; ++z)
+	{
+		for (int32 y = 0; y < N; ++y)
+		{
+			for (int32 x = 0; x < N; ++x)
+			{
+				const FVector Alpha(x / float(N - 1), y / float(N - 1), z / float(N - 1));
+				SampleOffsets.Add((Alpha * 2.0 - 1.0) * HalfExtent);
+			}
+		}
+	}
+
+	// Anything within Range of some sample of the cell is listed
+	Data->BakedRange = Settings.Range + HalfExtent * UE_SQRT_3;
+	const double ListRangeSq = FMath::Square(Data->BakedRange);
+
+	TArray<FVector> Samples;
+	int32 LastPercent = -1;
+
+	for (int32 c = 0; c < NumCells; ++c)
+	{
+		const FVector Center = Data->GetCellCenter(c);
+
+		// Camera / player positions: samples not embedded in geometry
+		Samples.Reset();
+		for (const FVector& Offset : SampleOffsets)
+		{
+			const FVector Sample = Center + Offset;
+			if (!World->OverlapBlockingTestByChannel(Sample, FQuat::Identity, ECC_Pawn, Probe))
+			{
+				Samples.Add(Sample);
+			}
+		}
+
+		// Hidden is only claimed when the whole view volume was sampled
+		const bool bFullySampled = Samples.Num() == SampleOffsets.Num();
+
+		if (Samples.Num() > 0)
+		{
+			Data->CellBaked[c] = 1;
+
+			for (int32 p = 0; p < Data->PointLocations.Num(); ++p)
+			{
+				const FVector& Anchor = Data->PointLocations[p];
+				if (FVector::DistSquared(Center, Anchor) > ListRangeSq) continue;
+
+				FCollisionQueryParams Params(SCENE_QUERY_STAT(GrappleBakeVisibility), false, PointActors[p]);
+				int32 NumVisible = 0;
+				int32 NumTraced = 0;
+				for (const FVector& Sample : Samples)
+				{
+					NumVisible += World->LineTraceTestByChannel(Sample, Anchor, ECC_Visibility, Params) ? 0 : 1;
+					++NumTraced;
+
+					// Mixed already: the answer is Partial whatever the rest say
+					if (NumVisible > 0 && NumVisible < NumTraced) break;
+				}
+
+				EGrappleBakedVisibility State = EGrappleBakedVisibility::Partial;
+				if (NumVisible == Samples.Num())
+				{
+					State = EGrappleBakedVisibility::Visible;
+				}
+				else if (NumVisible == 0 && bFullySampled)
+				{
+					State = EGrappleBakedVisibility::Hidden;
+				}
+
+				// Anchors are visited in index order, so each cell's entries come out sorted
+				Data->CellEntries.Add((uint32(p) << 2) | uint32(State));
+			}
+		}
+
+		Data->CellStart[c + 1] = Data->CellEntries.Num();
+
+		const int32 Percent = (c + 1) * 100 / NumCells;
+		if (Percent / 10 != LastPercent / 10)
+		{
+			LastPercent = Percent;
+			UE_LOG(LogTemp, Display, TEXT("GrapplePointBake: visibilidad %d%%"), Percent);
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("GrapplePointBake: %d entradas de visibilidad (%.1f KB)"),
+		Data->CellEntries.Num(), (Data->CellEntries.Num() * sizeof(uint32) + NumCells * (sizeof(int32) + 1)) / 1024.0f);
+}
+
+bool UGrapplePointBakeCommandlet::SaveBakeData(UGrapplePointBakeData* Data, const FString& PackageName) const
+{
+#if WITH_EDITOR
+	UPackage* Package = Data->GetOutermost();
+	Package->MarkPackageDirty();
+
+	const FString Filename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_NoError;
+
+	if (!UPackage::SavePackage(Package, Data, *Filename, SaveArgs))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GrapplePointBake: no se pudo guardar %s"), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("GrapplePointBake: guardado %s"), *Filename);
+	return true;
+#else
+	UE_LOG(LogTemp, Error, TEXT("GrapplePointBake: guardar requiere el editor (UnrealEditor-Cmd)"));
+	return false;
+#endif
+}
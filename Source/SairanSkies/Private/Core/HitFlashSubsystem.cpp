@@ -0,0 +1,102 @@
+// SairanSkies - Hit Flash
+
+#include "Core/HitFlashSubsystem.h"
+#include "Core/SairanStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Hit Flash Tick"), STAT_Sairan_HitFlashTick, STATGROUP_SairanVFX);
+
+void UHitFlashSubsystem::Deinitialize()
+{
+	Flashes.Empty();
+	IndexByComponent.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UHitFlashSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHitFlashSubsystem, STATGROUP_Tickables);
+}
+
+// ── Flash ─────────────────────────────────────────────────────────────────────
+
+void UHitFlashSubsystem::Flash(UPrimitiveComponent* Component, FLinearColor Color, float Duration)
+{
+	if (!IsValid(Component)) return;
+
+	const float EndTime = GetWorld()->GetTimeSeconds() + Duration;
+
+	// Ya parpadeando: alargar, y solo escribir si el golpe trae otro color
+	if (const int32* Index = IndexByComponent.Find(Component))
+	{
+		FActiveFlash& Active = Flashes[*Index];
+		Active.EndTime = FMath::Max(Active.EndTime, EndTime);
+		if (!Active.Color.Equals(Color))
+		{
+			Active.Color = Color;
+			WriteFlashColor(Component, Color);
+		}
+		return;
+	}
+
+	WriteFlashColor(Component, Color);
+	WriteFlashAmount(Component, 1.0f);
+
+	FActiveFlash& Entry = Flashes.AddDefaulted_GetRef();
+	Entry.Component = Component;
+	Entry.Key = Component;
+	Entry.Color = Color;
+	Entry.EndTime = EndTime;
+	IndexByComponent.Add(Component, Flashes.Num() - 1);
+}
+
+void UHitFlashSubsystem::ClearFlash(UPrimitiveComponent* Component)
+{
+	if (const int32* Index = IndexByComponent.Find(Component))
+	{
+		WriteFlashAmount(Component, 0.0f);
+		RemoveAt(*Index);
+	}
+}
+
+void UHitFlashSubsystem::Tick(float DeltaTime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_HitFlashTick, VFX);
+
+	const float Now = GetWorld()->GetTimeSeconds();
+
+	for (int32 i = Flashes.Num() - 1; i >= 0; --i)
+	{
+		if (Flashes[i].EndTime > Now && Flashes[i].Component.IsValid()) continue;
+
+		if (UPrimitiveComponent* Component = Flashes[i].Component.Get())
+		{
+			WriteFlashAmount(Component, 0.0f);
+		}
+		RemoveAt(i);
+	}
+}
+
+// ── Helpers ───────────────────────────────────────────────────────────────────
+
+void UHitFlashSubsystem::WriteFlashAmount(UPrimitiveComponent* Component, float Amount) const
+{
+	Component->SetCustomPrimitiveDataFloat(CustomDataIndex, Amount);
+}
+
+void UHitFlashSubsystem::WriteFlashColor(UPrimitiveComponent* Component, const FLinearColor& Color) const
+{
+	Component->SetCustomPrimitiveDataVector3(CustomDataIndex + 1, FVector(Color.R, Color.G, Color.B));
+}
+
+void UHitFlashSubsystem::RemoveAt(int32 Index)
+{
+	IndexByComponent.Remove(Flashes[Index].Key);
+
+	Flashes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (Flashes.IsValidIndex(Index))
+	{
+		IndexByComponent.Add(Flashes[Index].Key, Index);
+	}
+}
@@ -0,0 +1,9 @@
+// SairanSkies - Profiling
+
+#include "Core/SairanStats.h"
+
+DEFINE_STAT(STAT_Sairan_EnemiesTicked);
+DEFINE_STAT(STAT_Sairan_AITraces);
+DEFINE_STAT(STAT_Sairan_CombatTraces);
+DEFINE_STAT(STAT_Sairan_TraversalTraces);
+DEFINE_STAT(STAT_Sairan_WidgetsSpawned);
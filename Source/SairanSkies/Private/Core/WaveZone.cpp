@@ -4,6 +4,7 @@
 #include "Components/BoxComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Enemies/EnemyBase.h"
+#include "AI/EnemyPoolSubsystem.h"
 #include "GameFramework/Character.h"
 #include "Sound/SoundBase.h"
 
@@ -39,6 +40,10 @@ void AWaveZone::OnBeginOverlap(UPrimitiveComponent*, AActor* OtherActor,
 
 	if (!bAllWavesCleared && CurrentWave == 0)
 	{
+		if (UEnemyPoolSubsystem* Pool = GetWorld()->GetSubsystem<UEnemyPoolSubsystem>())
+		{
+			Pool->Prewarm(EnemyClass, PrewarmCount, GetActorLocation());
+		}
 		StartWave(1);
 	}
 }
@@ -78,9 +83,7 @@ void AWaveZone::StartWave(int32 WaveIndex)
 
 	CurrentWave = WaveIndex;
 
-	// 2^(WaveIndex-1) → oleada 1 = 1×, oleada 2 = 2×, oleada 3 = 4×…
-	const int32 TotalEnemies = BaseEnemyCount
-		* FMath::RoundToInt(FMath::Pow(2.0f, static_cast<float>(WaveIndex - 1)));
+	const int32 TotalEnemies = GetWaveEnemyCount(WaveIndex);
 
 	EnemiesAliveCount   = TotalEnemies;
 	EnemiesToSpawnQueue = TotalEnemies;
@@ -90,9 +93,26 @@ void AWaveZone::StartWave(int32 WaveIndex)
 	if (WaveStartSound)
 		UGameplayStatics::PlaySoundAtLocation(GetWorld(), WaveStartSound, GetActorLocation());
 
+	// Pool para la siguiente oleada: los muertos de esta vuelven al pool, el
+	// resto se crea poco a poco mientras se combate
+	if (MaxWaves == 0 || WaveIndex < MaxWaves)
+	{
+		if (UEnemyPoolSubsystem* Pool = GetWorld()->GetSubsystem<UEnemyPoolSubsystem>())
+		{
+			Pool->Prewarm(EnemyClass, GetWaveEnemyCount(WaveIndex + 1), GetActorLocation());
+		}
+	}
+
 	SpawnNextEnemy();
 }
 
+int32 AWaveZone::GetWaveEnemyCount(int32 WaveIndex) const
+{
+	// 2^(WaveIndex-1) → oleada 1 = 1×, oleada 2 = 2×, oleada 3 = 4×…
+	return BaseEnemyCount
+		* FMath::RoundToInt(FMath::Pow(2.0f, static_cast<float>(WaveIndex - 1)));
+}
+
 void AWaveZone::SpawnNextEnemy()
 {
 	if (!EnemyClass || EnemiesToSpawnQueue <= 0) return;
@@ -106,16 +126,19 @@ void AWaveZone::SpawnNextEnemy()
 			FMath::RandRange(-100.f, 100.f), 0.f);
 	}
 
-	FActorSpawnParameters Params;
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	const FRotator SpawnRot(0.f, FMath::RandRange(0.f, 360.f), 0.f);
 
-	AEnemyBase* Enemy = GetWorld()->SpawnActor<AEnemyBase>(EnemyClass, SpawnLoc,
-		FRotator(0.f, FMath::RandRange(0.f, 360.f), 0.f), Params);
+	// Reutiliza un enemigo del pool (solo spawnea si el pool está vacío)
+	AEnemyBase* Enemy = nullptr;
+	if (UEnemyPoolSubsystem* Pool = GetWorld()->GetSubsystem<UEnemyPoolSubsystem>())
+	{
+		Enemy = Pool->AcquireEnemy(EnemyClass, SpawnLoc, SpawnRot);
+	}
 
 	if (Enemy)
 	{
 		ActiveEnemies.Add(Enemy);
-		Enemy->OnEnemyDeath.AddDynamic(this, &AWaveZone::OnEnemyDied);
+		Enemy->OnEnemyDeath.AddUniqueDynamic(this, &AWaveZone::OnEnemyDied);
 	}
 	else
 	{
@@ -137,6 +160,21 @@ void AWaveZone::OnEnemyDied(AController* /*InstigatorController*/)
 {
 	EnemiesAliveCount = FMath::Max(0, EnemiesAliveCount - 1);
 
+	// Los muertos dejan de pertenecer a la zona: tras el ragdoll vuelven al pool
+	// y pueden reutilizarse en otra zona
+	for (int32 i = ActiveEnemies.Num() - 1; i >= 0; --i)
+	{
+		AEnemyBase* Enemy = ActiveEnemies[i];
+		if (!IsValid(Enemy) || Enemy->IsDead())
+		{
+			if (IsValid(Enemy))
+			{
+				Enemy->OnEnemyDeath.RemoveDynamic(this, &AWaveZone::OnEnemyDied);
+			}
+			ActiveEnemies.RemoveAtSwap(i);
+		}
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("WaveZone: Enemigo muerto (%d vivos, %d en cola)"),
 		EnemiesAliveCount, EnemiesToSpawnQueue);
 
@@ -155,12 +193,21 @@ void AWaveZone::ResetZone()
 {
 	GetWorldTimerManager().ClearTimer(SpawnStaggerTimer);
 
+	// Los vivos vuelven al pool (los muertos vuelven solos tras el ragdoll)
+	UEnemyPoolSubsystem* Pool = GetWorld()->GetSubsystem<UEnemyPoolSubsystem>();
 	for (AEnemyBase* Enemy : ActiveEnemies)
 	{
 		if (IsValid(Enemy))
 		{
 			Enemy->OnEnemyDeath.RemoveDynamic(this, &AWaveZone::OnEnemyDied);
-			Enemy->Destroy();
+			if (Pool)
+			{
+				Pool->ReleaseEnemy(Enemy);
+			}
+			else
+			{
+				Enemy->Destroy();
+			}
 		}
 	}
 	ActiveEnemies.Empty();
@@ -14,13 +14,21 @@
 #include "Engine/World.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Sound/SoundBase.h"
-#include "Materials/MaterialInstanceDynamic.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Animation/AnimInstance.h"
 #include "Enemies/DamageNumberComponent.h"
+#include "Enemies/EnemyMovementComponent.h"
 #include "Components/CapsuleComponent.h"
-#include "Components/WidgetComponent.h"
-#include "UI/EnemyHealthBarWidget.h"
+#include "UI/EnemyHealthBarSubsystem.h"
 #include "AI/GroupCombatManager.h"
+#include "AI/EnemyRegistrySubsystem.h"
+#include "AI/EnemySimulationManager.h"
+#include "AI/EnemyAmbientDirector.h"
+#include "AI/EnemySignificanceManager.h"
+#include "AI/EnemyLineOfSightCache.h"
+#include "AI/EnemyPoolSubsystem.h"
+#include "AI/EnemyRagdollManager.h"
+#include "Core/HitFlashSubsystem.h"
 #include "Pickups/HealPickup.h"
 #include "Character/SairanCharacter.h"
 #include "Character/UltimateComponent.h"
@@ -37,9 +45,11 @@ const FName AEnemyBase::BB_CanAttack = TEXT("CanAttack");
 // Static attacker tracking
 TArray<AEnemyBase*> AEnemyBase::ActiveAttackers;
 
-AEnemyBase::AEnemyBase()
+AEnemyBase::AEnemyBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UEnemyMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// No actor tick: timers and per-frame behavior run in UEnemySimulationManager
+	PrimaryActorTick.bCanEverTick = false;
 
 	// UPROPERTY defaults
 	BehaviorTree = nullptr;
@@ -50,21 +60,11 @@ AEnemyBase::AEnemyBase()
 	LastKnownTargetLocation = FVector::ZeroVector;
 	CurrentHealth = MaxHealth;
 	bCanAttack = true;
-	TimeSinceLastSawTarget = 0.0f;
-	AttackCooldownTimer = 0.0f;
 	BaseMaxWalkSpeed = 200.0f;
 
 	// Damage numbers component
 	DamageNumberComponent = CreateDefaultSubobject<UDamageNumberComponent>(TEXT("DamageNumberComponent"));
 
-	// Floating health bar
-	HealthBarWidgetComponent = CreateDefaultSubobject<UWidgetComponent>(TEXT("HealthBarWidget"));
-	HealthBarWidgetComponent->SetupAttachment(RootComponent);
-	HealthBarWidgetComponent->SetRelativeLocation(FVector(0.0f, 0.0f, 120.0f));
-	HealthBarWidgetComponent->SetWidgetSpace(EWidgetSpace::Screen);
-	HealthBarWidgetComponent->SetDrawSize(FVector2D(150.0f, 15.0f));
-	HealthBarWidgetComponent->SetVisibility(false); // Hidden at full health
-
 	// Enemies should NOT push the player's camera - ignore Camera trace channel
 	GetCapsuleComponent()->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
 	if (GetMesh())
@@ -77,21 +77,17 @@ AEnemyBase::AEnemyBase()
 	
 	// Natural behavior
 	bIsInRandomPause = false;
-	RandomPauseTimer = 0.0f;
 	RandomPauseDuration = 0.0f;
 	bIsLookingAround = false;
-	LookAroundTimer = 0.0f;
+	bIsLookingBack = false;
 	OriginalRotation = FRotator::ZeroRotator;
 	TargetLookRotation = FRotator::ZeroRotator;
 	
 	// Conversation
 	ConversationPartner = nullptr;
-	ConversationTimer = 0.0f;
 	ConversationDuration = 0.0f;
-	GestureTimer = 0.0f;
-	ConversationCooldownTimer = 0.0f;
-	TimeWaitingAtPoint = 0.0f;
 	bIsConversationInitiator = false;
+	bReadyForConversation = false;
 }
 
 void AEnemyBase::BeginPlay()
@@ -106,111 +102,474 @@ void AEnemyBase::BeginPlay()
 
 	CurrentHealth = MaxHealth;
 
-	// Initialize floating health bar widget
-	if (HealthBarWidgetComponent && HealthBarWidgetClass)
+	if (GetCharacterMovement())
 	{
-		HealthBarWidgetComponent->SetWidgetClass(HealthBarWidgetClass);
-		HealthBarWidgetComponent->SetRelativeLocation(FVector(0.0f, 0.0f, HealthBarHeightOffset));
+		BaseMaxWalkSpeed = GetCharacterMovement()->MaxWalkSpeed;
 	}
 
-	if (GetCharacterMovement())
+	// Attachment / collision to restore after a ragdoll when the enemy is reused
+	if (USkeletalMeshComponent* SkelMesh = GetMesh())
 	{
-		BaseMaxWalkSpeed = GetCharacterMovement()->MaxWalkSpeed;
+		MeshRelativeTransform = SkelMesh->GetRelativeTransform();
+		MeshCollisionProfile = SkelMesh->GetCollisionProfileName();
+	}
+
+	// Prewarmed by UEnemyPoolSubsystem: park straight away (unpossess stops the BT the
+	// controller started in PostInitializeComponents) before registering with any manager
+	if (bInPool)
+	{
+		bInPool = false;
+		DeactivateForPool();
+		return;
+	}
+
+	RegisterWithManagers();
+}
+
+void AEnemyBase::RegisterWithManagers()
+{
+	// Register in the spatial hash used for all proximity lookups
+	if (UEnemyRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UEnemyRegistrySubsystem>())
+	{
+		Registry->RegisterEnemy(this);
+	}
+
+	// Shared (async, staggered) line-of-sight traces towards the current target
+	LineOfSightCache = GetWorld()->GetSubsystem<UEnemyLineOfSightCache>();
+	if (LineOfSightCache)
+	{
+		LineOfSightCache->RegisterEnemy(this);
+	}
+
+	// Register timers / per-frame work with the batched simulation
+	SimulationManager = GetWorld()->GetSubsystem<UEnemySimulationManager>();
+	if (SimulationManager)
+	{
+		SimulationManager->RegisterEnemy(this);
 	}
 
+	// Pauses, look-arounds and conversation matching (event-driven)
+	AmbientDirector = GetWorld()->GetSubsystem<UEnemyAmbientDirector>();
+
 	if (PatrolPath)
 	{
 		SetEnemyState(EEnemyState::Patrolling);
 	}
+	else
+	{
+		UpdateConversationWait();
+	}
+
+	// AI LOD: tier (and update rates) from distance / visibility / combat
+	if (UEnemySignificanceManager* Significance = GetWorld()->GetSubsystem<UEnemySignificanceManager>())
+	{
+		Significance->RegisterEnemy(this);
+	}
 }
 
 void AEnemyBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	// Always clean up when this enemy is removed
+	UnregisterFromManagers();
+	SimulationManager = nullptr;
+	AmbientDirector = nullptr;
+	LineOfSightCache = nullptr;
+
+	if (OwningPool)
+	{
+		OwningPool->NotifyEnemyDestroyed(this);
+		OwningPool = nullptr;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AEnemyBase::UnregisterFromManagers()
+{
 	UnregisterAsAttacker();
 	ActiveAttackers.Remove(this);
-	
-	Super::EndPlay(EndPlayReason);
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UEnemyRegistrySubsystem* Registry = World->GetSubsystem<UEnemyRegistrySubsystem>())
+		{
+			Registry->UnregisterEnemy(this);
+		}
+
+		if (UEnemySignificanceManager* Significance = World->GetSubsystem<UEnemySignificanceManager>())
+		{
+			Significance->UnregisterEnemy(this);
+		}
+
+		if (UGroupCombatManager* CombatManager = World->GetSubsystem<UGroupCombatManager>())
+		{
+			CombatManager->UnregisterCombatEnemy(this);
+		}
+	}
+
+	if (SimulationManager)
+	{
+		SimulationManager->UnregisterEnemy(this);
+	}
+
+	if (AmbientDirector)
+	{
+		AmbientDirector->UnregisterEnemy(this);
+	}
+
+	if (LineOfSightCache)
+	{
+		LineOfSightCache->UnregisterEnemy(this);
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UEnemyRagdollManager* Ragdolls = World->GetSubsystem<UEnemyRagdollManager>())
+		{
+			Ragdolls->RemoveCorpse(this);
+		}
+
+		if (UEnemyHealthBarSubsystem* HealthBars = World->GetSubsystem<UEnemyHealthBarSubsystem>())
+		{
+			HealthBars->RemoveEnemy(this);
+		}
+	}
 }
 
-void AEnemyBase::Tick(float DeltaTime)
+// ==================== POOLING ====================
+
+void AEnemyBase::DeactivateForPool()
 {
-	Super::Tick(DeltaTime);
+	UWorld* World = GetWorld();
+	if (World)
+	{
+		World->GetTimerManager().ClearTimer(DespawnTimerHandle);
+	}
+	StopHitFlash();
 
-	if (CurrentState == EEnemyState::Dead)
+	// Ends conversations / attacker slots through the usual state cleanup
+	SetEnemyState(EEnemyState::Dead);
+
+	// OnUnPossess leaves perception + avoidance and stops the BT
+	if (AController* OwnController = GetController())
 	{
-		return;
+		PooledController = OwnController;
+		OwnController->UnPossess();
 	}
 
-	// Update cooldowns
-	if (!bCanAttack)
+	UnregisterFromManagers();
+
+	// ── Deshacer ragdoll / pose congelada ──
+	if (USkeletalMeshComponent* SkelMesh = GetMesh())
 	{
-		AttackCooldownTimer -= DeltaTime;
-		if (AttackCooldownTimer <= 0.0f)
+		if (UAnimInstance* AnimInstance = SkelMesh->GetAnimInstance())
 		{
-			bCanAttack = true;
+			AnimInstance->StopAllMontages(0.0f);
 		}
+		SkelMesh->bNoSkeletonUpdate = false;
+		SkelMesh->SetAllBodiesSimulatePhysics(false);
+		SkelMesh->SetSimulatePhysics(false);
+		SkelMesh->SetCollisionProfileName(MeshCollisionProfile);
+		SkelMesh->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+		SkelMesh->SetRelativeTransform(MeshRelativeTransform);
+		SkelMesh->SetComponentTickEnabled(false);
+	}
+
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->StopMovementImmediately();
+		Movement->DisableMovement();
+		Movement->SetComponentTickEnabled(false);
+	}
+
+	if (DamageNumberComponent)
+	{
+		DamageNumberComponent->ResetCombo();
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	bInPool = true;
+}
+
+void AEnemyBase::ResetForReuse(const FVector& Location, const FRotator& Rotation)
+{
+	bInPool = false;
+
+	// ── Estado ──
+	// Directo: SetEnemyState nunca sale de Dead
+	CurrentState = EEnemyState::Idle;
+	CurrentHealth = MaxHealth;
+	CurrentTarget = nullptr;
+	LastKnownTargetLocation = FVector::ZeroVector;
+	bCanAttack = true;
+	NearbyAlliesCount = 0;
+	bIsActiveAttacker = false;
+
+	bIsInRandomPause = false;
+	RandomPauseDuration = 0.0f;
+	bIsLookingAround = false;
+	bIsLookingBack = false;
+
+	ConversationPartner = nullptr;
+	ConversationDuration = 0.0f;
+	bIsConversationInitiator = false;
+	bReadyForConversation = false;
+	ConversationCooldownEndTime = 0.0f;
+
+	SignificanceTier = EEnemySignificance::Critical;
+
+	// ── Componentes ──
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+
+	// Same encroachment adjustment SpawnActor does with AdjustIfPossibleButAlwaysSpawn
+	if (!TeleportTo(Location, Rotation))
+	{
+		SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
 	}
 
-	if (ConversationCooldownTimer > 0.0f)
+	if (USkeletalMeshComponent* SkelMesh = GetMesh())
 	{
-		ConversationCooldownTimer -= DeltaTime;
+		SkelMesh->SetComponentTickEnabled(true);
 	}
 
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->SetComponentTickEnabled(true);
+		Movement->SetMovementMode(MOVE_Walking);
+		Movement->MaxWalkSpeed = BaseMaxWalkSpeed;
+	}
 
-	// Update natural behaviors
-	if (bIsInRandomPause)
+	// ── IA ──
+	// Possess restarts the BT, which re-initialises the blackboard values.
+	// Before RegisterWithManagers, same order as a fresh spawn: the significance
+	// manager applies the initial tier (e.g. sight off for Low) to the perception
+	// registration OnPossess makes, not before it exists.
+	if (IsValid(PooledController))
 	{
-		UpdateRandomPause(DeltaTime);
+		PooledController->Possess(this);
 	}
+	else
+	{
+		SpawnDefaultController();
+	}
+	PooledController = nullptr;
 
-	if (bIsLookingAround)
+	RegisterWithManagers();
+}
+
+// ==================== SIMULATION ====================
+
+void AEnemyBase::SetSimTimer(EEnemySimTimer Timer, float Seconds)
+{
+	if (SimulationManager)
+	{
+		SimulationManager->SetTimer(this, Timer, Seconds);
+	}
+}
+
+void AEnemyBase::ClearSimTimer(EEnemySimTimer Timer)
+{
+	if (SimulationManager)
+	{
+		SimulationManager->ClearTimer(this, Timer);
+	}
+}
+
+bool AEnemyBase::IsSimTimerActive(EEnemySimTimer Timer) const
+{
+	return SimulationManager && SimulationManager->IsTimerActive(this, Timer);
+}
+
+void AEnemyBase::RefreshSimulationContinuous()
+{
+	if (!SimulationManager)
+	{
+		return;
+	}
+
+	uint8 Mask = EEnemySimContinuous::None;
+	if (CurrentState != EEnemyState::Dead)
+	{
+		if (bIsLookingAround)
+		{
+			Mask |= EEnemySimContinuous::LookAround;
+		}
+		if (CurrentState == EEnemyState::Conversing && ConversationPartner)
+		{
+			Mask |= EEnemySimContinuous::FacePartner;
+		}
+		if (CurrentTarget && IsInCombat())
+		{
+			Mask |= EEnemySimContinuous::TrackTarget;
+		}
+	}
+	SimulationManager->SetContinuousMask(this, Mask);
+
+	// The LoseSight countdown only runs while tracking a target in combat
+	if ((Mask & EEnemySimContinuous::TrackTarget) == 0)
+	{
+		ClearSimTimer(EEnemySimTimer::LoseSight);
+	}
+	else if (!IsSimTimerActive(EEnemySimTimer::LoseSight))
+	{
+		SetSimTimer(EEnemySimTimer::LoseSight, PerceptionConfig.LoseSightTime);
+	}
+}
+
+void AEnemyBase::UpdateSimulationContinuous(uint8 Mask, float DeltaTime)
+{
+	if (Mask & EEnemySimContinuous::LookAround)
 	{
 		UpdateLookAround(DeltaTime);
 	}
 
-	// Update conversation
-	if (CurrentState == EEnemyState::Conversing)
+	if (Mask & EEnemySimContinuous::FacePartner)
 	{
 		UpdateConversation(DeltaTime);
 	}
 
-	// Track time waiting at point for conversation trigger
-	if (CurrentState == EEnemyState::Idle || bIsInRandomPause)
+	if (Mask & EEnemySimContinuous::TrackTarget)
 	{
-		TimeWaitingAtPoint += DeltaTime;
-		
-		// Try to start conversation if waiting long enough
-		if (TimeWaitingAtPoint >= ConversationConfig.TimeBeforeConversation && CanStartConversation())
+		UpdateTargetTracking();
+	}
+}
+
+void AEnemyBase::UpdateTargetTracking()
+{
+	if (CurrentTarget && CanSeeTarget())
+	{
+		LastKnownTargetLocation = CurrentTarget->GetActorLocation();
+		SetSimTimer(EEnemySimTimer::LoseSight, PerceptionConfig.LoseSightTime);
+		SyncBlackboard(EEnemyBlackboardSync::Distance | EEnemyBlackboardSync::TargetLocation);
+	}
+	else
+	{
+		SyncBlackboard(EEnemyBlackboardSync::Distance);
+	}
+}
+
+void AEnemyBase::SyncBlackboard(uint8 Mask)
+{
+	if (AEnemyAIController* AIController = Cast<AEnemyAIController>(GetController()))
+	{
+		AIController->SyncBlackboard(Mask);
+	}
+}
+
+void AEnemyBase::SetSignificance(EEnemySignificance NewTier)
+{
+	SignificanceTier = NewTier;
+}
+
+float AEnemyBase::GetTimeSinceLastSawTarget() const
+{
+	if (!CurrentTarget || !SimulationManager)
+	{
+		return 0.0f;
+	}
+	const float Remaining = SimulationManager->GetTimerRemaining(this, EEnemySimTimer::LoseSight);
+	return FMath::Max(0.0f, PerceptionConfig.LoseSightTime - Remaining);
+}
+
+void AEnemyBase::OnSimulationTimerExpired(EEnemySimTimer Timer)
+{
+	if (CurrentState == EEnemyState::Dead)
+	{
+		return;
+	}
+
+	switch (Timer)
+	{
+	case EEnemySimTimer::AttackCooldown:
+		bCanAttack = true;
+		SyncBlackboard(EEnemyBlackboardSync::CanAttack);
+		break;
+
+	case EEnemySimTimer::LoseSight:
+		if (CurrentTarget && IsInCombat())
 		{
-			AEnemyBase* Partner = FindNearbyEnemyForConversation();
-			if (Partner)
-			{
-				TryStartConversation(Partner);
-			}
+			LoseTarget();
 		}
+		break;
+
+	default:
+		break;
 	}
-	else if (CurrentState != EEnemyState::Conversing)
+}
+
+// ==================== AMBIENT ====================
+
+void AEnemyBase::ScheduleAmbient(EEnemyAmbientEvent Event, float Seconds)
+{
+	if (AmbientDirector)
 	{
-		TimeWaitingAtPoint = 0.0f;
+		AmbientDirector->Schedule(this, Event, Seconds);
 	}
+}
+
+void AEnemyBase::CancelAmbient(EEnemyAmbientEvent Event)
+{
+	if (AmbientDirector)
+	{
+		AmbientDirector->Cancel(this, Event);
+	}
+}
 
-	// Handle target tracking
-	if (CurrentTarget && IsInCombat())
+bool AEnemyBase::IsAmbientScheduled(EEnemyAmbientEvent Event) const
+{
+	return AmbientDirector && AmbientDirector->IsScheduled(this, Event);
+}
+
+void AEnemyBase::OnAmbientEvent(EEnemyAmbientEvent Event)
+{
+	if (CurrentState == EEnemyState::Dead)
 	{
-		if (CanSeeTarget())
+		return;
+	}
+
+	switch (Event)
+	{
+	case EEnemyAmbientEvent::RandomPauseEnd:
+		EndRandomPause();
+		break;
+
+	case EEnemyAmbientEvent::LookAround:
+		AdvanceLookAround();
+		break;
+
+	case EEnemyAmbientEvent::ConversationWait:
+		// The director pairs candidates in its next matching pass
+		bReadyForConversation = true;
+		if (AmbientDirector)
 		{
-			TimeSinceLastSawTarget = 0.0f;
-			LastKnownTargetLocation = CurrentTarget->GetActorLocation();
+			AmbientDirector->AddConversationCandidate(this);
 		}
-		else
+		break;
+
+	case EEnemyAmbientEvent::ConversationEnd:
+		// Only the initiator ends the conversation (also ends the partner's)
+		if (bIsConversationInitiator)
 		{
-			TimeSinceLastSawTarget += DeltaTime;
-			if (TimeSinceLastSawTarget >= PerceptionConfig.LoseSightTime)
+			EndConversation();
+		}
+		break;
+
+	case EEnemyAmbientEvent::Gesture:
+		if (CurrentState == EEnemyState::Conversing)
+		{
+			ScheduleAmbient(EEnemyAmbientEvent::Gesture, ConversationConfig.GestureInterval);
+			if (FMath::FRand() < ConversationConfig.ChanceToGesture)
 			{
-				LoseTarget();
+				PerformConversationGesture();
 			}
 		}
+		break;
+
+	default:
+		break;
 	}
 }
 
@@ -277,6 +636,10 @@ void AEnemyBase::SetEnemyState(EEnemyState NewState)
 	{
 		EndConversation();
 	}
+
+	UpdateConversationWait();
+	RefreshSimulationContinuous();
+	SyncBlackboard(EEnemyBlackboardSync::State | EEnemyBlackboardSync::CanAttack);
 }
 
 bool AEnemyBase::IsInCombat() const
@@ -301,6 +664,11 @@ bool AEnemyBase::CanSeeTarget() const
 		return false;
 	}
 
+	if (LineOfSightCache)
+	{
+		return LineOfSightCache->CanSeeTarget(this);
+	}
+
 	FHitResult HitResult;
 	FVector Start = GetActorLocation() + FVector(0, 0, 50);
 	FVector End = CurrentTarget->GetActorLocation() + FVector(0, 0, 50);
@@ -318,6 +686,11 @@ bool AEnemyBase::CanSeeTarget() const
 	return HitResult.GetActor() == CurrentTarget;
 }
 
+FEnemyLineOfSightResult AEnemyBase::GetTargetLineOfSight() const
+{
+	return LineOfSightCache ? LineOfSightCache->GetLineOfSight(this) : FEnemyLineOfSightResult();
+}
+
 bool AEnemyBase::IsAlerted() const
 {
 	return CurrentTarget != nullptr || IsInCombat();
@@ -399,6 +772,9 @@ void AEnemyBase::LoseTarget()
 		}
 
 		CurrentTarget = nullptr;
+		RefreshSimulationContinuous();
+		SyncBlackboard(EEnemyBlackboardSync::Target | EEnemyBlackboardSync::CanSeeTarget |
+			EEnemyBlackboardSync::Distance | EEnemyBlackboardSync::CanAttack);
 		OnPlayerLost.Broadcast();
 
 		if (LastKnownTargetLocation != FVector::ZeroVector)
@@ -430,7 +806,8 @@ void AEnemyBase::SetTarget(AActor* NewTarget, EEnemySenseType SenseType)
 	bool bNewTarget = (CurrentTarget != NewTarget);
 	CurrentTarget = NewTarget;
 	LastKnownTargetLocation = NewTarget->GetActorLocation();
-	TimeSinceLastSawTarget = 0.0f;
+	SetSimTimer(EEnemySimTimer::LoseSight, PerceptionConfig.LoseSightTime);
+	SyncBlackboard(EEnemyBlackboardSync::Target | EEnemyBlackboardSync::CanSeeTarget | EEnemyBlackboardSync::Distance);
 
 	if (bNewTarget)
 	{
@@ -448,7 +825,15 @@ void AEnemyBase::SetTarget(AActor* NewTarget, EEnemySenseType SenseType)
 		}
 
 		SetEnemyState(EEnemyState::Chasing);
+
+		// Don't wait for the round-robin: combat must run at full rate now
+		if (UEnemySignificanceManager* Significance = GetWorld()->GetSubsystem<UEnemySignificanceManager>())
+		{
+			Significance->RequestImmediateEvaluation(this);
+		}
 	}
+
+	RefreshSimulationContinuous();
 }
 
 // ==================== COMBAT ====================
@@ -464,7 +849,8 @@ void AEnemyBase::Attack()
 
 	// Marcar cooldown de ataque (el daño lo aplica BTTask_AttackTarget con varianza)
 	bCanAttack = false;
-	AttackCooldownTimer = CombatConfig.AttackCooldown;
+	SetSimTimer(EEnemySimTimer::AttackCooldown, CombatConfig.AttackCooldown);
+	SyncBlackboard(EEnemyBlackboardSync::CanAttack);
 
 	PlayRandomSound(SoundConfig.AttackSounds);
 
@@ -518,6 +904,22 @@ void AEnemyBase::Die(AController* InstigatorController)
 	SetEnemyState(EEnemyState::Dead);
 	CurrentHealth = 0.0f;
 
+	// Dead enemies have no timers or per-frame work
+	if (SimulationManager)
+	{
+		SimulationManager->UnregisterEnemy(this);
+	}
+	if (AmbientDirector)
+	{
+		AmbientDirector->UnregisterEnemy(this);
+	}
+
+	// Back to full update rates for the ragdoll, then stop LOD management
+	if (UEnemySignificanceManager* Significance = GetWorld()->GetSubsystem<UEnemySignificanceManager>())
+	{
+		Significance->UnregisterEnemy(this);
+	}
+
 	PlayRandomSound(SoundConfig.DeathSounds);
 	OnEnemyDeath.Broadcast(InstigatorController);
 
@@ -537,25 +939,20 @@ void AEnemyBase::Die(AController* InstigatorController)
 	}
 
 	// Hide health bar on death
-	if (HealthBarWidgetComponent)
+	if (UEnemyHealthBarSubsystem* HealthBars = GetWorld()->GetSubsystem<UEnemyHealthBarSubsystem>())
 	{
-		HealthBarWidgetComponent->SetVisibility(false);
+		HealthBars->RemoveEnemy(this);
 	}
 
 	// ── Ragdoll ──
-	if (USkeletalMeshComponent* SkelMesh = GetMesh())
+	// Budgeted: simulate, death montage or frozen pose (see UEnemyRagdollManager)
+	if (UEnemyRagdollManager* Ragdolls = GetWorld()->GetSubsystem<UEnemyRagdollManager>())
 	{
-		SkelMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-		SkelMesh->SetCollisionProfileName(TEXT("Ragdoll"));
-		SkelMesh->SetAllBodiesSimulatePhysics(true);
-		SkelMesh->SetSimulatePhysics(true);
-
-		// Impulso hacia atrás para que no caiga en vertical sin vida
-		if (DeathRagdollImpulse > 0.0f)
-		{
-			FVector ImpulseDir = (-GetActorForwardVector() + FVector(0.f, 0.f, 0.3f)).GetSafeNormal();
-			SkelMesh->AddImpulse(ImpulseDir * DeathRagdollImpulse, NAME_None, /*bVelChange=*/true);
-		}
+		Ragdolls->AddCorpse(this);
+	}
+	else
+	{
+		StartRagdoll();
 	}
 
 	if (GetCharacterMovement())
@@ -568,13 +965,38 @@ void AEnemyBase::Die(AController* InstigatorController)
 	// Posible drop de curación
 	TryDropHeal();
 
-	// Despawn after delay
+	// Despawn after delay (pooled enemies go back to their pool instead)
 	GetWorld()->GetTimerManager().SetTimer(DespawnTimerHandle, [this]()
 	{
-		Destroy();
+		if (OwningPool)
+		{
+			OwningPool->ReleaseEnemy(this);
+		}
+		else
+		{
+			Destroy();
+		}
 	}, DespawnDelay, false);
 }
 
+void AEnemyBase::StartRagdoll()
+{
+	if (USkeletalMeshComponent* SkelMesh = GetMesh())
+	{
+		SkelMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+		SkelMesh->SetCollisionProfileName(TEXT("Ragdoll"));
+		SkelMesh->SetAllBodiesSimulatePhysics(true);
+		SkelMesh->SetSimulatePhysics(true);
+
+		// Impulso hacia atrás para que no caiga en vertical sin vida
+		if (DeathRagdollImpulse > 0.0f)
+		{
+			FVector ImpulseDir = (-GetActorForwardVector() + FVector(0.f, 0.f, 0.3f)).GetSafeNormal();
+			SkelMesh->AddImpulse(ImpulseDir * DeathRagdollImpulse, NAME_None, /*bVelChange=*/true);
+		}
+	}
+}
+
 void AEnemyBase::TryDropHeal()
 {
 	if (!HealPickupClass) return;
@@ -642,20 +1064,19 @@ void AEnemyBase::AlertNearbyAllies(AActor* Target)
 		return;
 	}
 
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AEnemyBase::StaticClass(), FoundActors);
+	UEnemyRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UEnemyRegistrySubsystem>();
+	if (!Registry)
+	{
+		return;
+	}
+
+	TArray<AEnemyBase*> Allies;
+	Registry->QueryRadius(GetActorLocation(), CombatConfig.AllyDetectionRadius, Allies, this);
+	NearbyAlliesCount = Allies.Num();
 
-	for (AActor* Actor : FoundActors)
+	for (AEnemyBase* Ally : Allies)
 	{
-		AEnemyBase* Ally = Cast<AEnemyBase>(Actor);
-		if (Ally && Ally != this && !Ally->IsDead())
-		{
-			float Distance = FVector::Dist(GetActorLocation(), Ally->GetActorLocation());
-			if (Distance <= CombatConfig.AllyDetectionRadius)
-			{
-				Ally->ReceiveAlertFromAlly(Target, this);
-			}
-		}
+		Ally->ReceiveAlertFromAlly(Target, this);
 	}
 }
 
@@ -801,7 +1222,8 @@ void AEnemyBase::StartRandomPause()
 
 	bIsInRandomPause = true;
 	RandomPauseDuration = FMath::RandRange(BehaviorConfig.MinPauseDuration, BehaviorConfig.MaxPauseDuration);
-	RandomPauseTimer = 0.0f;
+	ScheduleAmbient(EEnemyAmbientEvent::RandomPauseEnd, RandomPauseDuration);
+	UpdateConversationWait();
 
 	// Stop movement
 	if (GetCharacterMovement())
@@ -826,22 +1248,14 @@ void AEnemyBase::EndRandomPause()
 	}
 
 	bIsInRandomPause = false;
-	RandomPauseTimer = 0.0f;
+	CancelAmbient(EEnemyAmbientEvent::RandomPauseEnd);
 	StopLookAround();
+	UpdateConversationWait();
 
 	SetPatrolSpeedWithVariation();
 	OnRandomPauseEnded();
 }
 
-void AEnemyBase::UpdateRandomPause(float DeltaTime)
-{
-	RandomPauseTimer += DeltaTime;
-	if (RandomPauseTimer >= RandomPauseDuration)
-	{
-		EndRandomPause();
-	}
-}
-
 void AEnemyBase::StartLookAround()
 {
 	if (bIsLookingAround)
@@ -850,13 +1264,16 @@ void AEnemyBase::StartLookAround()
 	}
 
 	bIsLookingAround = true;
-	LookAroundTimer = 0.0f;
+	bIsLookingBack = false;
 	OriginalRotation = GetActorRotation();
 	
 	float RandomYaw = FMath::RandRange(-BehaviorConfig.MaxLookAroundAngle, BehaviorConfig.MaxLookAroundAngle);
 	TargetLookRotation = OriginalRotation;
 	TargetLookRotation.Yaw += RandomYaw;
 
+	ScheduleAmbient(EEnemyAmbientEvent::LookAround, BehaviorConfig.MaxLookAroundAngle / BehaviorConfig.LookAroundSpeed);
+	RefreshSimulationContinuous();
+
 	OnLookAroundStarted();
 
 	// Play look around montage if available
@@ -874,44 +1291,45 @@ void AEnemyBase::StopLookAround()
 	}
 
 	bIsLookingAround = false;
-	LookAroundTimer = 0.0f;
+	bIsLookingBack = false;
+	CancelAmbient(EEnemyAmbientEvent::LookAround);
+	RefreshSimulationContinuous();
 }
 
-void AEnemyBase::UpdateLookAround(float DeltaTime)
+void AEnemyBase::AdvanceLookAround()
 {
-	LookAroundTimer += DeltaTime;
+	const float LookDuration = BehaviorConfig.MaxLookAroundAngle / BehaviorConfig.LookAroundSpeed;
 
-	float LookDuration = BehaviorConfig.MaxLookAroundAngle / BehaviorConfig.LookAroundSpeed;
-	
-	if (LookAroundTimer < LookDuration)
+	if (!bIsLookingBack)
 	{
-		// Rotate towards target
-		FRotator NewRotation = FMath::RInterpTo(GetActorRotation(), TargetLookRotation, DeltaTime, 2.0f);
-		SetActorRotation(NewRotation);
+		// Rotate back
+		bIsLookingBack = true;
+		ScheduleAmbient(EEnemyAmbientEvent::LookAround, LookDuration);
+		return;
 	}
-	else if (LookAroundTimer < LookDuration * 2.0f)
+
+	// Maybe look in another direction
+	if (FMath::FRand() < 0.5f && bIsInRandomPause)
 	{
-		// Rotate back
-		FRotator NewRotation = FMath::RInterpTo(GetActorRotation(), OriginalRotation, DeltaTime, 2.0f);
-		SetActorRotation(NewRotation);
+		float RandomYaw = FMath::RandRange(-BehaviorConfig.MaxLookAroundAngle, BehaviorConfig.MaxLookAroundAngle);
+		TargetLookRotation = OriginalRotation;
+		TargetLookRotation.Yaw += RandomYaw;
+		bIsLookingBack = false;
+		ScheduleAmbient(EEnemyAmbientEvent::LookAround, LookDuration);
 	}
 	else
 	{
-		// Maybe look in another direction
-		if (FMath::FRand() < 0.5f && bIsInRandomPause)
-		{
-			float RandomYaw = FMath::RandRange(-BehaviorConfig.MaxLookAroundAngle, BehaviorConfig.MaxLookAroundAngle);
-			TargetLookRotation = OriginalRotation;
-			TargetLookRotation.Yaw += RandomYaw;
-			LookAroundTimer = 0.0f;
-		}
-		else
-		{
-			StopLookAround();
-		}
+		StopLookAround();
 	}
 }
 
+void AEnemyBase::UpdateLookAround(float DeltaTime)
+{
+	// Rotate towards target, then back to the original facing
+	const FRotator& Goal = bIsLookingBack ? OriginalRotation : TargetLookRotation;
+	SetActorRotation(FMath::RInterpTo(GetActorRotation(), Goal, DeltaTime, 2.0f));
+}
+
 bool AEnemyBase::ShouldRandomPause() const
 {
 	if (IsInCombat() || bIsInRandomPause || CurrentState == EEnemyState::Conversing)
@@ -927,33 +1345,47 @@ bool AEnemyBase::CanStartConversation() const
 {
 	return !IsInCombat() && 
 		   !IsConversing() && 
-		   ConversationCooldownTimer <= 0.0f &&
+		   GetWorld()->GetTimeSeconds() >= ConversationCooldownEndTime &&
 		   CurrentState != EEnemyState::Dead;
 }
 
-AEnemyBase* AEnemyBase::FindNearbyEnemyForConversation() const
+void AEnemyBase::UpdateConversationWait()
 {
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AEnemyBase::StaticClass(), FoundActors);
+	const bool bWaiting = (CurrentState == EEnemyState::Idle || bIsInRandomPause) && CurrentState != EEnemyState::Dead;
 
-	for (AActor* Actor : FoundActors)
+	if (bWaiting)
 	{
-		AEnemyBase* OtherEnemy = Cast<AEnemyBase>(Actor);
-		if (OtherEnemy && OtherEnemy != this && OtherEnemy->CanStartConversation())
+		// Start counting only once; keep counting across Idle <-> pause transitions
+		if (!bReadyForConversation && !IsAmbientScheduled(EEnemyAmbientEvent::ConversationWait))
 		{
-			float Distance = FVector::Dist(GetActorLocation(), OtherEnemy->GetActorLocation());
-			if (Distance <= ConversationConfig.ConversationRadius)
-			{
-				// Check if they're also waiting
-				if (OtherEnemy->TimeWaitingAtPoint >= ConversationConfig.TimeBeforeConversation)
-				{
-					return OtherEnemy;
-				}
-			}
+			ScheduleAmbient(EEnemyAmbientEvent::ConversationWait, ConversationConfig.TimeBeforeConversation);
 		}
 	}
+	else if (CurrentState != EEnemyState::Conversing)
+	{
+		bReadyForConversation = false;
+		CancelAmbient(EEnemyAmbientEvent::ConversationWait);
+		if (AmbientDirector)
+		{
+			AmbientDirector->RemoveConversationCandidate(this);
+		}
+	}
+}
 
-	return nullptr;
+AEnemyBase* AEnemyBase::FindNearbyEnemyForConversation() const
+{
+	const UEnemyRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UEnemyRegistrySubsystem>();
+	if (!Registry)
+	{
+		return nullptr;
+	}
+
+	return Registry->FindNearest(GetActorLocation(), ConversationConfig.ConversationRadius, this,
+		[](const AEnemyBase* OtherEnemy)
+		{
+			// Check if they're also waiting
+			return OtherEnemy->CanStartConversation() && OtherEnemy->bReadyForConversation;
+		});
 }
 
 bool AEnemyBase::TryStartConversation(AEnemyBase* OtherEnemy)
@@ -967,8 +1399,8 @@ bool AEnemyBase::TryStartConversation(AEnemyBase* OtherEnemy)
 	bIsConversationInitiator = true;
 	ConversationPartner = OtherEnemy;
 	ConversationDuration = FMath::RandRange(ConversationConfig.MinConversationDuration, ConversationConfig.MaxConversationDuration);
-	ConversationTimer = 0.0f;
-	GestureTimer = 0.0f;
+	ScheduleAmbient(EEnemyAmbientEvent::ConversationEnd, ConversationDuration);
+	ScheduleAmbient(EEnemyAmbientEvent::Gesture, ConversationConfig.GestureInterval);
 
 	SetEnemyState(EEnemyState::Conversing);
 	OtherEnemy->JoinConversation(this);
@@ -990,8 +1422,8 @@ void AEnemyBase::JoinConversation(AEnemyBase* Initiator)
 	bIsConversationInitiator = false;
 	ConversationPartner = Initiator;
 	ConversationDuration = Initiator->ConversationDuration;
-	ConversationTimer = 0.0f;
-	GestureTimer = 0.0f;
+	ScheduleAmbient(EEnemyAmbientEvent::ConversationEnd, ConversationDuration);
+	ScheduleAmbient(EEnemyAmbientEvent::Gesture, ConversationConfig.GestureInterval);
 
 	SetEnemyState(EEnemyState::Conversing);
 	OnConversationStarted.Broadcast(Initiator);
@@ -1005,15 +1437,18 @@ void AEnemyBase::EndConversation()
 		if (ConversationPartner->IsConversing())
 		{
 			ConversationPartner->ConversationPartner = nullptr;
-			ConversationPartner->ConversationCooldownTimer = ConversationConfig.ConversationCooldown;
+			ConversationPartner->ConversationCooldownEndTime = GetWorld()->GetTimeSeconds() + ConversationConfig.ConversationCooldown;
 			ConversationPartner->SetEnemyState(EEnemyState::Patrolling);
 			ConversationPartner->OnConversationEnded.Broadcast();
 		}
 	}
 
 	ConversationPartner = nullptr;
-	ConversationCooldownTimer = ConversationConfig.ConversationCooldown;
-	TimeWaitingAtPoint = 0.0f;
+	ConversationCooldownEndTime = GetWorld()->GetTimeSeconds() + ConversationConfig.ConversationCooldown;
+	CancelAmbient(EEnemyAmbientEvent::ConversationEnd);
+	CancelAmbient(EEnemyAmbientEvent::Gesture);
+	CancelAmbient(EEnemyAmbientEvent::ConversationWait);
+	bReadyForConversation = false;
 
 	OnConversationEnded.Broadcast();
 
@@ -1025,35 +1460,13 @@ void AEnemyBase::EndConversation()
 
 void AEnemyBase::UpdateConversation(float DeltaTime)
 {
-	ConversationTimer += DeltaTime;
-	GestureTimer += DeltaTime;
-
-	// Face conversation partner
+	// Face conversation partner (gestures and duration are ambient events)
 	if (ConversationPartner)
 	{
 		FVector ToPartner = (ConversationPartner->GetActorLocation() - GetActorLocation()).GetSafeNormal();
 		FRotator LookAtRotation = ToPartner.Rotation();
 		SetActorRotation(FMath::RInterpTo(GetActorRotation(), LookAtRotation, DeltaTime, 3.0f));
 	}
-
-	// Perform gestures periodically
-	if (GestureTimer >= ConversationConfig.GestureInterval)
-	{
-		GestureTimer = 0.0f;
-		if (FMath::FRand() < ConversationConfig.ChanceToGesture)
-		{
-			PerformConversationGesture();
-		}
-	}
-
-	// End conversation when time is up
-	if (ConversationTimer >= ConversationDuration)
-	{
-		if (bIsConversationInitiator)
-		{
-			EndConversation();
-		}
-	}
 }
 
 void AEnemyBase::PerformConversationGesture()
@@ -1184,15 +1597,10 @@ void AEnemyBase::TakeDamageAtLocation(float DamageAmount, AActor* DamageSource,
 		DamageNumberComponent->SpawnDamageNumber(DamageAmount, GetHealthPercent(), HitWorldLocation);
 	}
 
-	// Update floating health bar
-	if (HealthBarWidgetComponent)
+	// Update floating health bar (pushed to the shared overlay)
+	if (UEnemyHealthBarSubsystem* HealthBars = GetWorld()->GetSubsystem<UEnemyHealthBarSubsystem>())
 	{
-		HealthBarWidgetComponent->SetVisibility(true);
-		UEnemyHealthBarWidget* HealthBarWidget = Cast<UEnemyHealthBarWidget>(HealthBarWidgetComponent->GetUserWidgetObject());
-		if (HealthBarWidget)
-		{
-			HealthBarWidget->UpdateHealth(GetHealthPercent());
-		}
+		HealthBars->ReportHealth(this, GetHealthPercent());
 	}
 
 	if (!CurrentTarget && DamageSource)
@@ -1210,69 +1618,19 @@ void AEnemyBase::TakeDamageAtLocation(float DamageAmount, AActor* DamageSource,
 
 void AEnemyBase::StartHitFlash()
 {
-	USkeletalMeshComponent* MeshComp = GetMesh();
-	if (!MeshComp)
-	{
-		return;
-	}
-
-	// Cache original materials if not already done
-	if (!bMaterialsCached)
-	{
-		OriginalMaterials.Empty();
-		for (int32 i = 0; i < MeshComp->GetNumMaterials(); i++)
-		{
-			OriginalMaterials.Add(MeshComp->GetMaterial(i));
-		}
-		bMaterialsCached = true;
-	}
-
-	// Create a simple emissive material for the flash
-	// We'll override all materials with a solid color
-	if (!FlashMaterialInstance)
+	UHitFlashSubsystem* HitFlash = GetWorld()->GetSubsystem<UHitFlashSubsystem>();
+	if (HitFlash && GetMesh())
 	{
-		// Create a simple material that shows a solid color
-		UMaterial* BaseMaterial = LoadObject<UMaterial>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
-		if (BaseMaterial)
-		{
-			FlashMaterialInstance = UMaterialInstanceDynamic::Create(BaseMaterial, this);
-			if (FlashMaterialInstance)
-			{
-				// Set emissive color for the flash
-				FlashMaterialInstance->SetVectorParameterValue(FName("Color"), HitFlashColor);
-			}
-		}
+		HitFlash->Flash(GetMesh(), HitFlashColor, HitFlashDuration);
 	}
-
-	// Apply flash material to all slots
-	if (FlashMaterialInstance)
-	{
-		for (int32 i = 0; i < MeshComp->GetNumMaterials(); i++)
-		{
-			MeshComp->SetMaterial(i, FlashMaterialInstance);
-		}
-	}
-
-	// Clear any existing timer and set new one to stop the flash
-	GetWorld()->GetTimerManager().ClearTimer(HitFlashTimerHandle);
-	GetWorld()->GetTimerManager().SetTimer(HitFlashTimerHandle, this, &AEnemyBase::StopHitFlash, HitFlashDuration, false);
 }
 
 void AEnemyBase::StopHitFlash()
 {
-	USkeletalMeshComponent* MeshComp = GetMesh();
-	if (!MeshComp || !bMaterialsCached)
+	UHitFlashSubsystem* HitFlash = GetWorld()->GetSubsystem<UHitFlashSubsystem>();
+	if (HitFlash && GetMesh())
 	{
-		return;
-	}
-
-	// Restore original materials
-	for (int32 i = 0; i < OriginalMaterials.Num() && i < MeshComp->GetNumMaterials(); i++)
-	{
-		if (OriginalMaterials[i])
-		{
-			MeshComp->SetMaterial(i, OriginalMaterials[i]);
-		}
+		HitFlash->ClearFlash(GetMesh());
 	}
 }
 
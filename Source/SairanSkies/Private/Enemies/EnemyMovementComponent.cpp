@@ -0,0 +1,24 @@
+// SairanSkies - Enemy Movement Component
+
+#include "Enemies/EnemyMovementComponent.h"
+#include "AI/EnemyAvoidanceManager.h"
+#include "Core/SairanStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Enemy Movement"), STAT_Sairan_EnemyMovement, STATGROUP_SairanAI);
+
+void UEnemyMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	SAIRAN_SCOPE(STAT_Sairan_EnemyMovement, Movement);
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+}
+
+void UEnemyMovementComponent::CalcVelocity(float DeltaTime, float Friction, bool bFluid, float BrakingDeceleration)
+{
+	Super::CalcVelocity(DeltaTime, Friction, bFluid, BrakingDeceleration);
+
+	if (AvoidanceManager && IsMovingOnGround())
+	{
+		AvoidanceManager->ApplyAvoidance(this, Velocity);
+	}
+}
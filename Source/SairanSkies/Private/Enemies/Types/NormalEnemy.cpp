@@ -5,9 +5,11 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 
-ANormalEnemy::ANormalEnemy()
+ANormalEnemy::ANormalEnemy(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Ticking is handled by UEnemySimulationManager (see AEnemyBase)
+	PrimaryActorTick.bCanEverTick = false;
 
 	// Default values for normal enemy
 	MaxHealth = 100.0f;
@@ -63,11 +65,6 @@ void ANormalEnemy::BeginPlay()
 	OriginalCombatConfig = CombatConfig;
 }
 
-void ANormalEnemy::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-}
-
 // ==================== COMBAT OVERRIDES ====================
 
 void ANormalEnemy::Attack()
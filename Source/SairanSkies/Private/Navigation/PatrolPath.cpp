@@ -1,6 +1,8 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Navigation/PatrolPath.h"
+#include "AI/EnemyNavigationCache.h"
+#include "Engine/World.h"
 
 APatrolPath::APatrolPath()
 {
@@ -13,6 +15,25 @@ APatrolPath::APatrolPath()
 void APatrolPath::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Legs between consecutive points are pathfound once and shared by every patroller
+	if (UEnemyNavigationCache* NavCache = GetWorld()->GetSubsystem<UEnemyNavigationCache>())
+	{
+		NavCache->RegisterPatrolPath(this);
+	}
+}
+
+void APatrolPath::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UEnemyNavigationCache* NavCache = World->GetSubsystem<UEnemyNavigationCache>())
+		{
+			NavCache->UnregisterPatrolPath(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 FVector APatrolPath::GetPatrolPoint(int32 Index) const
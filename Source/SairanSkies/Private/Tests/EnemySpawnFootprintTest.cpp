@@ -0,0 +1,127 @@
+// SairanSkies - Enemy Spawn Footprint Test
+// Spawns N enemies in a throwaway game world and reports how many UObjects and
+// how much memory each one adds. BT tasks run as shared templates (node
+// memory), so the number of our BT node objects must not grow with N.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Enemies/EnemyBase.h"
+#include "Enemies/Types/NormalEnemy.h"
+#include "BehaviorTree/BTNode.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectIterator.h"
+
+namespace EnemySpawnFootprint
+{
+	static const TCHAR* EnemyClassPath = TEXT("/Game/Blueprints/AI/BP_NormalEnemy.BP_NormalEnemy_C");
+	static constexpr int32 NumEnemies = 50;
+	static constexpr int32 SettleFrames = 5;
+
+	struct FSnapshot
+	{
+		int32 UObjects = 0;
+		int32 BTNodes = 0;
+		uint64 UsedPhysical = 0;
+	};
+
+	static FSnapshot Take()
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		FSnapshot Snapshot;
+		Snapshot.UObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+		Snapshot.UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+		// Only this module's nodes: Blueprint tasks are instanced per tree by design
+		for (TObjectIterator<UBTNode> It; It; ++It)
+		{
+			if (It->GetClass()->GetPackage() == AEnemyBase::StaticClass()->GetPackage() && !It->HasAnyFlags(RF_ClassDefaultObject))
+			{
+				++Snapshot.BTNodes;
+			}
+		}
+		return Snapshot;
+	}
+
+	static void Settle(UWorld* World)
+	{
+		for (int32 Frame = 0; Frame < SettleFrames; ++Frame)
+		{
+			World->Tick(LEVELTICK_All, 1.0f / 30.0f);
+		}
+	}
+
+	static AEnemyBase* Spawn(UWorld* World, TSubclassOf<AEnemyBase> EnemyClass, int32 Index)
+	{
+		// Grid well apart so spawn collision never rejects one
+		const FVector Location(float(Index % 10) * 300.0f, float(Index / 10) * 300.0f, 100.0f);
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return World->SpawnActor<AEnemyBase>(EnemyClass, Location, FRotator::ZeroRotator, Params);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEnemySpawnFootprintTest, "SairanSkies.AI.EnemySpawnFootprint",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FEnemySpawnFootprintTest::RunTest(const FString& Parameters)
+{
+	using namespace EnemySpawnFootprint;
+
+	TSubclassOf<AEnemyBase> EnemyClass = LoadClass<AEnemyBase>(nullptr, EnemyClassPath);
+	if (!EnemyClass)
+	{
+		AddWarning(FString::Printf(TEXT("%s not found, using ANormalEnemy (no behavior tree)"), EnemyClassPath));
+		EnemyClass = ANormalEnemy::StaticClass();
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("EnemySpawnFootprintTest"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	// One enemy first: class loading, CDOs, tree assets and subsystems are one-off costs
+	AEnemyBase* WarmupEnemy = Spawn(World, EnemyClass, 0);
+	Settle(World);
+
+	const FSnapshot Before = Take();
+
+	TArray<AEnemyBase*> Enemies;
+	for (int32 i = 1; i <= NumEnemies; ++i)
+	{
+		if (AEnemyBase* Enemy = Spawn(World, EnemyClass, i))
+		{
+			Enemies.Add(Enemy);
+		}
+	}
+	Settle(World);
+
+	const FSnapshot After = Take();
+
+	const int32 Spawned = Enemies.Num();
+	TestEqual(TEXT("Spawned enemies"), Spawned, NumEnemies);
+	TestNotNull(TEXT("Warm-up enemy"), WarmupEnemy);
+
+	if (Spawned > 0)
+	{
+		const double ObjectsPerEnemy = double(After.UObjects - Before.UObjects) / Spawned;
+		const double KBPerEnemy = (double(After.UsedPhysical) - double(Before.UsedPhysical)) / 1024.0 / Spawned;
+		AddInfo(FString::Printf(TEXT("%d enemigos: UObjects %d -> %d (%.1f por enemigo), memoria física %.1f KB por enemigo"),
+			Spawned, Before.UObjects, After.UObjects, ObjectsPerEnemy, KBPerEnemy));
+	}
+
+	// Shared task templates: spawning more enemies adds no BT node objects of ours
+	TestEqual(TEXT("SairanSkies BT node objects added by spawning"), After.BTNodes - Before.BTNodes, 0);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
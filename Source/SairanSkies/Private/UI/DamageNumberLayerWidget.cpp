@@ -0,0 +1,123 @@
+// SairanSkies - Damage Number Layer Widget
+
+#include "UI/DamageNumberLayerWidget.h"
+#include "Core/SairanStats.h"
+#include "UI/DamageNumberSubsystem.h"
+#include "Blueprint/WidgetLayoutLibrary.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Fonts/FontMeasure.h"
+#include "Rendering/SlateRenderer.h"
+#include "Rendering/DrawElements.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/GameViewportClient.h"
+#include "GameFramework/PlayerController.h"
+#include "SceneView.h"
+
+DECLARE_CYCLE_STAT(TEXT("Paint Damage Numbers"), STAT_Sairan_PaintDamageNumbers, STATGROUP_SairanUI);
+
+void UDamageNumberLayerWidget::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	// Solo dibuja: nunca bloquea el ratón ni el foco
+	SetVisibility(ESlateVisibility::HitTestInvisible);
+}
+
+void UDamageNumberLayerWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	if (UDamageNumberSubsystem* Numbers = GetWorld() ? GetWorld()->GetSubsystem<UDamageNumberSubsystem>() : nullptr)
+	{
+		Numbers->Prune(GetWorld()->GetTimeSeconds());
+	}
+}
+
+const UDamageNumberLayerWidget::FCachedGlyph& UDamageNumberLayerWidget::GetGlyph(uint8 Style, int32 Value, const FSlateFontInfo& Font) const
+{
+	const uint64 Key = (static_cast<uint64>(Style) << 32) | static_cast<uint32>(Value);
+	if (const FCachedGlyph* Cached = GlyphCache.Find(Key))
+	{
+		return *Cached;
+	}
+
+	if (GlyphCache.Num() >= MaxCachedGlyphs)
+	{
+		GlyphCache.Reset();
+	}
+
+	FCachedGlyph& Glyph = GlyphCache.Add(Key);
+	Glyph.Text = (Value == INDEX_NONE) ? FString(TEXT("X")) : FString::FromInt(Value);
+	Glyph.Size = FSlateApplication::Get().GetRenderer()->GetFontMeasureService()->Measure(Glyph.Text, Font);
+	return Glyph;
+}
+
+int32 UDamageNumberLayerWidget::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	LayerId = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+
+	SAIRAN_SCOPE(STAT_Sairan_PaintDamageNumbers, UI);
+
+	const UWorld* World = GetWorld();
+	const UDamageNumberSubsystem* Numbers = World ? World->GetSubsystem<UDamageNumberSubsystem>() : nullptr;
+	if (!Numbers || Numbers->GetNumEntries() == 0) return LayerId;
+
+	const APlayerController* PC = GetOwningPlayer();
+	const ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+	if (!LocalPlayer || !LocalPlayer->ViewportClient) return LayerId;
+
+	// One view projection for every number this frame
+	FSceneViewProjectionData Projection;
+	if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, Projection)) return LayerId;
+
+	const FMatrix ViewProjection = Projection.ComputeViewProjectionMatrix();
+	const FIntRect ViewRect = Projection.GetConstrainedViewRect();
+	const FVector2D ViewMin(ViewRect.Min);
+	const FVector ViewOrigin = Projection.ViewOrigin;
+	const double MaxDistanceSq = FMath::Square(Numbers->MaxDrawDistance);
+
+	// Viewport pixels → layer units (DPI scale)
+	const float ViewportScale = UWidgetLayoutLibrary::GetViewportScale(this);
+	const double InvScale = ViewportScale > 0.0f ? 1.0 / ViewportScale : 1.0;
+
+	const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+	const FLinearColor Tint = InWidgetStyle.GetColorAndOpacityTint();
+	const float Now = World->GetTimeSeconds();
+	const int32 TextLayer = LayerId + 1;
+
+	Numbers->ForEachLive(Now, [&](const FDamageNumberEntry& Entry)
+	{
+		const float Age = Now - Entry.SpawnTime;
+
+		FVector Location = Entry.Location;
+		if (Entry.bFloatAndFade)
+		{
+			Location.Z += Entry.FloatUpSpeed * Age;
+		}
+		if (FVector::DistSquared(Location, ViewOrigin) > MaxDistanceSq) return;
+
+		FVector2D ScreenPosition;
+		if (!FSceneView::ProjectWorldToScreen(Location, ViewRect, ViewProjection, ScreenPosition)) return;
+
+		const FSlateFontInfo& Font = Numbers->GetStyleFont(Entry.Style);
+		const FCachedGlyph& Glyph = GetGlyph(Entry.Style, Entry.Value, Font);
+
+		// Centred on the projected point; skip if fully off screen
+		const FVector2D TopLeft = (ScreenPosition - ViewMin) * InvScale - Glyph.Size * 0.5;
+		if (TopLeft.X > LocalSize.X || TopLeft.Y > LocalSize.Y ||
+			TopLeft.X + Glyph.Size.X < 0.0 || TopLeft.Y + Glyph.Size.Y < 0.0) return;
+
+		FLinearColor Color = Entry.Color * Tint;
+		if (Entry.bFloatAndFade)
+		{
+			Color.A *= 1.0f - FMath::Clamp(Age / Entry.Lifetime, 0.0f, 1.0f);
+		}
+
+		FSlateDrawElement::MakeText(OutDrawElements, TextLayer,
+			AllottedGeometry.ToPaintGeometry(Glyph.Size, FSlateLayoutTransform(TopLeft)),
+			Glyph.Text, Font, ESlateDrawEffect::None, Color);
+	});
+
+	return TextLayer;
+}
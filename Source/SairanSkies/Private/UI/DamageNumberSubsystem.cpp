@@ -0,0 +1,161 @@
+// SairanSkies - Damage Number Subsystem
+
+#include "UI/DamageNumberSubsystem.h"
+#include "Core/SairanStats.h"
+#include "UI/DamageNumberLayerWidget.h"
+#include "UI/DamageNumberWidget.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Push Damage Number"), STAT_Sairan_PushDamageNumber, STATGROUP_SairanUI);
+
+void UDamageNumberSubsystem::Deinitialize()
+{
+	if (Layer)
+	{
+		Layer->RemoveFromParent();
+		Layer = nullptr;
+	}
+	Entries.Empty();
+	Head = Count = 0;
+	Styles.Empty();
+	WidgetFonts.Empty();
+	Super::Deinitialize();
+}
+
+// ── Styles ────────────────────────────────────────────────────────────────────
+
+uint8 UDamageNumberSubsystem::RegisterStyle(const FSlateFontInfo& Font, int32 FontSize)
+{
+	FSlateFontInfo Sized = Font;
+	Sized.Size = FontSize;
+
+	for (int32 i = 0; i < Styles.Num(); ++i)
+	{
+		if (Styles[i].IsIdenticalTo(Sized))
+		{
+			return static_cast<uint8>(i);
+		}
+	}
+
+	if (Styles.Num() > MAX_uint8)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DamageNumberSubsystem: demasiados estilos, se reutiliza el primero"));
+		return 0;
+	}
+	return static_cast<uint8>(Styles.Add(Sized));
+}
+
+uint8 UDamageNumberSubsystem::RegisterWidgetStyle(TSubclassOf<UDamageNumberWidget> WidgetClass, const FSlateFontInfo& Fallback, int32 FontSize)
+{
+	if (!WidgetClass)
+	{
+		return RegisterStyle(Fallback, FontSize);
+	}
+
+	// One throwaway instance per class to read the font set up in the WBP
+	FSlateFontInfo* Font = WidgetFonts.Find(WidgetClass.Get());
+	if (!Font)
+	{
+		FSlateFontInfo WidgetFont = Fallback;
+		if (UDamageNumberWidget* Template = CreateWidget<UDamageNumberWidget>(GetWorld(), WidgetClass))
+		{
+			Template->GetDamageFont(WidgetFont);
+		}
+		Font = &WidgetFonts.Add(WidgetClass.Get(), WidgetFont);
+	}
+	return RegisterStyle(*Font, FontSize);
+}
+
+// ── Entries ───────────────────────────────────────────────────────────────────
+
+FDamageNumberEntry& UDamageNumberSubsystem::AddEntry()
+{
+	if (Entries.Num() == 0)
+	{
+		Entries.SetNum(FMath::Max(Capacity, 16));
+	}
+	EnsureLayer();
+
+	// Full: the oldest entry is overwritten
+	FDamageNumberEntry& Entry = Entries[Head];
+	Head = (Head + 1) % Entries.Num();
+	Count = FMath::Min(Count + 1, Entries.Num());
+	return Entry;
+}
+
+void UDamageNumberSubsystem::PushNumber(const UObject* Owner, const FVector& Location, int32 Value, const FLinearColor& Color,
+	uint8 Style, float Lifetime, float FloatUpSpeed)
+{
+	SAIRAN_SCOPE(STAT_Sairan_PushDamageNumber, UI);
+
+	FDamageNumberEntry& Entry = AddEntry();
+	Entry.Value = FMath::Max(Value, 0);
+	Entry.OwnerId = Owner ? Owner->GetUniqueID() : 0;
+	Entry.Style = Style;
+	Entry.bFloatAndFade = true;
+	Entry.Location = Location;
+	Entry.Color = Color;
+	Entry.SpawnTime = GetWorld()->GetTimeSeconds();
+	Entry.Lifetime = Lifetime;
+	Entry.FloatUpSpeed = FloatUpSpeed;
+}
+
+void UDamageNumberSubsystem::PushMarker(const UObject* Owner, const FVector& Location, const FLinearColor& Color, uint8 Style, float Lifetime)
+{
+	SAIRAN_SCOPE(STAT_Sairan_PushDamageNumber, UI);
+
+	FDamageNumberEntry& Entry = AddEntry();
+	Entry.Value = INDEX_NONE;
+	Entry.OwnerId = Owner ? Owner->GetUniqueID() : 0;
+	Entry.Style = Style;
+	Entry.bFloatAndFade = false;
+	Entry.Location = Location;
+	Entry.Color = Color;
+	Entry.SpawnTime = GetWorld()->GetTimeSeconds();
+	Entry.Lifetime = Lifetime;
+	Entry.FloatUpSpeed = 0.0f;
+}
+
+void UDamageNumberSubsystem::ClearOwner(const UObject* Owner)
+{
+	if (!Owner || Count == 0) return;
+
+	const uint32 OwnerId = Owner->GetUniqueID();
+	const int32 Cap = Entries.Num();
+	for (int32 i = 0; i < Count; ++i)
+	{
+		FDamageNumberEntry& Entry = Entries[(Head - Count + i + Cap) % Cap];
+		if (Entry.OwnerId == OwnerId)
+		{
+			Entry.Lifetime = 0.0f;
+		}
+	}
+}
+
+void UDamageNumberSubsystem::Prune(float Now)
+{
+	const int32 Cap = Entries.Num();
+	while (Count > 0 && !Entries[(Head - Count + Cap) % Cap].IsAlive(Now))
+	{
+		--Count;
+	}
+}
+
+// ── Layer ─────────────────────────────────────────────────────────────────────
+
+void UDamageNumberSubsystem::EnsureLayer()
+{
+	if (Layer || !FSlateApplication::IsInitialized()) return;
+
+	APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	if (!PC || !PC->IsLocalController()) return;
+
+	Layer = CreateWidget<UDamageNumberLayerWidget>(PC, UDamageNumberLayerWidget::StaticClass());
+	if (Layer)
+	{
+		Layer->AddToPlayerScreen(LayerZOrder);
+		SAIRAN_COUNT(STAT_Sairan_WidgetsSpawned, WidgetsSpawned, 1);
+	}
+}
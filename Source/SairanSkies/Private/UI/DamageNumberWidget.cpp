@@ -29,3 +29,10 @@ void UDamageNumberWidget::SetFontSize(int32 Size)
 	}
 }
 
+bool UDamageNumberWidget::GetDamageFont(FSlateFontInfo& OutFont) const
+{
+	if (!DamageText) return false;
+
+	OutFont = DamageText->GetFont();
+	return true;
+}
@@ -0,0 +1,205 @@
+// SairanSkies - Enemy Health Bar Overlay Widget
+
+#include "UI/EnemyHealthBarOverlayWidget.h"
+#include "Core/SairanStats.h"
+#include "UI/EnemyHealthBarSubsystem.h"
+#include "UI/EnemyHealthBarWidget.h"
+#include "Enemies/EnemyBase.h"
+#include "Blueprint/WidgetTree.h"
+#include "Blueprint/WidgetLayoutLibrary.h"
+#include "Components/CanvasPanel.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/GameViewportClient.h"
+#include "GameFramework/PlayerController.h"
+#include "SceneView.h"
+
+DECLARE_CYCLE_STAT(TEXT("Health Bar Overlay Tick"), STAT_Sairan_HealthBarOverlayTick, STATGROUP_SairanUI);
+
+TSharedRef<SWidget> UEnemyHealthBarOverlayWidget::RebuildWidget()
+{
+	// Native-only widget: build the root canvas ourselves
+	if (WidgetTree && !WidgetTree->RootWidget)
+	{
+		Canvas = WidgetTree->ConstructWidget<UCanvasPanel>(UCanvasPanel::StaticClass(), TEXT("BarCanvas"));
+		WidgetTree->RootWidget = Canvas;
+	}
+	return Super::RebuildWidget();
+}
+
+void UEnemyHealthBarOverlayWidget::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	// Solo dibuja: nunca bloquea el ratón ni el foco
+	SetVisibility(ESlateVisibility::HitTestInvisible);
+}
+
+int32 UEnemyHealthBarOverlayWidget::AcquireElement(UClass* BarClass, const FVector2D& BarSize)
+{
+	for (int32 i = 0; i < Elements.Num(); ++i)
+	{
+		if (!Elements[i].bInUse && Elements[i].Widget && Elements[i].Widget->GetClass() == BarClass)
+		{
+			return i;
+		}
+	}
+
+	UEnemyHealthBarWidget* Bar = CreateWidget<UEnemyHealthBarWidget>(this, BarClass);
+	if (!Bar || !Canvas) return INDEX_NONE;
+
+	SAIRAN_COUNT(STAT_Sairan_WidgetsSpawned, WidgetsSpawned, 1);
+
+	// Anchored at the top-left corner and centred on it; moved by render translation only
+	if (UCanvasPanelSlot* BarSlot = Canvas->AddChildToCanvas(Bar))
+	{
+		BarSlot->SetAutoSize(false);
+		BarSlot->SetSize(BarSize);
+		BarSlot->SetAlignment(FVector2D(0.5f, 0.5f));
+		BarSlot->SetPosition(FVector2D::ZeroVector);
+	}
+	Bar->SetVisibility(ESlateVisibility::Collapsed);
+
+	FBarElement& Element = Elements.AddDefaulted_GetRef();
+	Element.Widget = Bar;
+	return Elements.Num() - 1;
+}
+
+void UEnemyHealthBarOverlayWidget::HideAll()
+{
+	for (FBarElement& Element : Elements)
+	{
+		if (Element.bVisible)
+		{
+			Element.Widget->SetVisibility(ESlateVisibility::Collapsed);
+			Element.bVisible = false;
+		}
+		Element.Enemy.Reset();
+		Element.bInUse = false;
+	}
+}
+
+void UEnemyHealthBarOverlayWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	SAIRAN_SCOPE(STAT_Sairan_HealthBarOverlayTick, UI);
+
+	const UWorld* World = GetWorld();
+	const UEnemyHealthBarSubsystem* HealthBars = World ? World->GetSubsystem<UEnemyHealthBarSubsystem>() : nullptr;
+	const APlayerController* PC = GetOwningPlayer();
+	const ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+
+	FSceneViewProjectionData Projection;
+	if (!HealthBars || HealthBars->GetEntries().Num() == 0 || !LocalPlayer || !LocalPlayer->ViewportClient ||
+		!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, Projection))
+	{
+		HideAll();
+		return;
+	}
+
+	const FMatrix ViewProjection = Projection.ComputeViewProjectionMatrix();
+	const FIntRect ViewRect = Projection.GetConstrainedViewRect();
+	const FVector2D ViewMin(ViewRect.Min);
+	const double MaxDistanceSq = FMath::Square(HealthBars->MaxDrawDistance);
+
+	const float ViewportScale = UWidgetLayoutLibrary::GetViewportScale(this);
+	const double InvScale = ViewportScale > 0.0f ? 1.0 / ViewportScale : 1.0;
+	const FVector2D LocalSize = MyGeometry.GetLocalSize();
+	const FVector2D HalfBar = HealthBars->BarSize * 0.5;
+
+	// ── 1. Eligible: in combat, close enough, on screen ──
+	const TArray<FEnemyHealthBarEntry>& Entries = HealthBars->GetEntries();
+	Candidates.Reset();
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		const AEnemyBase* Enemy = Entries[i].Enemy.Get();
+		if (!Enemy || Enemy->IsDead() || !Enemy->IsInCombat()) continue;
+
+		const FVector Location = Enemy->GetActorLocation() + FVector(0.0f, 0.0f, Entries[i].HeightOffset);
+		const double DistanceSq = FVector::DistSquared(Location, Projection.ViewOrigin);
+		if (DistanceSq > MaxDistanceSq) continue;
+
+		FVector2D ScreenPosition;
+		if (!FSceneView::ProjectWorldToScreen(Location, ViewRect, ViewProjection, ScreenPosition)) continue;
+
+		const FVector2D Position = (ScreenPosition - ViewMin) * InvScale;
+		if (Position.X + HalfBar.X < 0.0 || Position.Y + HalfBar.Y < 0.0 ||
+			Position.X - HalfBar.X > LocalSize.X || Position.Y - HalfBar.Y > LocalSize.Y) continue;
+
+		FBarCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+		Candidate.EntryIndex = i;
+		Candidate.DistanceSq = DistanceSq;
+		Candidate.Position = Position;
+	}
+
+	// ── 2. Cap: closest first ──
+	const int32 MaxVisible = FMath::Max(HealthBars->MaxVisibleBars, 1);
+	if (Candidates.Num() > MaxVisible)
+	{
+		Candidates.Sort([](const FBarCandidate& A, const FBarCandidate& B) { return A.DistanceSq < B.DistanceSq; });
+		Candidates.SetNum(MaxVisible, EAllowShrinking::No);
+	}
+
+	// ── 3. Elements keep the enemy they already show ──
+	for (FBarElement& Element : Elements)
+	{
+		Element.bInUse = false;
+	}
+	for (FBarCandidate& Candidate : Candidates)
+	{
+		const AEnemyBase* Enemy = Entries[Candidate.EntryIndex].Enemy.Get();
+		for (int32 e = 0; e < Elements.Num(); ++e)
+		{
+			if (!Elements[e].bInUse && Elements[e].Enemy.Get() == Enemy)
+			{
+				Elements[e].bInUse = true;
+				Candidate.Element = e;
+				break;
+			}
+		}
+	}
+
+	// ── 4. New bars take a pooled element of their class ──
+	for (FBarCandidate& Candidate : Candidates)
+	{
+		if (Candidate.Element != INDEX_NONE) continue;
+
+		const FEnemyHealthBarEntry& Entry = Entries[Candidate.EntryIndex];
+		Candidate.Element = AcquireElement(Entry.BarClass.Get(), HealthBars->BarSize);
+		if (Candidate.Element == INDEX_NONE) continue;
+
+		FBarElement& Element = Elements[Candidate.Element];
+		Element.bInUse = true;
+		Element.Enemy = Entry.Enemy;
+		Element.ShownPercent = -1.0f;
+		Element.bVisible = true;
+		Element.Widget->SetVisibility(ESlateVisibility::HitTestInvisible);
+	}
+
+	// ── 5. Move bars; refresh fill only when the pushed value changed ──
+	for (const FBarCandidate& Candidate : Candidates)
+	{
+		if (Candidate.Element == INDEX_NONE) continue;
+
+		FBarElement& Element = Elements[Candidate.Element];
+		const float Percent = Entries[Candidate.EntryIndex].HealthPercent;
+		if (Element.ShownPercent != Percent)
+		{
+			Element.Widget->UpdateHealth(Percent);
+			Element.ShownPercent = Percent;
+		}
+		Element.Widget->SetRenderTranslation(Candidate.Position);
+	}
+
+	// ── 6. Collapse what is no longer shown ──
+	for (FBarElement& Element : Elements)
+	{
+		if (!Element.bInUse && Element.bVisible)
+		{
+			Element.Enemy.Reset();
+			Element.bVisible = false;
+			Element.Widget->SetVisibility(ESlateVisibility::Collapsed);
+		}
+	}
+}
@@ -0,0 +1,87 @@
+// SairanSkies - Enemy Health Bar Subsystem
+
+#include "UI/EnemyHealthBarSubsystem.h"
+#include "Core/SairanStats.h"
+#include "UI/EnemyHealthBarOverlayWidget.h"
+#include "Enemies/EnemyBase.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+void UEnemyHealthBarSubsystem::Deinitialize()
+{
+	if (Overlay)
+	{
+		Overlay->RemoveFromParent();
+		Overlay = nullptr;
+	}
+	Entries.Empty();
+	IndexByEnemy.Empty();
+	Super::Deinitialize();
+}
+
+// ── Bars ──────────────────────────────────────────────────────────────────────
+
+void UEnemyHealthBarSubsystem::ReportHealth(AEnemyBase* Enemy, float HealthPercent)
+{
+	if (!IsValid(Enemy) || !Enemy->HealthBarWidgetClass) return;
+
+	// Oculta a vida completa, como antes
+	if (HealthPercent >= 1.0f)
+	{
+		RemoveEnemy(Enemy);
+		return;
+	}
+
+	const int32* Index = IndexByEnemy.Find(Enemy);
+	FEnemyHealthBarEntry& Entry = Index ? Entries[*Index] : Entries.AddDefaulted_GetRef();
+	if (!Index)
+	{
+		IndexByEnemy.Add(Enemy, Entries.Num() - 1);
+		EnsureOverlay();
+	}
+
+	Entry.Enemy = Enemy;
+	Entry.Key = Enemy;
+	Entry.BarClass = Enemy->HealthBarWidgetClass;
+	Entry.HealthPercent = FMath::Clamp(HealthPercent, 0.0f, 1.0f);
+	Entry.HeightOffset = Enemy->HealthBarHeightOffset;
+}
+
+void UEnemyHealthBarSubsystem::RemoveEnemy(AEnemyBase* Enemy)
+{
+	if (const int32* Index = IndexByEnemy.Find(Enemy))
+	{
+		RemoveAt(*Index);
+	}
+}
+
+void UEnemyHealthBarSubsystem::RemoveAt(int32 Index)
+{
+	IndexByEnemy.Remove(Entries[Index].Key);
+
+	const int32 Last = Entries.Num() - 1;
+	if (Index != Last)
+	{
+		Entries[Index] = MoveTemp(Entries[Last]);
+		IndexByEnemy.Add(Entries[Index].Key, Index);
+	}
+	Entries.RemoveAt(Last, 1, EAllowShrinking::No);
+}
+
+// ── Overlay ───────────────────────────────────────────────────────────────────
+
+void UEnemyHealthBarSubsystem::EnsureOverlay()
+{
+	if (Overlay || !FSlateApplication::IsInitialized()) return;
+
+	APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	if (!PC || !PC->IsLocalController()) return;
+
+	Overlay = CreateWidget<UEnemyHealthBarOverlayWidget>(PC, UEnemyHealthBarOverlayWidget::StaticClass());
+	if (Overlay)
+	{
+		Overlay->AddToPlayerScreen(LayerZOrder);
+		SAIRAN_COUNT(STAT_Sairan_WidgetsSpawned, WidgetsSpawned, 1);
+	}
+}
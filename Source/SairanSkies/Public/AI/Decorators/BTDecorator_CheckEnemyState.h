@@ -3,12 +3,17 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTDecorator.h"
+#include "BehaviorTree/Decorators/BTDecorator_BlackboardBase.h"
 #include "Enemies/EnemyTypes.h"
 #include "BTDecorator_CheckEnemyState.generated.h"
 
+/**
+ * Passes when the EnemyState blackboard key equals StateToCheck.
+ * Observer-driven: only re-evaluated when the key changes (pushed by
+ * AEnemyBase::SetEnemyState), aborting according to FlowAbortMode.
+ */
 UCLASS()
-class SAIRANSKIES_API UBTDecorator_CheckEnemyState : public UBTDecorator
+class SAIRANSKIES_API UBTDecorator_CheckEnemyState : public UBTDecorator_BlackboardBase
 {
 	GENERATED_BODY()
 
@@ -16,6 +21,7 @@ public:
 	UBTDecorator_CheckEnemyState();
 
 	virtual bool CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const override;
+	virtual EBlackboardNotificationResult OnBlackboardKeyValueChange(const UBlackboardComponent& Blackboard, FBlackboard::FKey ChangedKeyID) override;
 	virtual FString GetStaticDescription() const override;
 
 protected:
@@ -3,11 +3,16 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTDecorator.h"
+#include "BehaviorTree/Decorators/BTDecorator_BlackboardBase.h"
 #include "BTDecorator_HasTarget.generated.h"
 
+/**
+ * Passes when the TargetActor blackboard key is set.
+ * Observer-driven: only re-evaluated when the key changes (pushed on
+ * AEnemyBase::SetTarget / LoseTarget), aborting according to FlowAbortMode.
+ */
 UCLASS()
-class SAIRANSKIES_API UBTDecorator_HasTarget : public UBTDecorator
+class SAIRANSKIES_API UBTDecorator_HasTarget : public UBTDecorator_BlackboardBase
 {
 	GENERATED_BODY()
 
@@ -15,5 +20,6 @@ public:
 	UBTDecorator_HasTarget();
 
 	virtual bool CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const override;
+	virtual EBlackboardNotificationResult OnBlackboardKeyValueChange(const UBlackboardComponent& Blackboard, FBlackboard::FKey ChangedKeyID) override;
 	virtual FString GetStaticDescription() const override;
 };
@@ -5,20 +5,43 @@
 #include "CoreMinimal.h"
 #include "AIController.h"
 #include "GenericTeamAgentInterface.h"
-#include "Perception/AIPerceptionTypes.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"
 #include "EnemyAIController.generated.h"
 
 class UBehaviorTreeComponent;
 class UBlackboardComponent;
-class UAISenseConfig_Sight;
-class UAISenseConfig_Hearing;
+class UGroupCombatManager;
+class UEnemyPathRequestQueue;
 class AEnemyBase;
 
+/**
+ * Blackboard values pushed by AEnemyBase when the underlying state changes.
+ * Writes are skipped when the value is unchanged, so key observers (and the
+ * decorators aborting on them) only wake up on real events.
+ */
+namespace EEnemyBlackboardSync
+{
+	enum Type : uint8
+	{
+		None			= 0,
+		Target			= 1 << 0,	// TargetActor (+ TargetLocation when set)
+		TargetLocation	= 1 << 1,	// last known location, quantized
+		State			= 1 << 2,	// EnemyState
+		CanSeeTarget	= 1 << 3,	// from the line-of-sight cache
+		Distance		= 1 << 4,	// DistanceToTarget, quantized
+		CanAttack		= 1 << 5,	// attack cooldown ready AND in the inner circle
+
+		All				= 0x3F
+	};
+}
+
 UCLASS()
 class SAIRANSKIES_API AEnemyAIController : public AAIController
 {
 	GENERATED_BODY()
 
+	friend class UEnemyPathRequestQueue;
+
 public:
 	AEnemyAIController();
 
@@ -40,21 +63,84 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AI")
 	AEnemyBase* GetControlledEnemy() const;
 
+	/** Registers the enemy with UEnemyPerceptionService (shared sight/hearing) */
 	UFUNCTION(BlueprintCallable, Category = "AI")
 	void SetupPerceptionSystem();
 
-	// Perception handler
-	UFUNCTION()
-	void OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus Stimulus);
+	/** Enable/disable the sight sense (AI LOD: distant enemies only hear) */
+	UFUNCTION(BlueprintCallable, Category = "AI")
+	void SetSightEnabled(bool bEnabled);
+
+	// ==================== BLACKBOARD SYNC ====================
+
+	/** Write the enemy values selected by Mask (EEnemyBlackboardSync) to the blackboard */
+	void SyncBlackboard(uint8 Mask);
+
+	/** Distance / location changes smaller than this are not written to the blackboard */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Blackboard", meta = (ClampMin = "0.0"))
+	float BlackboardDistanceQuantum = 25.0f;
 
 protected:
-	UPROPERTY()
-	UAISenseConfig_Sight* SightConfig;
+	void InitializeBlackboardValues();
+
+	/** Key IDs resolved once per blackboard asset (no FName lookups on writes) */
+	FBlackboard::FKey TargetActorKey = FBlackboard::InvalidKey;
+	FBlackboard::FKey TargetLocationKey = FBlackboard::InvalidKey;
+	FBlackboard::FKey EnemyStateKey = FBlackboard::InvalidKey;
+	FBlackboard::FKey CanSeeTargetKey = FBlackboard::InvalidKey;
+	FBlackboard::FKey DistanceToTargetKey = FBlackboard::InvalidKey;
+	FBlackboard::FKey CanAttackKey = FBlackboard::InvalidKey;
+
+	/** Last quantized values written */
+	float LastSyncedDistance = 0.0f;
+	FVector LastSyncedTargetLocation = FVector::ZeroVector;
 
 	UPROPERTY()
-	UAISenseConfig_Hearing* HearingConfig;
+	UGroupCombatManager* CombatManager = nullptr;
 
-	void InitializeBlackboardValues();
+	// ==================== QUEUED MOVEMENT ====================
+public:
+	/**
+	 * MoveToLocation / MoveToActor with the pathfinding deferred to
+	 * UEnemyPathRequestQueue. RequestSuccessful = queued (the move starts when
+	 * the path arrives, see IsMoveQueued); AlreadyAtGoal / Failed as usual.
+	 * The current move, if any, keeps running until then.
+	 */
+	EPathFollowingRequestResult::Type QueueMoveToLocation(const FVector& Dest, float AcceptanceRadius);
+	EPathFollowingRequestResult::Type QueueMoveToActor(AActor* Goal, float AcceptanceRadius);
+
+	/** A queued path has not arrived yet (path following still reports the previous move) */
+	bool IsMoveQueued() const { return QueuedPathRequest != 0; }
+
+	/**
+	 * The last queued move never started: no path, or the pawn/goal went away.
+	 * Path following is left Idle in that case, so tasks check this before
+	 * reading Idle as "arrived". Cleared by the next queued move, FollowCachedPath
+	 * or StopMovement.
+	 */
+	bool HasQueuedMoveFailed() const { return bQueuedMoveFailed; }
+
+	/**
+	 * RequestMove with a ready path (navigation cache patrol legs). Drops any queued
+	 * request and its failure first: a late queued path must not replace this move,
+	 * and a failure left over from the previous task must not fail this one.
+	 */
+	FAIRequestID FollowCachedPath(const FAIMoveRequest& MoveRequest, FNavPathSharedPtr Path);
+
+	void CancelQueuedMove();
+
+	/** Also drops a queued path, so task aborts never start a stale move */
+	virtual void StopMovement() override;
+
+protected:
+	EPathFollowingRequestResult::Type QueueMove(const FAIMoveRequest& MoveRequest, const FVector& Goal);
+
+	/** Called by the queue; Path is shared with the other requests of the batch (nullptr = failed) */
+	void OnQueuedPathReady(FNavPathSharedPtr Path);
+
+	uint32 QueuedPathRequest = 0;
+	FAIMoveRequest QueuedMoveRequest;
+	bool bQueuedMoveFailed = false;
 
 	// ==================== TEAM SYSTEM ====================
 public:
@@ -0,0 +1,143 @@
+// SairanSkies - Enemy Ambient Director
+// Owns the ambient (non-combat) behaviour of every enemy: random pauses,
+// look-arounds, conversation waits / gestures and partner matching.
+// Scheduled events sit in a timing wheel; nothing is visited per enemy per frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyAmbientDirector.generated.h"
+
+class AEnemyBase;
+
+/** One-shot ambient events, delivered through AEnemyBase::OnAmbientEvent */
+enum class EEnemyAmbientEvent : uint8
+{
+	RandomPauseEnd,		// EndRandomPause
+	LookAround,			// next look-around phase
+	ConversationWait,	// waited long enough → becomes a conversation candidate
+	ConversationEnd,	// conversation duration elapsed
+	Gesture,			// next conversation gesture roll
+
+	Count
+};
+
+static_assert(static_cast<uint8>(EEnemyAmbientEvent::Count) <= 8, "Pending event mask is a uint8");
+
+/**
+ * Ambient behaviour director.
+ *
+ * Timing wheel: WheelSize buckets of SlotDuration seconds. Scheduling drops
+ * the event into bucket (Current + Ticks) % WheelSize with the number of full
+ * turns left; each frame only the buckets the clock passed are visited.
+ * Cancelling / re-scheduling bumps a per-enemy, per-event serial, and stale
+ * events are discarded when their bucket comes up.
+ *
+ * Conversations: an enemy whose ConversationWait elapsed becomes a candidate.
+ * Every MatchInterval, one pass buckets the candidates in a MatchCellSize grid
+ * and pairs each with its nearest free candidate within ConversationRadius.
+ *
+ * Enemies register lazily on their first scheduled event and leave through
+ * UnregisterEnemy (death, pool, EndPlay).
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyAmbientDirector : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	/** Timing wheel resolution (seconds per bucket) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AmbientDirector", meta = (ClampMin = "0.01"))
+	float SlotDuration = 0.1f;
+
+	/** Seconds between conversation matching passes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AmbientDirector", meta = (ClampMin = "0.1"))
+	float MatchInterval = 0.5f;
+
+	/** Grid cell for the matching pass (>= typical ConversationRadius) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AmbientDirector", meta = (ClampMin = "100.0"))
+	float MatchCellSize = 500.0f;
+
+	// ========== EVENTS ==========
+
+	/** (Re)schedule Event for Enemy in Seconds; replaces a pending one of the same kind */
+	void Schedule(AEnemyBase* Enemy, EEnemyAmbientEvent Event, float Seconds);
+
+	void Cancel(const AEnemyBase* Enemy, EEnemyAmbientEvent Event);
+
+	bool IsScheduled(const AEnemyBase* Enemy, EEnemyAmbientEvent Event) const;
+
+	// ========== CONVERSATIONS ==========
+
+	void AddConversationCandidate(AEnemyBase* Enemy);
+	void RemoveConversationCandidate(const AEnemyBase* Enemy);
+
+	// ========== REGISTRATION ==========
+
+	/** Drop every pending event and candidacy of Enemy */
+	void UnregisterEnemy(AEnemyBase* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "AmbientDirector")
+	int32 GetNumRegistered() const { return Records.Num() - FreeHandles.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "AmbientDirector")
+	int32 GetNumCandidates() const { return Candidates.Num(); }
+
+private:
+	static constexpr int32 WheelSize = 256;
+	static constexpr int32 NumEvents = static_cast<int32>(EEnemyAmbientEvent::Count);
+
+	struct FAmbientRecord
+	{
+		TWeakObjectPtr<AEnemyBase> Enemy;
+		uint32 Serial[NumEvents] = {};
+		uint8 PendingMask = 0;
+		bool bCandidate = false;
+	};
+
+	struct FWheelEvent
+	{
+		int32 Handle = INDEX_NONE;
+		uint32 Serial = 0;
+		uint16 Rounds = 0;
+		EEnemyAmbientEvent Event = EEnemyAmbientEvent::Count;
+	};
+
+	/** Handle → record (AEnemyBase::AmbientHandle); freed handles are reused */
+	TArray<FAmbientRecord> Records;
+	TArray<int32> FreeHandles;
+
+	TArray<FWheelEvent> Wheel[WheelSize];
+	int32 CurrentBucket = 0;
+	float BucketAccumulator = 0.0f;
+
+	/** Handles of conversation candidates */
+	TArray<int32> Candidates;
+	float TimeSinceMatch = 0.0f;
+
+	/** Scratch for dispatch / matching (kept to avoid per-frame allocations) */
+	TArray<FWheelEvent> DueEvents;
+	TArray<AEnemyBase*> MatchEnemies;
+	TArray<FVector> MatchLocations;
+	TArray<uint64> MatchKeys;
+	TArray<int32> SortedMatch;
+	TArray<bool> Matched;
+	TMap<uint64, FIntPoint> CellRanges;
+
+	int32 GetHandle(const AEnemyBase* Enemy) const;
+	int32 FindOrAddRecord(AEnemyBase* Enemy);
+
+	void AdvanceBucket();
+	void MatchConversations();
+
+	uint64 MakeCellKey(int32 CellX, int32 CellY) const;
+};
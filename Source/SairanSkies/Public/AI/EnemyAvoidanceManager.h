@@ -0,0 +1,103 @@
+// SairanSkies - Enemy Avoidance Manager
+// Crowd avoidance for AI-controlled enemies: one batched ORCA (optimal
+// reciprocal collision avoidance) pass per frame over every registered agent,
+// with neighbours found through a uniform grid. Replaces capsule-vs-capsule
+// bumping and MoveTo retries in dense combat circles.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyAvoidanceManager.generated.h"
+
+class UEnemyMovementComponent;
+
+/**
+ * Batched velocity-obstacle avoidance for enemies.
+ *
+ * Layout (structure of arrays, index = slot):
+ *   Pos{X,Y}, Vel{X,Y}    packed every frame from the movement component
+ *   Pref{X,Y}             velocity the agent wanted, reported by CalcVelocity
+ *   Radius, MaxSpeed      capsule radius * RadiusScale, current max speed
+ *   Delta{X,Y}            solved velocity minus Pref (the avoidance correction)
+ *
+ * Frame:
+ *   1. Pack agents; inactive ones (dead, falling, no component) are skipped
+ *   2. Bucket agents into a NeighbourRadius grid (sorted keys + cell ranges)
+ *   3. Per agent (ParallelFor): MaxNeighbours nearest from the 3x3 cells →
+ *      ORCA half-planes over TimeHorizon → 2D linear program
+ *   4. Next frame each movement component adds its Delta to the velocity it
+ *      computed, so the correction follows the agent's current intent
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyAvoidanceManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avoidance")
+	bool bEnabled = true;
+
+	/** How far ahead (seconds) agents react to each other */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avoidance", meta = (ClampMin = "0.1"))
+	float TimeHorizon = 1.0f;
+
+	/** Neighbour search radius (also the grid cell size) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avoidance", meta = (ClampMin = "50.0"))
+	float NeighbourRadius = 400.0f;
+
+	/** Closest neighbours considered per agent */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avoidance", meta = (ClampMin = "1", ClampMax = "32"))
+	int32 MaxNeighbours = 10;
+
+	/** Multiplier on capsule radius (> 1 keeps a small gap between agents) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avoidance", meta = (ClampMin = "0.5"))
+	float RadiusScale = 1.1f;
+
+	// ========== REGISTRATION ==========
+
+	void RegisterAgent(UEnemyMovementComponent* Movement);
+	void UnregisterAgent(UEnemyMovementComponent* Movement);
+
+	UFUNCTION(BlueprintPure, Category = "Avoidance")
+	int32 GetNumAgents() const { return Agents.Num(); }
+
+	// ========== MOVEMENT HOOK ==========
+
+	/** Called from CalcVelocity: records the preferred velocity and applies the last correction */
+	void ApplyAvoidance(UEnemyMovementComponent* Movement, FVector& InOutVelocity);
+
+private:
+	/** Slot → agent */
+	TArray<TWeakObjectPtr<UEnemyMovementComponent>> Agents;
+
+	// Packed (SoA)
+	TArray<float> PosX, PosY;
+	TArray<float> VelX, VelY;
+	TArray<float> PrefX, PrefY;
+	TArray<float> Radius, MaxSpeed;
+	TArray<float> DeltaX, DeltaY;
+	TArray<bool> Active;
+
+	// Neighbour grid: active slots sorted by cell key, plus each cell's range in it
+	TArray<uint64> CellKeys;
+	TArray<int32> SortedSlots;
+	TMap<uint64, FIntPoint> CellRanges;
+
+	int32 GetSlot(const UEnemyMovementComponent* Movement) const;
+	void SetNum(int32 Num);
+
+	void PackAgents();
+	void BuildGrid();
+	void SolveAgent(int32 Slot, float DeltaTime);
+
+	uint64 MakeCellKey(int32 CellX, int32 CellY) const;
+};
@@ -0,0 +1,18 @@
+// SairanSkies - Enemy Behavior Tree Component
+// UBehaviorTreeComponent used by AEnemyAIController. Only adds instrumentation
+// around the tree tick (tasks, services and decorators all run inside it).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "EnemyBehaviorTreeComponent.generated.h"
+
+UCLASS()
+class SAIRANSKIES_API UEnemyBehaviorTreeComponent : public UBehaviorTreeComponent
+{
+	GENERATED_BODY()
+
+public:
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+};
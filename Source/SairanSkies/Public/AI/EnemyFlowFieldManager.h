@@ -0,0 +1,157 @@
+// SairanSkies - Enemy Flow Field Manager
+// One shared distance/direction field per chased target, built over the
+// navmesh around it. Chasing enemies steer by sampling the field instead of
+// each running its own pathfinding query towards the same actor.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyFlowFieldManager.generated.h"
+
+/**
+ * Flow fields for enemies converging on a target (the player in AWaveZone fights).
+ *
+ * Per target, a Resolution x Resolution window of CellSize cells centred on it:
+ *   1. Walkability: each cell centre is projected onto the navmesh
+ *      (MaxProjectionsPerTick budget). When the target drifts off-centre the
+ *      window is shifted and the overlapping cells are kept, so only the newly
+ *      exposed strip is projected again.
+ *   2. Links: every edge between two walkable neighbours with
+ *      |ΔZ| <= MaxStepHeight is checked with a navmesh raycast between their
+ *      projected centres (same budget), so cells on both sides of a thin
+ *      wall or railing are not connected. Stored as 8 bits per cell.
+ *   3. Integration: Dijkstra from the target cell over linked cells
+ *      (8-neighbour, no corner cutting), rebuilt when the target changes
+ *      cell, at most every RebuildInterval.
+ *   4. Direction: every cell stores its cheapest linked neighbour.
+ *
+ * GetFlowDirection is an O(1) lookup. It returns false while the field is
+ * still being classified, or for locations outside it or unreachable, in
+ * which case the caller uses regular pathfinding.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyFlowFieldManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	/** World size of a field cell */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FlowField", meta = (ClampMin = "25.0"))
+	float CellSize = 100.0f;
+
+	/** Cells per side of the window around the target */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FlowField", meta = (ClampMin = "8", ClampMax = "256"))
+	int32 Resolution = 64;
+
+	/** Navmesh projections + edge raycasts spent per frame classifying cells (all fields together) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FlowField", meta = (ClampMin = "1"))
+	int32 MaxProjectionsPerTick = 512;
+
+	/** Max height difference between neighbouring cells that still counts as connected */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FlowField", meta = (ClampMin = "0.0"))
+	float MaxStepHeight = 75.0f;
+
+	/** Vertical half-extent of the navmesh projection around the target's height */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FlowField", meta = (ClampMin = "0.0"))
+	float ProjectionHalfHeight = 400.0f;
+
+	/** Minimum seconds between integration rebuilds of one field */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FlowField", meta = (ClampMin = "0.0"))
+	float RebuildInterval = 0.15f;
+
+	/** A field nobody sampled for this long is dropped */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FlowField", meta = (ClampMin = "0.0"))
+	float FieldTimeout = 3.0f;
+
+	// ========== QUERIES ==========
+
+	/**
+	 * Horizontal steering direction from Location towards Target along the field.
+	 * Creates the field for Target on first use. False = no usable field here.
+	 */
+	bool GetFlowDirection(AActor* Target, const FVector& Location, FVector& OutDirection);
+
+	/** Integrated path cost (world units) from Location to Target, or -1 if unknown */
+	float GetFlowDistance(const AActor* Target, const FVector& Location) const;
+
+	UFUNCTION(BlueprintPure, Category = "FlowField")
+	int32 GetNumFields() const { return Fields.Num(); }
+
+private:
+	enum class ECellState : uint8
+	{
+		Unknown,
+		Walkable,
+		Blocked,
+	};
+
+	static constexpr uint8 NoDirection = 0xFF;
+
+	struct FFlowField
+	{
+		TWeakObjectPtr<AActor> Target;
+
+		/** World cell coordinate of the window's (0,0) cell */
+		FIntPoint Origin = FIntPoint::ZeroValue;
+
+		/** Per window cell (index = Y * Resolution + X) */
+		TArray<ECellState> State;
+		TArray<float> CellZ;
+		TArray<float> Cost;
+		TArray<uint8> Direction;
+
+		/** Bit n = walkable edge to neighbour n (EnemyFlowField::Offsets) */
+		TArray<uint8> Links;
+
+		/** Bit n = edge to neighbour n already checked (set on both cells) */
+		TArray<uint8> LinksChecked;
+
+		/** Height the window was classified around */
+		float ReferenceZ = 0.0f;
+
+		/** Cell the integration was built from (INDEX_NONE = never built) */
+		FIntPoint BuiltTargetCell = FIntPoint(INDEX_NONE, INDEX_NONE);
+		bool bNeedsRebuild = true;
+		bool bReady = false;
+
+		int32 NumUnknown = 0;
+		int32 NextProjectIndex = 0;
+
+		/** Edge checks: next cell to visit, false once every edge is known */
+		int32 NextLinkIndex = 0;
+		bool bLinksPending = true;
+
+		float TimeSinceBuild = 0.0f;
+		float LastQueryTime = 0.0f;
+	};
+
+	TArray<FFlowField> Fields;
+
+	FFlowField* FindField(const AActor* Target);
+	const FFlowField* FindField(const AActor* Target) const;
+	FFlowField& CreateField(AActor* Target);
+
+	FIntPoint WorldToCell(const FVector& Location) const;
+	FVector CellCenter(const FIntPoint& Cell, float Z) const;
+	int32 WindowIndex(const FFlowField& Field, const FIntPoint& Cell) const;
+
+	/** Recentre the window on the target cell, keeping already classified overlap */
+	void RecenterWindow(FFlowField& Field, const FIntPoint& TargetCell, float TargetZ);
+
+	/** Classify up to Budget unknown cells; returns projections spent */
+	int32 ClassifyCells(FFlowField& Field, int32 Budget);
+
+	/** Check up to Budget unchecked edges with navmesh raycasts; returns raycasts spent */
+	int32 ClassifyLinks(FFlowField& Field, int32 Budget);
+
+	void BuildIntegration(FFlowField& Field, const FIntPoint& TargetCell);
+};
@@ -0,0 +1,123 @@
+// SairanSkies - Enemy Line-of-Sight Cache
+// One shared enemy→target visibility trace per update window, issued through
+// the engine's async trace API and staggered across frames. Every system that
+// asks "can this enemy see its target?" reads the cached result.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "EnemyLineOfSightCache.generated.h"
+
+class AEnemyBase;
+
+/** Cached visibility for one enemy towards its current target */
+USTRUCT(BlueprintType)
+struct FEnemyLineOfSightResult
+{
+	GENERATED_BODY()
+
+	/** False if no trace has completed for the current target yet */
+	UPROPERTY(BlueprintReadOnly, Category = "LineOfSight")
+	bool bValid = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LineOfSight")
+	bool bVisible = false;
+
+	/** World time the trace was issued (freshness) */
+	UPROPERTY(BlueprintReadOnly, Category = "LineOfSight")
+	float Timestamp = 0.0f;
+};
+
+/**
+ * Shared line-of-sight cache for AEnemyBase::CanSeeTarget.
+ *
+ * Frame:
+ *   1. Poll the async traces issued on previous frames (QueryTraceData)
+ *   2. Round-robin over enemies with a target; any whose result is older than
+ *      UpdateInterval gets a new AsyncLineTraceByChannel, at most
+ *      MaxTracesPerFrame per frame
+ *
+ * Results are ~1 frame late by design. A caller with no result for the
+ * current target (target just acquired) gets a synchronous trace that seeds
+ * the cache, so it is never worse than the old per-call trace.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyLineOfSightCache : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	/** Minimum age of a result before it is re-traced (0 = every frame) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LineOfSight", meta = (ClampMin = "0.0"))
+	float UpdateInterval = 0.1f;
+
+	/** Cap on async traces issued per frame (stagger for big enemy counts) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LineOfSight", meta = (ClampMin = "1"))
+	int32 MaxTracesPerFrame = 32;
+
+	/** Eye height added to both ends of the trace */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LineOfSight")
+	float TraceHeightOffset = 50.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LineOfSight")
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+
+	// ========== REGISTRATION ==========
+
+	void RegisterEnemy(AEnemyBase* Enemy);
+	void UnregisterEnemy(AEnemyBase* Enemy);
+
+	// ========== QUERIES ==========
+
+	/** Cached result for the enemy's current target (bValid = false if none yet) */
+	FEnemyLineOfSightResult GetLineOfSight(const AEnemyBase* Enemy) const;
+
+	/** Cached result, falling back to a synchronous trace that seeds the cache */
+	bool CanSeeTarget(const AEnemyBase* Enemy);
+
+	/** Synchronous trace used as fallback (and by unregistered enemies) */
+	bool TraceLineOfSight(const AEnemyBase* Enemy, const AActor* Target) const;
+
+	UFUNCTION(BlueprintPure, Category = "LineOfSight")
+	int32 GetNumPendingTraces() const { return NumPending; }
+
+private:
+	struct FLineOfSightEntry
+	{
+		TWeakObjectPtr<AEnemyBase> Enemy;
+
+		/** Target the cached result refers to */
+		TWeakObjectPtr<AActor> Target;
+		FEnemyLineOfSightResult Result;
+
+		/** In-flight async trace */
+		FTraceHandle PendingHandle;
+		TWeakObjectPtr<AActor> PendingTarget;
+		float PendingTimestamp = 0.0f;
+		bool bPending = false;
+	};
+
+	TArray<FLineOfSightEntry> Entries;
+
+	/** Round-robin cursor for issuing traces */
+	int32 NextIssueIndex = 0;
+
+	int32 NumPending = 0;
+
+	int32 GetSlot(const AEnemyBase* Enemy) const;
+
+	void PollPendingTraces();
+	void IssueTraces(float Now);
+
+	static bool IsVisibleFromHits(const TArray<FHitResult>& Hits, const AActor* Target);
+};
@@ -0,0 +1,167 @@
+// SairanSkies - Enemy Navigation Cache
+// Patrol legs are pathfound once per APatrolPath and shared by every enemy
+// walking it; investigation / "random reachable point" queries are served from
+// navmesh points sampled ahead of time around the patrolled areas.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NavigationData.h"
+#include "UObject/ObjectKey.h"
+#include "EnemyNavigationCache.generated.h"
+
+class APatrolPath;
+class ANavigationData;
+
+/**
+ * Navigation query cache for non-combat movement.
+ *
+ * Patrol legs:
+ *   RegisterPatrolPath (APatrolPath::BeginPlay) queues a path from every
+ *   point to the next one, wrapping around (the order BTTask_FindPatrolPoint
+ *   walks). Legs are solved in Tick, at most MaxQueriesPerTick per
+ *   frame and only once the navmesh is ready. Each stored path is registered
+ *   as an active path on its nav data, so a tile rebuild crossing it
+ *   invalidates it and the leg is queued again. Legs between other pairs
+ *   (random patrol) are added the first time they are asked for.
+ *
+ * Reachable points:
+ *   Space is split in SampleCellSize x SampleCellSize x SampleLayerHeight
+ *   cells, so stacked floors get cells of their own. A cell is filled with
+ *   SamplesPerCell points from GetRandomReachablePointInRadius around its
+ *   navmesh anchor; the cells holding patrol points are filled up front.
+ *   GetReachablePointInRadius picks a random stored sample within the radius
+ *   and SampleLayerHeight of the origin, and only returns it if it is
+ *   reachable from the origin (navmesh raycast, else a path test): samples
+ *   are reachable from their cell anchor, which may be a different region.
+ *   A miss or a rejected sample falls back to one direct query and queues the
+ *   cell. All samples are dropped when the navigation build finishes again.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyNavigationCache : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	/** Pathfinding / sampling queries spent per frame filling the cache */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NavigationCache", meta = (ClampMin = "1"))
+	int32 MaxQueriesPerTick = 8;
+
+	/** A cached leg is only used when the enemy is this close to the leg start */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NavigationCache", meta = (ClampMin = "0.0"))
+	float LegStartTolerance = 150.0f;
+
+	/** Size of a reachable-point sampling cell */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NavigationCache", meta = (ClampMin = "200.0"))
+	float SampleCellSize = 1000.0f;
+
+	/** Height of a sampling cell; also the vertical tolerance of reachable-point queries */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NavigationCache", meta = (ClampMin = "100.0"))
+	float SampleLayerHeight = 400.0f;
+
+	/** Samples stored per cell */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NavigationCache", meta = (ClampMin = "1", ClampMax = "128"))
+	int32 SamplesPerCell = 24;
+
+	// ========== PATROL LEGS ==========
+
+	void RegisterPatrolPath(APatrolPath* Path);
+	void UnregisterPatrolPath(APatrolPath* Path);
+
+	/**
+	 * Cached path from the patrol point near From to the patrol point at To.
+	 * Returns a private copy the caller can hand to RequestMove, or nullptr
+	 * (not cached yet / enemy off the leg start) → regular pathfinding.
+	 */
+	FNavPathSharedPtr FindPatrolLeg(const APatrolPath* Path, const FVector& From, const FVector& To);
+
+	// ========== REACHABLE POINTS ==========
+
+	/** Random navigable point reachable from Origin within Radius, preferring pre-sampled points */
+	bool GetReachablePointInRadius(const FVector& Origin, float Radius, FVector& OutPoint);
+
+	// ========== STATS ==========
+
+	UFUNCTION(BlueprintPure, Category = "NavigationCache")
+	int32 GetNumCachedLegs() const;
+
+	UFUNCTION(BlueprintPure, Category = "NavigationCache")
+	int32 GetNumSampleCells() const { return SampleCells.Num(); }
+
+	/** Own copy of a shared path (path following mutates and observes it) */
+	static FNavPathSharedPtr CopyPath(const FNavPathSharedPtr& Source);
+
+private:
+	struct FPatrolLeg
+	{
+		int32 FromIndex = INDEX_NONE;
+		int32 ToIndex = INDEX_NONE;
+		FNavPathSharedPtr Path;
+		bool bQueued = false;
+	};
+
+	struct FCachedPatrolPath
+	{
+		TWeakObjectPtr<APatrolPath> Path;
+		/** World-space patrol points captured at registration */
+		TArray<FVector> Points;
+		TArray<FPatrolLeg> Legs;
+	};
+
+	struct FLegRef
+	{
+		TObjectKey<APatrolPath> Path;
+		int32 Leg = INDEX_NONE;
+	};
+
+	struct FSampleCell
+	{
+		TArray<FVector> Points;
+		/** Height (inside the cell's layer) it was first asked about; projected onto the navmesh before sampling */
+		float AnchorZ = 0.0f;
+		FVector Anchor = FVector::ZeroVector;
+		bool bHasAnchor = false;
+		int32 Attempts = 0;
+		bool bFilled = false;
+		bool bQueued = false;
+	};
+
+	TMap<TObjectKey<APatrolPath>, FCachedPatrolPath> PatrolPaths;
+	TMap<uint64, FSampleCell> SampleCells;
+
+	/** Pending work, consumed in Tick */
+	TArray<FLegRef> LegQueue;
+	TArray<uint64> CellQueue;
+
+	int32 AddLeg(FCachedPatrolPath& Entry, TObjectKey<APatrolPath> Key, int32 FromIndex, int32 ToIndex);
+	void QueueLeg(TObjectKey<APatrolPath> Key, int32 Leg);
+	void QueueCell(uint64 CellKey, float AnchorZ);
+
+	void SolveLeg(const FLegRef& Ref, ANavigationData* NavData);
+
+	/** Spend up to Budget queries on the cell; returns the number used */
+	int32 FillCell(uint64 CellKey, int32 Budget);
+
+	void OnLegPathEvent(FNavigationPath* InvalidatedPath, ENavPathEvent::Type Event, TObjectKey<APatrolPath> Key, int32 Leg);
+
+	UFUNCTION()
+	void OnNavigationBuildFinished(ANavigationData* NavData);
+
+	ANavigationData* GetReadyNavData() const;
+	int32 FindNearestPoint(const FCachedPatrolPath& Entry, const FVector& Location, float Tolerance) const;
+
+	/** 24 bits X | 24 bits Y | 16 bits height layer */
+	uint64 MakeCellKey(int32 CellX, int32 CellY, int32 Layer) const;
+	uint64 GetCellKey(const FVector& Location) const;
+	FVector GetCellCenter(uint64 CellKey, float Z) const;
+};
@@ -0,0 +1,122 @@
+// SairanSkies - Enemy Path Request Queue
+// Movement tasks queue their pathfinding here instead of running it inside
+// MoveToLocation / MoveToActor. Requests sharing start and goal cell share one
+// query, and a per-frame budget spreads mass re-pathing over several frames.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NavigationData.h"
+#include "EnemyPathRequestQueue.generated.h"
+
+class AEnemyAIController;
+class UNavigationSystemV1;
+
+/**
+ * Asynchronous, batched pathfinding for enemy movement.
+ *
+ * RequestPath (through AEnemyAIController::QueueMoveToLocation / QueueMoveToActor)
+ * snaps the pawn location and the goal to a PathCellSize grid. A request whose
+ * (start cell, goal cell) pair is already pending or in flight joins that batch
+ * instead of adding a query.
+ *
+ * Tick dispatches at most MaxQueriesPerTick batches to the navigation system's
+ * async pathfinding (worker thread), oldest first, with at most MaxQueriesInFlight
+ * unanswered. When a query returns, every live request of the batch gets the
+ * path through AEnemyAIController::OnQueuedPathReady, which starts the move.
+ *
+ * All enemies share the default nav agent and filter, so a batch is queried
+ * with the properties of its first live requester.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyPathRequestQueue : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	/** Batches handed to async pathfinding per frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PathQueue", meta = (ClampMin = "1"))
+	int32 MaxQueriesPerTick = 6;
+
+	/** Dispatched batches still waiting for their result; no new dispatch above this */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PathQueue", meta = (ClampMin = "1"))
+	int32 MaxQueriesInFlight = 24;
+
+	/** Start / goal cell size used to merge requests */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PathQueue", meta = (ClampMin = "50.0"))
+	float PathCellSize = 200.0f;
+
+	// ========== REQUESTS ==========
+
+	/** Queue a path from Controller's pawn to Goal; returns the request id (0 = not queued) */
+	uint32 RequestPath(AEnemyAIController* Controller, const FVector& Goal);
+
+	/** Drop a request; its batch still runs if other requests share it */
+	void CancelRequest(uint32 RequestId);
+
+	// ========== STATS ==========
+
+	UFUNCTION(BlueprintPure, Category = "PathQueue")
+	int32 GetNumPendingRequests() const { return Requests.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "PathQueue")
+	int32 GetNumQueuedBatches() const { return PendingBatches.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "PathQueue")
+	int32 GetNumQueriesInFlight() const { return NumInFlight; }
+
+	/** Requests that joined an existing batch since the world started */
+	UFUNCTION(BlueprintPure, Category = "PathQueue")
+	int32 GetNumMergedRequests() const { return NumMerged; }
+
+private:
+	using FCellPair = TTuple<uint64, uint64>;
+
+	struct FPathRequest
+	{
+		TWeakObjectPtr<AEnemyAIController> Controller;
+		uint32 Batch = 0;
+	};
+
+	struct FPathBatch
+	{
+		FCellPair Cells;
+		/** Endpoints of the request that opened the batch */
+		FVector Start = FVector::ZeroVector;
+		FVector Goal = FVector::ZeroVector;
+		TArray<uint32> Requests;
+		bool bInFlight = false;
+	};
+
+	TMap<uint32, FPathRequest> Requests;
+	TMap<uint32, FPathBatch> Batches;
+	TMap<FCellPair, uint32> BatchByCells;
+
+	/** Batches not dispatched yet, oldest first */
+	TArray<uint32> PendingBatches;
+
+	uint32 NextRequestId = 0;
+	uint32 NextBatchId = 0;
+	int32 NumInFlight = 0;
+	int32 NumMerged = 0;
+
+	/** Returns false when the batch had no live request left (no query spent) */
+	bool DispatchBatch(uint32 BatchId, UNavigationSystemV1* NavSys);
+
+	void OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path, uint32 BatchId);
+
+	/** Remove the batch and hand Path (nullptr = failed) to its live requests */
+	void DeliverBatch(uint32 BatchId, FNavPathSharedPtr Path);
+
+	uint64 MakeCellKey(int32 CellX, int32 CellY) const;
+	uint64 GetCellKey(const FVector& Location) const;
+};
@@ -0,0 +1,148 @@
+// SairanSkies - Enemy Perception Service
+// Shared sight/hearing for every enemy against the single hostile stimulus
+// source (the player). Replaces the per-controller UAISenseConfig_Sight /
+// UAISenseConfig_Hearing: cone and range tests run as one SIMD batch over
+// packed arrays, and occlusion is only traced for enemies that pass them.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyPerceptionService.generated.h"
+
+class AEnemyBase;
+
+/**
+ * Batched perception for enemies.
+ *
+ * Layout (structure of arrays, index = slot, padded to a multiple of 4):
+ *   Pos{X,Y,Z}, Fwd{X,Y,Z}       packed every update
+ *   SightRadiusSq, CosHalfAngle   from FEnemyPerceptionConfig
+ *   LoseSightRadiusSq, LoseSightTime
+ *   HearingRadiusSq, ProximityRadiusSq
+ *   SightTestRadiusSq             Sight or LoseSight radius², by the previous result
+ *   Active                        1 = eligible (alive, sight enabled, not already on the player)
+ *
+ * Update (every UpdateInterval):
+ *   1. Pack positions / forwards
+ *   2. SIMD pass, 4 enemies per iteration:
+ *        sight     = dist² <= SightTestRadius² && dot(fwd, toPlayer) >= cos(PeripheralVisionAngle) * dist
+ *                    (LoseSightRadius while already seen: no flicker at the edge)
+ *        proximity = dist² <= ProximityRadius² (any direction)
+ *        hearing   = a reported noise within min(HearingRadius, noise range)
+ *   3. Occlusion trace only for sight/proximity candidates (MaxTracesPerUpdate)
+ *   4. Sight lost only after LoseSightTime without a successful test (stimulus
+ *      max age, as the sense configs had); sensed/lost transitions →
+ *      AEnemyBase::OnPerceptionUpdated
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyPerceptionService : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	/** Seconds between batched perception updates */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception", meta = (ClampMin = "0.0"))
+	float UpdateInterval = 0.1f;
+
+	/** Cap on occlusion traces per update; the rest carry over to the next one */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception", meta = (ClampMin = "1"))
+	int32 MaxTracesPerUpdate = 24;
+
+	/** Eye height added to both ends of the occlusion trace */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception")
+	float TraceHeightOffset = 50.0f;
+
+	/** A seen player is kept up to SightRadius + this (UAISenseConfig_Sight::LoseSightRadius) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Perception", meta = (ClampMin = "0.0"))
+	float LoseSightRadiusOffset = 500.0f;
+
+	// ========== REGISTRATION ==========
+
+	/** Reads the enemy's PerceptionConfig; call again if it changes at runtime */
+	void RegisterEnemy(AEnemyBase* Enemy);
+	void UnregisterEnemy(AEnemyBase* Enemy);
+
+	/** Sight toggle used by the significance LOD (hearing is never disabled) */
+	void SetSightEnabled(AEnemyBase* Enemy, bool bEnabled);
+
+	UFUNCTION(BlueprintPure, Category = "Perception")
+	int32 GetNumListeners() const { return Enemies.Num(); }
+
+	// ========== STIMULI ==========
+
+	/** Equivalent of UAISense_Hearing::ReportNoiseEvent for the player (MaxRange 0 = listener's HearingRadius) */
+	UFUNCTION(BlueprintCallable, Category = "Perception")
+	void ReportNoise(const FVector& Location, float MaxRange = 0.0f);
+
+private:
+	enum ESensedBits : uint8
+	{
+		Sensed_None		= 0,
+		Sensed_Sight	= 1 << 0,
+		Sensed_Hearing	= 1 << 1,
+	};
+
+	struct FNoiseEvent
+	{
+		FVector Location;
+		float MaxRange;
+	};
+
+	struct FPendingStimulus
+	{
+		TWeakObjectPtr<AEnemyBase> Enemy;
+		FVector Location;
+		bool bSight;
+		bool bSensed;
+	};
+
+	/** Slot → enemy */
+	TArray<TWeakObjectPtr<AEnemyBase>> Enemies;
+	TMap<TWeakObjectPtr<AEnemyBase>, int32> SlotByEnemy;
+
+	// Packed (SoA, padded to a multiple of 4)
+	TArray<float> PosX, PosY, PosZ;
+	TArray<float> FwdX, FwdY, FwdZ;
+	TArray<float> SightRadiusSq, CosHalfAngle, HearingRadiusSq, ProximityRadiusSq;
+	TArray<float> LoseSightRadiusSq, LoseSightTime;
+	TArray<float> SightTestRadiusSq;
+	TArray<float> Active;
+
+	/** Per slot: sight enabled by the significance LOD */
+	TArray<bool> SightEnabled;
+
+	/** Per slot: ESensedBits from the previous update */
+	TArray<uint8> PrevSensed;
+
+	/** Per slot: seconds the player stays seen without a successful sight test */
+	TArray<float> SightGraceLeft;
+
+	/** Scratch per slot: candidate bits from the SIMD pass */
+	TArray<uint8> Candidates;
+
+	TArray<FNoiseEvent> PendingNoises;
+	TArray<FPendingStimulus> PendingStimuli;
+
+	float TimeUntilUpdate = 0.0f;
+	float TimeSinceUpdate = 0.0f;
+
+	/** Round-robin start for the trace budget */
+	int32 NextTraceSlot = 0;
+
+	void SetPaddedNum(int32 Num);
+	void WriteConfig(int32 Slot, const AEnemyBase* Enemy);
+
+	void RunUpdate(APawn* Player, float Elapsed);
+	void PackEnemies(const APawn* Player);
+	void RunBatchedTests(const FVector& PlayerLocation);
+	bool TraceOcclusion(const AEnemyBase* Enemy, const APawn* Player) const;
+};
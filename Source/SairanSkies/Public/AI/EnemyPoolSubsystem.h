@@ -0,0 +1,106 @@
+// SairanSkies - Enemy Pool
+// Reusable enemy actors per class. Wave spawns take a parked enemy and reset
+// it instead of SpawnActor; dead enemies are parked again once their
+// ragdoll/despawn phase ends instead of being destroyed.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyPoolSubsystem.generated.h"
+
+class AEnemyBase;
+class APatrolPath;
+
+/** Parked + handed-out enemies of one class */
+USTRUCT()
+struct FEnemyPoolBucket
+{
+	GENERATED_BODY()
+
+	/** Parked enemies ready to be acquired (hidden, no collision, no AI) */
+	UPROPERTY()
+	TArray<TObjectPtr<AEnemyBase>> Free;
+
+	/** Every live enemy this pool created for the class (parked or in use) */
+	int32 NumCreated = 0;
+
+	/** Prewarm target still to be spawned (time-sliced in Tick) */
+	int32 PendingPrewarm = 0;
+};
+
+/**
+ * Enemy actor pool.
+ *
+ * Lifecycle of a pooled enemy:
+ *   Prewarm   → spawned deferred; the controller possesses it (and starts the BT)
+ *               in PostInitializeComponents, then BeginPlay parks it before it
+ *               registers with any AI manager or ticks
+ *   Acquire   → AEnemyBase::ResetForReuse: teleport, health/state/materials,
+ *               components, re-possess (restarts the BT with a freshly
+ *               initialised blackboard), re-register with the AI managers
+ *   Die       → ragdoll for DespawnDelay, then Release instead of Destroy
+ *   Release   → AEnemyBase::DeactivateForPool: unpossess, unregister, hide
+ *
+ * Prewarm spawns at most MaxPrewarmSpawnsPerTick per frame so that filling
+ * the pool does not become the hitch it is meant to remove. Acquire on an
+ * empty bucket still spawns (logged as a pool miss).
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	/** Enemies created per frame while pre-warming (all classes together) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EnemyPool", meta = (ClampMin = "1"))
+	int32 MaxPrewarmSpawnsPerTick = 4;
+
+	/** Upper bound of enemies created per class (parked + in use) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EnemyPool", meta = (ClampMin = "1"))
+	int32 MaxEnemiesPerClass = 256;
+
+	// ========== POOL ==========
+
+	/** Make sure at least Count enemies of Class exist (parked + in use); created over the next frames */
+	UFUNCTION(BlueprintCallable, Category = "EnemyPool")
+	void Prewarm(TSubclassOf<AEnemyBase> EnemyClass, int32 Count, const FVector& ParkLocation);
+
+	/**
+	 * Parked enemy of Class reset at Location, or a new one when the bucket is empty.
+	 * PatrolPath is assigned before the enemy starts (it picks Patrolling from it).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EnemyPool")
+	AEnemyBase* AcquireEnemy(TSubclassOf<AEnemyBase> EnemyClass, const FVector& Location, const FRotator& Rotation, APatrolPath* PatrolPath = nullptr);
+
+	/** Park an enemy created by this pool. Safe to call twice. */
+	UFUNCTION(BlueprintCallable, Category = "EnemyPool")
+	void ReleaseEnemy(AEnemyBase* Enemy);
+
+	/** Called from AEnemyBase::EndPlay: a pooled enemy was destroyed for good */
+	void NotifyEnemyDestroyed(AEnemyBase* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "EnemyPool")
+	int32 GetNumFree(TSubclassOf<AEnemyBase> EnemyClass) const;
+
+	UFUNCTION(BlueprintPure, Category = "EnemyPool")
+	int32 GetNumCreated(TSubclassOf<AEnemyBase> EnemyClass) const;
+
+private:
+	UPROPERTY()
+	TMap<TSubclassOf<AEnemyBase>, FEnemyPoolBucket> Buckets;
+
+	/** Where prewarmed enemies are parked (last requested location per class) */
+	TMap<TSubclassOf<AEnemyBase>, FVector> ParkLocations;
+
+	/** Spawn a new enemy owned by this pool; bParked = park it from BeginPlay */
+	AEnemyBase* CreateEnemy(TSubclassOf<AEnemyBase> EnemyClass, const FTransform& Transform, bool bParked, APatrolPath* PatrolPath = nullptr);
+};
@@ -0,0 +1,112 @@
+// SairanSkies - Enemy Ragdoll Manager
+// World-level budget for simulating corpses. Dead enemies ask for a ragdoll
+// here instead of always simulating full-body physics until they despawn.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyRagdollManager.generated.h"
+
+class AEnemyBase;
+class USkeletalMeshComponent;
+
+/**
+ * Ragdoll budget for dead enemies.
+ *
+ * Corpse lifecycle:
+ *   Simulating → ragdoll physics until the root body settles below
+ *                SettleSpeed for SettleTime (or MaxSimulationTime), then frozen
+ *   Montage    → fallback when the budget is full: DeathMontage plays and the
+ *                corpse is frozen just before it blends out
+ *   Frozen     → static pose: bodies off, no collision, no tick, skeleton no
+ *                longer updated (the last bone transforms are kept as-is).
+ *                Frozen corpses are not tracked any more.
+ *
+ * At most MaxSimulatingRagdolls simulate at once. When a new death exceeds the
+ * budget, the simulating corpse with the highest Age + Distance * DistanceWeight
+ * (oldest / farthest from the player) is frozen to make room, unless the new
+ * corpse itself scores worse, in which case it takes the fallback.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyRagdollManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	/** Corpses allowed to simulate physics at the same time (0 = never ragdoll) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ragdoll", meta = (ClampMin = "0"))
+	int32 MaxSimulatingRagdolls = 12;
+
+	/** Root body speed (cm/s) under which a ragdoll counts as settled */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ragdoll", meta = (ClampMin = "0.0"))
+	float SettleSpeed = 15.0f;
+
+	/** Seconds a ragdoll must stay settled before it is frozen */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ragdoll", meta = (ClampMin = "0.0"))
+	float SettleTime = 0.3f;
+
+	/** Hard cap on simulation time per corpse */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ragdoll", meta = (ClampMin = "0.1"))
+	float MaxSimulationTime = 4.0f;
+
+	/** Eviction score per cm of distance to the player (Age counts 1 per second) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ragdoll", meta = (ClampMin = "0.0"))
+	float DistanceWeight = 0.001f;
+
+	// ========== CORPSES ==========
+
+	/** Called from AEnemyBase::Die: ragdoll, death montage or immediate pose freeze */
+	void AddCorpse(AEnemyBase* Enemy);
+
+	/** Stop tracking (pool reuse / EndPlay). Does not touch the mesh. */
+	void RemoveCorpse(AEnemyBase* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "Ragdoll")
+	int32 GetNumSimulating() const { return NumSimulating; }
+
+private:
+	enum class ECorpseState : uint8
+	{
+		Simulating,
+		Montage,
+	};
+
+	struct FCorpse
+	{
+		TWeakObjectPtr<AEnemyBase> Enemy;
+		ECorpseState State = ECorpseState::Simulating;
+		float Age = 0.0f;
+		float SettledTime = 0.0f;
+
+		/** Montage fallback: Age at which the pose is frozen */
+		float FreezeAge = 0.0f;
+	};
+
+	/** Slot → corpse (AEnemyBase::RagdollSlot) */
+	TArray<FCorpse> Corpses;
+
+	int32 NumSimulating = 0;
+
+	int32 GetSlot(const AEnemyBase* Enemy) const;
+	void RemoveSlot(int32 Slot);
+
+	float GetEvictionScore(const AEnemyBase* Enemy, float Age, const FVector& ViewerLocation) const;
+	bool GetViewerLocation(FVector& OutLocation) const;
+
+	/** Cheap fallback for a corpse outside the budget */
+	void StartFallback(AEnemyBase* Enemy);
+
+	/** Freeze a slot's corpse and stop tracking it */
+	void FreezeSlot(int32 Slot);
+
+	static void FreezePose(USkeletalMeshComponent* Mesh);
+};
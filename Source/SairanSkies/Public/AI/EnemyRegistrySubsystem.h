@@ -0,0 +1,165 @@
+// SairanSkies - Enemy Registry (Uniform Spatial Hash)
+// All live enemies register here on BeginPlay / EndPlay.
+// Proximity queries (ally alerts, conversation partners...) go through this
+// instead of GetAllActorsOfClass + linear distance checks.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyRegistrySubsystem.generated.h"
+
+class AEnemyBase;
+
+/**
+ * World-level registry of every live AEnemyBase, bucketed in a uniform 2D
+ * spatial hash (XY cells of CellSize cm).
+ *
+ * Positions are refreshed once per frame in a single pass over a dense array;
+ * an enemy only touches the hash when it crosses a cell boundary.
+ *
+ * Queries:
+ *   - QueryRadius:   every enemy within Radius of a point
+ *   - QueryKNearest: the K closest enemies within MaxRadius of a point
+ *
+ * Cost of a query depends on the number of enemies in the touched cells,
+ * not on the total number of enemies in the world.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyRegistrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	/** Side of a hash cell in cm. Roughly the most common query radius. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EnemyRegistry|Config",
+		meta = (ClampMin = "100.0"))
+	float CellSize = 500.0f;
+
+	// ========== REGISTRATION ==========
+
+	UFUNCTION(BlueprintCallable, Category = "EnemyRegistry")
+	void RegisterEnemy(AEnemyBase* Enemy);
+
+	UFUNCTION(BlueprintCallable, Category = "EnemyRegistry")
+	void UnregisterEnemy(AEnemyBase* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "EnemyRegistry")
+	bool IsRegistered(const AEnemyBase* Enemy) const { return EntryIndexByEnemy.Contains(Enemy); }
+
+	UFUNCTION(BlueprintPure, Category = "EnemyRegistry")
+	int32 GetNumEnemies() const { return Entries.Num(); }
+
+	/** Every registered enemy (dense, unordered). Do not cache across frames. */
+	void GetAllEnemies(TArray<AEnemyBase*>& OutEnemies) const;
+
+	// ========== QUERIES ==========
+
+	/**
+	 * Collect all registered enemies within Radius of Center (2D cell lookup, 3D distance test).
+	 * @param Exclude  optional enemy to skip (usually the caller)
+	 * @param bIncludeDead  dead enemies stay registered until EndPlay; skipped by default
+	 * @return number of enemies added to OutEnemies
+	 */
+	int32 QueryRadius(const FVector& Center, float Radius, TArray<AEnemyBase*>& OutEnemies,
+		const AEnemyBase* Exclude = nullptr, bool bIncludeDead = false) const;
+
+	/**
+	 * Collect up to K enemies closest to Center within MaxRadius, sorted by distance.
+	 * Rings of cells are visited outwards and the search stops as soon as the
+	 * next ring cannot contain anything closer than the current K-th result.
+	 */
+	int32 QueryKNearest(const FVector& Center, int32 K, float MaxRadius, TArray<AEnemyBase*>& OutEnemies,
+		const AEnemyBase* Exclude = nullptr, bool bIncludeDead = false) const;
+
+	/** Generic filtered radius query: Predicate(AEnemyBase*) -> bool. Returns the first match by distance. */
+	template <typename PredicateType>
+	AEnemyBase* FindNearest(const FVector& Center, float Radius, const AEnemyBase* Exclude, PredicateType&& Predicate) const;
+
+private:
+	struct FEnemyEntry
+	{
+		TWeakObjectPtr<AEnemyBase> Enemy;
+		AEnemyBase* RawEnemy = nullptr;
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+	};
+
+	/** Dense array of registered enemies — iterated once per frame */
+	TArray<FEnemyEntry> Entries;
+
+	/** Enemy → index into Entries */
+	TMap<const AEnemyBase*, int32> EntryIndexByEnemy;
+
+	/** Cell → indices into Entries */
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	FIntPoint ToCell(const FVector& Location) const;
+
+	void AddToCell(const FIntPoint& Cell, int32 EntryIndex);
+	void RemoveFromCell(const FIntPoint& Cell, int32 EntryIndex);
+
+	/** Remove Entries[Index] with swap-remove, fixing up the moved entry's references */
+	void RemoveEntryAt(int32 Index);
+
+	/** Visit every entry index in cells overlapping the XY square [Center ± Radius] */
+	template <typename VisitorType>
+	void ForEachInCells(const FVector& Center, float Radius, VisitorType&& Visitor) const;
+
+	bool PassesFilter(const FEnemyEntry& Entry, const AEnemyBase* Exclude, bool bIncludeDead) const;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TEMPLATE IMPLEMENTATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+template <typename VisitorType>
+void UEnemyRegistrySubsystem::ForEachInCells(const FVector& Center, float Radius, VisitorType&& Visitor) const
+{
+	const FIntPoint MinCell = ToCell(Center - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxCell = ToCell(Center + FVector(Radius, Radius, 0.0f));
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			if (const TArray<int32>* Bucket = Cells.Find(FIntPoint(X, Y)))
+			{
+				for (int32 EntryIndex : *Bucket)
+				{
+					Visitor(EntryIndex);
+				}
+			}
+		}
+	}
+}
+
+template <typename PredicateType>
+AEnemyBase* UEnemyRegistrySubsystem::FindNearest(const FVector& Center, float Radius, const AEnemyBase* Exclude, PredicateType&& Predicate) const
+{
+	AEnemyBase* Best = nullptr;
+	float BestDistSq = FMath::Square(Radius);
+
+	ForEachInCells(Center, Radius, [&](int32 EntryIndex)
+	{
+		const FEnemyEntry& Entry = Entries[EntryIndex];
+		if (!PassesFilter(Entry, Exclude, false)) return;
+
+		const float DistSq = FVector::DistSquared(Center, Entry.Location);
+		if (DistSq <= BestDistSq && Predicate(Entry.RawEnemy))
+		{
+			BestDistSq = DistSq;
+			Best = Entry.RawEnemy;
+		}
+	});
+
+	return Best;
+}
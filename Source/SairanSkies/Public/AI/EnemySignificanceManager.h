@@ -0,0 +1,116 @@
+// SairanSkies - Enemy Significance Manager (AI LOD)
+// Buckets every enemy into a significance tier from distance to the player,
+// on-screen status and combat state, and scales its update rates accordingly.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Enemies/EnemyTypes.h"
+#include "EnemySignificanceManager.generated.h"
+
+class AEnemyBase;
+
+/**
+ * AI level-of-detail for enemies.
+ *
+ * Tiers (see EEnemySignificance):
+ *   Critical — in combat or alerted (IsInCombat / IsAlerted), always full rate
+ *   High     — within HighDistance, or within MediumDistance and on screen
+ *   Medium   — within MediumDistance, or within LowDistance and on screen
+ *   Low      — everything else (distant patrols)
+ *
+ * Each tier's FEnemySignificanceTierSettings drives movement tick interval,
+ * BT service interval, perception sight and animation tick interval.
+ *
+ * Hysteresis: demotions need the distance to exceed the threshold by
+ * HysteresisDistance and the enemy to have stayed MinTimeInTier in its
+ * current tier. Promotions are immediate (never starve a relevant enemy).
+ *
+ * Evaluation is round-robin: every enemy is re-evaluated once per
+ * EvaluationPeriod, spread over the frames in between.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemySignificanceManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UEnemySignificanceManager();
+
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance|Distances")
+	float HighDistance = 1500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance|Distances")
+	float MediumDistance = 4000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance|Distances")
+	float LowDistance = 8000.0f;
+
+	/** Extra distance required before an enemy is demoted to a cheaper tier */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance|Hysteresis", meta = (ClampMin = "0.0"))
+	float HysteresisDistance = 300.0f;
+
+	/** Minimum time an enemy stays in a tier before it can be demoted (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance|Hysteresis", meta = (ClampMin = "0.0"))
+	float MinTimeInTier = 1.0f;
+
+	/** Time window used for the on-screen test (AActor::WasRecentlyRendered) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance|Visibility", meta = (ClampMin = "0.0"))
+	float OnScreenTolerance = 0.25f;
+
+	/** Every enemy is re-evaluated once per this period (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.05"))
+	float EvaluationPeriod = 0.25f;
+
+	/** Settings per tier, indexed by EEnemySignificance */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance|Tiers")
+	TMap<EEnemySignificance, FEnemySignificanceTierSettings> TierSettings;
+
+	// ========== REGISTRATION ==========
+
+	void RegisterEnemy(AEnemyBase* Enemy);
+
+	/** Stop managing an enemy and restore full update rates (e.g. on death for the ragdoll) */
+	void UnregisterEnemy(AEnemyBase* Enemy);
+
+	/** Re-evaluate immediately (e.g. the enemy just entered combat) */
+	void RequestImmediateEvaluation(AEnemyBase* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "Significance")
+	int32 GetNumEnemiesInTier(EEnemySignificance Tier) const;
+
+private:
+	struct FSignificanceEntry
+	{
+		TWeakObjectPtr<AEnemyBase> Enemy;
+		EEnemySignificance Tier = EEnemySignificance::Critical;
+		float TierEnterTime = 0.0f;
+	};
+
+	TArray<FSignificanceEntry> Entries;
+
+	/** Round-robin cursor into Entries */
+	int32 NextEvaluationIndex = 0;
+
+	/** Fractional enemies owed to the round-robin from previous frames */
+	float EvaluationCarry = 0.0f;
+
+	EEnemySignificance ComputeTier(const FSignificanceEntry& Entry, const FVector& ViewerLocation, float Now) const;
+
+	void Evaluate(FSignificanceEntry& Entry, const FVector& ViewerLocation, float Now);
+
+	void ApplyTier(AEnemyBase* Enemy, EEnemySignificance Tier) const;
+
+	const FEnemySignificanceTierSettings& GetSettings(EEnemySignificance Tier) const;
+
+	bool GetViewerLocation(FVector& OutLocation) const;
+};
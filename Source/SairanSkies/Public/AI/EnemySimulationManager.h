@@ -0,0 +1,126 @@
+// SairanSkies - Enemy Simulation Manager (SoA timers)
+// Replaces per-actor AEnemyBase::Tick: every enemy timer/cooldown lives in
+// contiguous arrays here and is advanced in one batched pass per frame.
+// Enemies only get called back when a timer crosses zero.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemySimulationManager.generated.h"
+
+class AEnemyBase;
+
+/**
+ * Per-enemy countdown timers owned by the simulation manager.
+ * Each one fires a single event on the frame it reaches zero.
+ * At most 8 channels: the fired set is packed in one uint8 per enemy.
+ * Ambient timers (pauses, look-arounds, conversations) are sparse and live in
+ * the timing wheel of UEnemyAmbientDirector instead.
+ */
+enum class EEnemySimTimer : uint8
+{
+	AttackCooldown,			// bCanAttack = true
+	LoseSight,				// target not seen for LoseSightTime → LoseTarget
+
+	Count
+};
+
+static_assert(static_cast<uint8>(EEnemySimTimer::Count) <= 8, "Fired timer mask is a uint8");
+
+/**
+ * Per-enemy work that cannot be expressed as a scalar countdown
+ * (it moves the actor). Only enemies with a non-zero mask are visited.
+ */
+namespace EEnemySimContinuous
+{
+	enum Type : uint8
+	{
+		None				= 0,
+		LookAround			= 1 << 0,	// rotate towards look target / back
+		FacePartner			= 1 << 1,	// rotate towards conversation partner
+		TrackTarget			= 1 << 2,	// visibility check, refresh LoseSight
+	};
+}
+
+/**
+ * Data-oriented replacement for AEnemyBase::Tick.
+ *
+ * Layout (structure of arrays, index = enemy slot):
+ *   Timers[Channel][Slot]  float seconds remaining (0 = inactive/fired)
+ *   Continuous[Slot]       EEnemySimContinuous mask
+ *   Enemies[Slot]          owning actor
+ *
+ * Frame:
+ *   1. Continuous pass — only slots with a non-zero mask
+ *   2. Timer pass      — per channel, branch-free decrement + crossing detection
+ *   3. Dispatch        — one AEnemyBase::OnSimulationTimerExpired per crossing
+ *
+ * Enemy actors do not tick at all.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemySimulationManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== REGISTRATION ==========
+
+	void RegisterEnemy(AEnemyBase* Enemy);
+	void UnregisterEnemy(AEnemyBase* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "EnemySimulation")
+	int32 GetNumSimulatedEnemies() const { return Enemies.Num(); }
+
+	// ========== TIMERS ==========
+
+	/** Arm a timer. Values <= 0 are clamped so the event still fires next frame. */
+	void SetTimer(const AEnemyBase* Enemy, EEnemySimTimer Timer, float Seconds);
+
+	/** Stop a timer without firing its event */
+	void ClearTimer(const AEnemyBase* Enemy, EEnemySimTimer Timer);
+
+	float GetTimerRemaining(const AEnemyBase* Enemy, EEnemySimTimer Timer) const;
+
+	bool IsTimerActive(const AEnemyBase* Enemy, EEnemySimTimer Timer) const
+	{
+		return GetTimerRemaining(Enemy, Timer) > 0.0f;
+	}
+
+	// ========== CONTINUOUS WORK ==========
+
+	void SetContinuousMask(const AEnemyBase* Enemy, uint8 Mask);
+
+private:
+	static constexpr int32 NumTimers = static_cast<int32>(EEnemySimTimer::Count);
+
+	/** Slot → actor */
+	UPROPERTY()
+	TArray<TObjectPtr<AEnemyBase>> Enemies;
+
+	/** Timers[Channel][Slot] */
+	TArray<float> Timers[NumTimers];
+
+	/** Continuous[Slot] */
+	TArray<uint8> Continuous;
+
+	/** Scratch: Fired[Slot] bitmask of timers that crossed zero this frame */
+	TArray<uint8> Fired;
+
+	struct FPendingEvent
+	{
+		TWeakObjectPtr<AEnemyBase> Enemy;
+		uint8 FiredMask;
+	};
+
+	/** Scratch: events collected before dispatch (handlers may re-arm / unregister) */
+	TArray<FPendingEvent> PendingEvents;
+
+	int32 GetSlot(const AEnemyBase* Enemy) const;
+};
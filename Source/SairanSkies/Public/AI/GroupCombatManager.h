@@ -22,9 +22,29 @@ class AEnemyBase;
  *   3. If granted → enters inner circle, positions randomly, attacks
  *   4. After attack → probability to stay or retreat to outer circle
  *   5. If retreats → NotifyInnerCircleFreed → next outer enemy advances
+ *
+ * Scheduling (constant time per call, independent of enemy count):
+ *   - Each enemy holds a stable handle into Records (AEnemyBase::CombatHandle)
+ *   - One token pool per target actor: dense Outer/Inner lists (swap-remove,
+ *     the record keeps its index) and MaxInnerCircleEnemies tokens
+ *   - Outer enemies wait in a ready queue (binary heap) ordered by the time
+ *     their InnerCircleCooldown ends, then by distance to the target
+ *   - When a token is free the head of the queue gets it reserved; the
+ *     reservation is claimed by that enemy's next RequestInnerCircleEntry
+ *     or returned to the queue after ReservationTimeout
+ *
+ * Ring slots (solved here, read by the BT tasks):
+ *   - Per pool and circle, N evenly spaced slots around the target, projected
+ *     onto the navmesh once per solve instead of once per enemy query
+ *   - Enemies are sorted by their angle around the target and matched in
+ *     order (no crossing paths); the ring rotation is the one minimising the
+ *     summed squared distance to the slots, so a settled group re-solves to
+ *     the same slots
+ *   - Re-solved when membership changes, or every RingSolveInterval once the
+ *     target has moved more than RingResolveDistance
  */
 UCLASS()
-class SAIRANSKIES_API UGroupCombatManager : public UWorldSubsystem
+class SAIRANSKIES_API UGroupCombatManager : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -32,9 +52,16 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
 	// ========== CONFIGURATION ==========
 
-	/** Max enemies allowed in the inner circle (attacking) at the same time */
+	/**
+	 * Max enemies allowed in the inner circle (attacking) at the same time, per target.
+	 * A manager setting: every target's pool uses it, whatever enemies registered.
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GroupCombat|Config",
 		meta = (ClampMin = "1", ClampMax = "8"))
 	int32 MaxInnerCircleEnemies = 3;
@@ -44,8 +71,33 @@ public:
 		meta = (ClampMin = "0.0", ClampMax = "10.0"))
 	float InnerCircleCooldown = 2.0f;
 
+	/** How long a token reserved for the head of the ready queue waits to be claimed (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GroupCombat|Config",
+		meta = (ClampMin = "0.1", ClampMax = "10.0"))
+	float ReservationTimeout = 1.5f;
+
+	/** Seconds between ring re-solves while the target keeps moving */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GroupCombat|Rings",
+		meta = (ClampMin = "0.05"))
+	float RingSolveInterval = 0.5f;
+
+	/** Target displacement since the last solve that triggers a new one */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GroupCombat|Rings",
+		meta = (ClampMin = "0.0"))
+	float RingResolveDistance = 150.0f;
+
+	/** A slot that moves less than this keeps its version (tasks don't re-target) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GroupCombat|Rings",
+		meta = (ClampMin = "0.0"))
+	float RingSlotTolerance = 50.0f;
+
+	/** Extent used to project ring slots onto the navmesh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GroupCombat|Rings")
+	FVector RingNavProjectExtent = FVector(200.0f, 200.0f, 300.0f);
+
 	// ========== REGISTRATION ==========
 
+	/** Joins the token pool of the enemy's current target (moves pools if the target changed) */
 	UFUNCTION(BlueprintCallable, Category = "GroupCombat")
 	void RegisterCombatEnemy(AEnemyBase* Enemy);
 
@@ -54,7 +106,7 @@ public:
 
 	// ========== INNER CIRCLE ==========
 
-	/** Request to enter the inner circle. Returns true if there's space. */
+	/** Request to enter the inner circle. Returns true if a token is (or was reserved) for this enemy. */
 	UFUNCTION(BlueprintCallable, Category = "GroupCombat")
 	bool RequestInnerCircleEntry(AEnemyBase* Enemy);
 
@@ -76,27 +128,37 @@ public:
 	bool IsInOuterCircle(AEnemyBase* Enemy) const;
 
 	UFUNCTION(BlueprintPure, Category = "GroupCombat")
-	int32 GetInnerCircleCount() const { return InnerCircleEnemies.Num(); }
+	int32 GetInnerCircleCount() const { return NumInner; }
 
 	UFUNCTION(BlueprintPure, Category = "GroupCombat")
-	int32 GetOuterCircleCount() const { return OuterCircleEnemies.Num(); }
+	int32 GetOuterCircleCount() const { return NumOuter; }
 
 	UFUNCTION(BlueprintPure, Category = "GroupCombat")
-	int32 GetTotalCombatEnemies() const { return CombatEnemies.Num(); }
+	int32 GetTotalCombatEnemies() const { return NumInner + NumOuter; }
 
+	/** True if Target's pool has an unreserved token left */
 	UFUNCTION(BlueprintPure, Category = "GroupCombat")
-	bool HasInnerCircleSpace() const;
+	bool HasInnerCircleSpace(AActor* Target) const;
+
+	UFUNCTION(BlueprintPure, Category = "GroupCombat")
+	int32 GetInnerCircleCountForTarget(AActor* Target) const;
 
 	// ========== POSITIONING ==========
 
-	/** Get a position on the outer circle for this enemy */
+	/** Solved outer ring slot for this enemy (unsolved: deterministic ring point) */
 	UFUNCTION(BlueprintCallable, Category = "GroupCombat")
 	FVector GetOuterCirclePosition(AEnemyBase* Enemy, AActor* Target) const;
 
-	/** Pick a random attack position within the inner circle */
+	/** Solved inner ring slot for this enemy (unsolved: random point in attack range) */
 	UFUNCTION(BlueprintCallable, Category = "GroupCombat")
 	FVector GetInnerCircleAttackPosition(AEnemyBase* Enemy, AActor* Target) const;
 
+	/**
+	 * Published slot for the enemy's current circle. OutVersion changes only when
+	 * the slot moved more than RingSlotTolerance, so tasks can skip re-targeting.
+	 */
+	bool GetAssignedRingSlot(const AEnemyBase* Enemy, FVector& OutLocation, uint32& OutVersion) const;
+
 	// ========== LEGACY COMPATIBILITY ==========
 
 	UFUNCTION(BlueprintCallable, Category = "GroupCombat")
@@ -106,10 +168,10 @@ public:
 	void ReleaseAttackSlot(AEnemyBase* Enemy) { ForceToOuterCircle(Enemy); }
 
 	UFUNCTION(BlueprintPure, Category = "GroupCombat")
-	bool CanEnemyAttack(AEnemyBase* Enemy) const { return HasInnerCircleSpace() || IsInInnerCircle(Enemy); }
+	bool CanEnemyAttack(AEnemyBase* Enemy) const;
 
 	UFUNCTION(BlueprintPure, Category = "GroupCombat")
-	int32 GetActiveAttackerCount() const { return InnerCircleEnemies.Num(); }
+	int32 GetActiveAttackerCount() const { return NumInner; }
 
 	UFUNCTION(BlueprintPure, Category = "GroupCombat")
 	bool IsActiveAttacker(AEnemyBase* Enemy) const { return IsInInnerCircle(Enemy); }
@@ -117,26 +179,123 @@ public:
 	FVector GetFlankingPosition(AEnemyBase* Enemy, AActor* Target) const { return GetOuterCirclePosition(Enemy, Target); }
 	FVector GetOuterRingPosition(AEnemyBase* Enemy, AActor* Target) const { return GetOuterCirclePosition(Enemy, Target); }
 	bool CanEnemyFlank(AEnemyBase* Enemy) const { return true; }
-	int32 GetFlankingEnemyCount() const { return OuterCircleEnemies.Num(); }
+	int32 GetFlankingEnemyCount() const { return NumOuter; }
 	bool RequestFlankingSlot(AEnemyBase* Enemy) { return true; }
 	void ReleaseFlankingSlot(AEnemyBase* Enemy) {}
 	void UpdateProximityPriorities(const FVector& PlayerLocation) {}
 
 private:
-	UPROPERTY()
-	TArray<AEnemyBase*> CombatEnemies;
-
-	UPROPERTY()
-	TArray<AEnemyBase*> OuterCircleEnemies;
-
-	UPROPERTY()
-	TArray<AEnemyBase*> InnerCircleEnemies;
-
-	TMap<TWeakObjectPtr<AEnemyBase>, float> InnerCooldowns;
-
-	void PurgeInvalidEnemies();
-
-	AEnemyBase* PickNextFromOuterCircle(AActor* Target) const;
+	enum class ECombatCircle : uint8
+	{
+		None,
+		Outer,
+		Inner,
+	};
+
+	/** Per-enemy state; index = the enemy's CombatHandle (stable while registered) */
+	struct FCombatRecord
+	{
+		TWeakObjectPtr<AEnemyBase> Enemy;
+		int32 Pool = INDEX_NONE;
+		ECombatCircle Circle = ECombatCircle::None;
+
+		/** Index in Pools[Pool].Outer or .Inner, depending on Circle */
+		int32 CircleIndex = INDEX_NONE;
+
+		float CooldownEnd = 0.0f;
+
+		/** >= 0 while holding a reserved token (world time it expires) */
+		float ReservedUntil = -1.0f;
+
+		/** Serial of the live ready-queue entry (0 = not queued) */
+		uint32 QueueSerial = 0;
+
+		/** Index in the current circle's ring slots (INDEX_NONE = not solved yet) */
+		int32 RingSlot = INDEX_NONE;
+		FVector RingLocation = FVector::ZeroVector;
+		uint32 RingVersion = 0;
+	};
+
+	/** Solved slots for one circle of one pool */
+	struct FRingLayout
+	{
+		TArray<FVector> Slots;
+		FVector SolvedCenter = FVector::ZeroVector;
+		bool bDirty = false;
+	};
+
+	struct FReadyEntry
+	{
+		float ReadyTime;
+		float Priority;
+		int32 Handle;
+		uint32 Serial;
+	};
+
+	struct FReadyEntryPredicate
+	{
+		bool operator()(const FReadyEntry& A, const FReadyEntry& B) const
+		{
+			if (A.ReadyTime != B.ReadyTime) return A.ReadyTime < B.ReadyTime;
+			if (A.Priority != B.Priority) return A.Priority < B.Priority;
+			return A.Serial < B.Serial;
+		}
+	};
+
+	/** Tokens and circles for one target actor */
+	struct FTargetTokenPool
+	{
+		TWeakObjectPtr<AActor> Target;
+		TArray<int32> Outer;
+		TArray<int32> Inner;
+
+		/** Handles holding a reserved token (never more than MaxInnerCircleEnemies) */
+		TArray<int32> Reserved;
+
+		/** Binary heap of outer enemies waiting for a token; stale entries are skipped on pop */
+		TArray<FReadyEntry> ReadyQueue;
+
+		FRingLayout OuterRing;
+		FRingLayout InnerRing;
+		float TimeSinceSolve = 0.0f;
+
+		int32 NumMembers() const { return Outer.Num() + Inner.Num(); }
+		int32 NumTokensInUse() const { return Inner.Num() + Reserved.Num(); }
+	};
+
+	TArray<FCombatRecord> Records;
+	TArray<int32> FreeHandles;
+
+	TArray<FTargetTokenPool> Pools;
+	TArray<int32> FreePools;
+	TMap<TWeakObjectPtr<AActor>, int32> PoolByTarget;
+
+	int32 NumInner = 0;
+	int32 NumOuter = 0;
+	uint32 NextQueueSerial = 1;
+
+	/** Global so a re-registered enemy never repeats a version a task has seen */
+	uint32 NextRingVersion = 1;
+
+	int32 GetHandle(const AEnemyBase* Enemy) const;
+	int32 AcquirePool(AActor* Target);
+	void ReleasePoolIfEmpty(int32 PoolIndex);
+	void RemoveRecord(int32 Handle);
+
+	void AddToCircle(int32 Handle, ECombatCircle Circle);
+	void RemoveFromCircle(int32 Handle);
+
+	void Enqueue(int32 Handle, float ReadyTime);
+	void CancelReservation(int32 Handle);
+
+	/** Inner → outer with cooldown. Returns false if the enemy wasn't inner. */
+	bool RetreatToOuter(int32 Handle, float Now);
+
+	/** Expire stale reservations, then reserve free tokens for the queue head. Returns the first newly reserved handle. */
+	int32 PromoteReady(int32 PoolIndex, float Now);
+
+	void SolveRing(FTargetTokenPool& Pool, ECombatCircle Circle);
+	bool ProjectToNavigation(const FVector& Point, FVector& OutLocation) const;
 
 	FVector ComputeRingPosition(int32 EnemyIndex, int32 TotalOnRing,
 		float MinR, float MaxR, const FVector& Center, int32 Seed) const;
@@ -6,6 +6,12 @@
 #include "BehaviorTree/BTService.h"
 #include "BTService_UpdateEnemyState.generated.h"
 
+/**
+ * Blackboard values are pushed by AEnemyBase when they change (state, target,
+ * visibility, distance, attack readiness). This service no longer polls: it
+ * only resyncs everything when its branch becomes relevant, so trees that
+ * still carry it keep working at no per-tick cost.
+ */
 UCLASS()
 class SAIRANSKIES_API UBTService_UpdateEnemyState : public UBTService
 {
@@ -15,6 +21,6 @@ public:
 	UBTService_UpdateEnemyState();
 
 protected:
-	virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+	virtual void OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 	virtual FString GetStaticDescription() const override;
 };
@@ -26,6 +26,19 @@ enum class EAttackPhase : uint8
 	Finished     // Combo completo → decide quedarse o salir
 };
 
+/** Estado por enemigo (node memory, el task es una plantilla compartida) */
+struct FBTAttackTargetMemory
+{
+	EAttackPhase Phase = EAttackPhase::Approach;
+	float PhaseTimer = 0.0f;
+	int32 CurrentHit = 0;
+	int32 TotalHits = 1;
+	int32 ChosenComboIndex = 0;
+	FRotator OriginalRotation = FRotator::ZeroRotator;
+	FVector StrikeStartLocation = FVector::ZeroVector;
+	FVector AttackPosition = FVector::ZeroVector;
+};
+
 /**
  * Task de ataque del inner circle.
  *
@@ -49,6 +62,9 @@ public:
 	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 	virtual FString GetStaticDescription() const override;
+	virtual uint16 GetInstanceMemorySize() const override;
+	virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
 
 protected:
 	// ── Timing ──
@@ -94,24 +110,15 @@ protected:
 	float DebugLungeDistance = 60.0f;
 
 private:
-	EAttackPhase Phase = EAttackPhase::Approach;
-	float PhaseTimer = 0.0f;
-	int32 CurrentHit = 0;
-	int32 TotalHits = 1;
-	int32 ChosenComboIndex = 0;
-	FRotator OriginalRotation = FRotator::ZeroRotator;
-	FVector StrikeStartLocation = FVector::ZeroVector;
-	FVector AttackPosition = FVector::ZeroVector;
-
 	/** Probabilistic combo selection algorithm */
-	void PickComboByDistance(AEnemyBase* Enemy);
+	void PickComboByDistance(FBTAttackTargetMemory& Memory, AEnemyBase* Enemy) const;
 
 	/** Apply damage with variance */
-	void ApplyDamage(AEnemyBase* Enemy, AActor* Target);
+	void ApplyDamage(AEnemyBase* Enemy, AActor* Target) const;
 
 	/** Debug rotation per hit */
-	void ApplyDebugRotation(AEnemyBase* Enemy, bool bRestore);
+	void ApplyDebugRotation(FBTAttackTargetMemory& Memory, AEnemyBase* Enemy, bool bRestore) const;
 
 	/** Cleanup on finish/abort */
-	void Cleanup(UBehaviorTreeComponent& OwnerComp, AEnemyBase* Enemy);
+	void Cleanup(FBTAttackTargetMemory& Memory, UBehaviorTreeComponent& OwnerComp, AEnemyBase* Enemy) const;
 };
@@ -6,9 +6,31 @@
 #include "BehaviorTree/BTTaskNode.h"
 #include "BTTask_ChaseTarget.generated.h"
 
+class AEnemyBase;
+class AEnemyAIController;
+
+/** Per-enemy run state (node memory, shared task template) */
+struct FBTChaseTargetMemory
+{
+	/** Steering along the shared flow field instead of path following */
+	bool bFollowingFlowField = false;
+
+	/** Progress check while on the field: closest distance so far and time since it improved */
+	float BestDistance = 0.0f;
+	float StalledTime = 0.0f;
+
+	/** Seconds left before the field is tried again after a stall */
+	float FlowFieldCooldown = 0.0f;
+};
+
 /**
  * Persigue al target hasta llegar a la distancia de ataque.
  * Persecución directa, sin rodeo.
+ *
+ * Dentro del flow field del target (UEnemyFlowFieldManager) se mueve con
+ * AddMovementInput siguiendo el campo; fuera de él, QueueMoveToActor (cola de paths).
+ * Si siguiendo el campo no se acerca al target (atascado en geometría que el
+ * campo no ve), vuelve al path durante FlowFieldRetryDelay.
  */
 UCLASS()
 class SAIRANSKIES_API UBTTask_ChaseTarget : public UBTTaskNode
@@ -22,6 +44,31 @@ public:
 	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 	virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 	virtual FString GetStaticDescription() const override;
+
+	virtual uint16 GetInstanceMemorySize() const override;
+	virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
+
+protected:
+	/** Use the shared flow field when the enemy is inside a ready one */
+	UPROPERTY(EditAnywhere, Category = "Chase")
+	bool bUseFlowField = true;
+
+	/** Seconds on the field without getting MinProgressDistance closer before falling back to a path */
+	UPROPERTY(EditAnywhere, Category = "Chase", meta = (ClampMin = "0.1", EditCondition = "bUseFlowField"))
+	float StallTimeout = 1.0f;
+
+	/** Distance (cm) the enemy must close on the target within StallTimeout */
+	UPROPERTY(EditAnywhere, Category = "Chase", meta = (ClampMin = "0.0", EditCondition = "bUseFlowField"))
+	float MinProgressDistance = 50.0f;
+
+	/** Seconds of path following after a stall before the field is used again */
+	UPROPERTY(EditAnywhere, Category = "Chase", meta = (ClampMin = "0.0", EditCondition = "bUseFlowField"))
+	float FlowFieldRetryDelay = 2.0f;
+
+private:
+	/** Steer one frame along the flow field. False = not covered or stalled, use pathfinding. */
+	bool StepFlowField(FBTChaseTargetMemory& Memory, AEnemyAIController* AIController, AEnemyBase* Enemy, AActor* Target, float DeltaSeconds) const;
 };
 
 
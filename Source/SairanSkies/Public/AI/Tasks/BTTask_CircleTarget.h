@@ -12,6 +12,28 @@
 
 class AEnemyBase;
 
+enum class ECircleFeintState : uint8 { None, Lunging, Retreating };
+
+/** Per-enemy run state (node memory, shared task template) */
+struct FBTCircleTargetMemory
+{
+	float TaskTimer = 0.0f;
+	float RepositionTimer = 0.0f;
+	float NextRepositionTime = 3.0f;
+	float FeintAccumulator = 0.0f;  // rolls feint chance
+	float SwayPhase = 0.0f;         // oscillation phase
+
+	// Feint state machine
+	ECircleFeintState FeintState = ECircleFeintState::None;
+	float FeintTimer = 0.0f;
+	FVector FeintOrigin = FVector::ZeroVector;
+
+	// Flanking
+	FVector CurrentRingTarget = FVector::ZeroVector;
+	bool bHasFlankSlot = false;
+	bool bReachedRingTarget = false;
+};
+
 /**
  * ⚠️ DEPRECATED — Usar BTTask_OuterCircleBehavior
  *
@@ -29,6 +51,9 @@ public:
 	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 	virtual void OnTaskFinished(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTNodeResult::Type TaskResult) override;
 	virtual FString GetStaticDescription() const override;
+	virtual uint16 GetInstanceMemorySize() const override;
+	virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
 
 protected:
 	// ── Movement ──
@@ -76,30 +101,12 @@ protected:
 	float MaxTaskDuration = 6.0f;
 
 private:
-	// State
-	float TaskTimer = 0.0f;
-	float RepositionTimer = 0.0f;
-	float NextRepositionTime = 3.0f;
-	float FeintAccumulator = 0.0f;  // rolls feint chance
-	float SwayPhase = 0.0f;         // oscillation phase
-
-	// Feint state machine
-	enum class EFeintState : uint8 { None, Lunging, Retreating };
-	EFeintState FeintState = EFeintState::None;
-	float FeintTimer = 0.0f;
-	FVector FeintOrigin = FVector::ZeroVector;
-
-	// Flanking
-	FVector CurrentRingTarget = FVector::ZeroVector;
-	bool bHasFlankSlot = false;
-	bool bReachedRingTarget = false;
-
 	// Helpers
-	void PickNewRingTarget(AEnemyBase* Enemy, AActor* Target);
-	void MoveTowardsFacingPlayer(AEnemyBase* Enemy, AActor* Target, const FVector& Destination, float DeltaTime);
-	void FacePlayer(AEnemyBase* Enemy, AActor* Target, float DeltaTime);
-	void ApplySway(AEnemyBase* Enemy, AActor* Target, float DeltaTime);
-	void StartFeint(AEnemyBase* Enemy, AActor* Target);
-	void UpdateFeint(AEnemyBase* Enemy, AActor* Target, float DeltaTime);
-	void CleanupState(AEnemyBase* Enemy);
+	void PickNewRingTarget(FBTCircleTargetMemory& Memory, AEnemyBase* Enemy, AActor* Target) const;
+	void MoveTowardsFacingPlayer(AEnemyBase* Enemy, AActor* Target, const FVector& Destination, float DeltaTime) const;
+	void FacePlayer(AEnemyBase* Enemy, AActor* Target, float DeltaTime) const;
+	void ApplySway(FBTCircleTargetMemory& Memory, AEnemyBase* Enemy, AActor* Target, float DeltaTime) const;
+	void StartFeint(FBTCircleTargetMemory& Memory, AEnemyBase* Enemy, AActor* Target) const;
+	void UpdateFeint(FBTCircleTargetMemory& Memory, AEnemyBase* Enemy, AActor* Target, float DeltaTime) const;
+	void CleanupState(FBTCircleTargetMemory& Memory, AEnemyBase* Enemy) const;
 };
@@ -6,6 +6,14 @@
 #include "BehaviorTree/BTTaskNode.h"
 #include "BTTask_IdleBehavior.generated.h"
 
+/** Per-enemy run state (node memory, shared task template) */
+struct FBTIdleBehaviorMemory
+{
+	float CurrentPauseTimer = 0.0f;
+	float TargetPauseDuration = 0.0f;
+	bool bIsPausing = false;
+};
+
 /**
  * Task that handles natural idle behaviors like random pauses, looking around, etc.
  * Makes the AI feel more natural and less robotic.
@@ -21,6 +29,9 @@ public:
 	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 	virtual FString GetStaticDescription() const override;
+	virtual uint16 GetInstanceMemorySize() const override;
+	virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
 
 protected:
 	// Probability that this task will actually pause (0-1)
@@ -42,10 +53,5 @@ protected:
 	// Whether to use enemy's BehaviorConfig values instead
 	UPROPERTY(EditAnywhere, Category = "Idle Behavior")
 	bool bUseEnemyConfig = true;
-
-private:
-	float CurrentPauseTimer;
-	float TargetPauseDuration;
-	bool bIsPausing;
 };
 
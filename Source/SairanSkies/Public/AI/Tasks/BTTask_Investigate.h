@@ -6,6 +6,18 @@
 #include "BehaviorTree/BTTaskNode.h"
 #include "BTTask_Investigate.generated.h"
 
+class AEnemyBase;
+
+/** Per-enemy run state (node memory, shared task template) */
+struct FBTInvestigateMemory
+{
+	int32 CurrentInvestigationPoint = 0;
+	float WaitTimer = 0.0f;
+	float TotalInvestigationTime = 0.0f;
+	bool bWaitingAtPoint = false;
+	FVector CurrentTargetLocation = FVector::ZeroVector;
+};
+
 UCLASS()
 class SAIRANSKIES_API UBTTask_Investigate : public UBTTaskNode
 {
@@ -18,6 +30,9 @@ public:
 	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 	virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 	virtual FString GetStaticDescription() const override;
+	virtual uint16 GetInstanceMemorySize() const override;
+	virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
 
 protected:
 	UPROPERTY(EditAnywhere, Category = "Investigation")
@@ -29,10 +44,6 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Investigation")
 	float WaitTimeAtPoint = 2.0f;
 
-private:
-	int32 CurrentInvestigationPoint;
-	float WaitTimer;
-	float TotalInvestigationTime;
-	bool bWaitingAtPoint;
-	FVector CurrentTargetLocation;
+	/** Reachable point around Origin within the enemy's InvestigationRadius (UEnemyNavigationCache) */
+	bool FindInvestigationPoint(const AEnemyBase* Enemy, const FVector& Origin, FVector& OutPoint) const;
 };
@@ -9,6 +9,38 @@
 
 class AEnemyBase;
 
+enum class EOuterCircleTauntState : uint8 { None, Lunging, Retreating };
+
+/** Per-enemy run state (node memory, shared task template) */
+struct FBTOuterCircleMemory
+{
+	// Timers
+	float TaskTimer = 0.0f;
+	float RepositionTimer = 0.0f;
+	float NextRepositionTime = 4.0f;
+	float TauntAccumulator = 0.0f;
+	float SwayPhase = 0.0f;
+	float InnerCheckTimer = 0.0f;
+	float ReactionDelay = 0.0f;
+	float ReactionTimer = 0.0f;
+	bool bWaitingToReposition = false;
+
+	// Last known player position for reaction delay
+	FVector LastPlayerPosition = FVector::ZeroVector;
+
+	// Taunt state machine
+	EOuterCircleTauntState TauntState = EOuterCircleTauntState::None;
+	float TauntTimer = 0.0f;
+	FVector TauntOrigin = FVector::ZeroVector;
+
+	// Movement target
+	FVector CurrentRingTarget = FVector::ZeroVector;
+	bool bReachedTarget = false;
+
+	// Version of the GroupCombatManager slot CurrentRingTarget came from
+	uint32 RingVersion = 0;
+};
+
 /**
  * Outer Circle behavior — enemies stay at ~5m, do taunts, feints,
  * and lateral movement. They look menacing while waiting for an
@@ -29,6 +61,9 @@ public:
 	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 	virtual void OnTaskFinished(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTNodeResult::Type TaskResult) override;
 	virtual FString GetStaticDescription() const override;
+	virtual uint16 GetInstanceMemorySize() const override;
+	virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
 
 protected:
 	// ── Movement ──
@@ -75,37 +110,13 @@ protected:
 	float InnerCircleCheckInterval = 0.5f;
 
 private:
-	// Timers
-	float TaskTimer = 0.0f;
-	float RepositionTimer = 0.0f;
-	float NextRepositionTime = 4.0f;
-	float TauntAccumulator = 0.0f;
-	float SwayPhase = 0.0f;
-	float InnerCheckTimer = 0.0f;
-	float ReactionDelay = 0.0f;
-	float ReactionTimer = 0.0f;
-	bool bWaitingToReposition = false;
-
-	// Last known player position for reaction delay
-	FVector LastPlayerPosition = FVector::ZeroVector;
-
-	// Taunt state machine
-	enum class ETauntState : uint8 { None, Lunging, Retreating };
-	ETauntState TauntState = ETauntState::None;
-	float TauntTimer = 0.0f;
-	FVector TauntOrigin = FVector::ZeroVector;
-
-	// Movement target
-	FVector CurrentRingTarget = FVector::ZeroVector;
-	bool bReachedTarget = false;
-
 	// Helpers
-	void PickNewRingTarget(AEnemyBase* Enemy, AActor* Target);
-	void FacePlayer(AEnemyBase* Enemy, AActor* Target, float DeltaTime);
-	void MoveTowardsFacingPlayer(AEnemyBase* Enemy, AActor* Target, const FVector& Dest, float DeltaTime);
-	void ApplySway(AEnemyBase* Enemy, AActor* Target, float DeltaTime);
-	void StartTaunt(AEnemyBase* Enemy, AActor* Target);
-	void UpdateTaunt(AEnemyBase* Enemy, AActor* Target, float DeltaTime);
-	void CleanupState(AEnemyBase* Enemy);
+	void PickNewRingTarget(FBTOuterCircleMemory& Memory, AEnemyBase* Enemy, AActor* Target) const;
+	void FacePlayer(AEnemyBase* Enemy, AActor* Target, float DeltaTime) const;
+	void MoveTowardsFacingPlayer(AEnemyBase* Enemy, AActor* Target, const FVector& Dest, float DeltaTime) const;
+	void ApplySway(FBTOuterCircleMemory& Memory, AEnemyBase* Enemy, AActor* Target, float DeltaTime) const;
+	void StartTaunt(FBTOuterCircleMemory& Memory, AEnemyBase* Enemy, AActor* Target) const;
+	void UpdateTaunt(FBTOuterCircleMemory& Memory, AEnemyBase* Enemy, AActor* Target, float DeltaTime) const;
+	void CleanupState(FBTOuterCircleMemory& Memory, AEnemyBase* Enemy) const;
 };
 
@@ -6,6 +6,21 @@
 #include "BehaviorTree/BTTaskNode.h"
 #include "BTTask_WaitAtPatrolPoint.generated.h"
 
+/** Per-enemy run state (node memory, shared task template) */
+struct FBTWaitAtPatrolPointMemory
+{
+	float WaitTimer = 0.0f;
+	float TargetWaitTime = 0.0f;
+
+	// Look around state
+	int32 CurrentLookIndex = 0;
+	float LookTimer = 0.0f;
+
+	// Conversation state
+	bool bCheckedForConversation = false;
+	bool bInConversation = false;
+};
+
 UCLASS()
 class SAIRANSKIES_API UBTTask_WaitAtPatrolPoint : public UBTTaskNode
 {
@@ -17,6 +32,9 @@ public:
 	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 	virtual FString GetStaticDescription() const override;
+	virtual uint16 GetInstanceMemorySize() const override;
+	virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
 
 protected:
 	// Use enemy's PatrolConfig wait time range
@@ -58,19 +76,4 @@ protected:
 	// Time standing still before checking for conversation
 	UPROPERTY(EditAnywhere, Category = "Conversation", meta = (EditCondition = "bCheckForConversation"))
 	float TimeBeforeConversationCheck = 1.5f;
-
-private:
-	float WaitTimer;
-	float TargetWaitTime;
-	
-	// Look around state
-	FRotator OriginalRotation;
-	FRotator TargetLookRotation;
-	int32 CurrentLookIndex;
-	float LookTimer;
-	bool bIsRotating;
-
-	// Conversation state
-	bool bCheckedForConversation;
-	bool bInConversation;
 };
@@ -9,9 +9,42 @@
 
 class AEnemyBase;
 
+/**
+ * Game-thread data the enemy animation update needs, gathered once per frame
+ * in NativeUpdateAnimation. The thread-safe update only reads this.
+ */
+struct FEnemyAnimSnapshot
+{
+	FVector Velocity = FVector::ZeroVector;
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	EEnemyState State = EEnemyState::Idle;
+	float SuspicionLevel = 0.0f;
+	bool bIsFalling = false;
+	bool bIsDead = false;
+	bool bIsInCombat = false;
+	bool bIsAlerted = false;
+	bool bIsInRandomPause = false;
+
+	/** One-shot look-at request (SetLookAtTarget), resolved against this frame's transform */
+	bool bHasLookAtTarget = false;
+	FVector LookAtTarget = FVector::ZeroVector;
+
+	/** One-shot relative look-at request (SetLookAtRotation / ClearLookAt) */
+	bool bHasLookAtRotation = false;
+	FRotator LookAtRotation = FRotator::ZeroRotator;
+
+	bool bValid = false;
+};
+
 /**
  * Animation Instance base class for enemies.
  * Handles smooth transitions, look-at behavior, and state-driven animations.
+ *
+ * Update split:
+ *   NativeUpdateAnimation (game thread)          — copy owner data into Snapshot
+ *   NativeThreadSafeUpdateAnimation (worker)     — movement, state, look-at and
+ *                                                  turn-in-place from Snapshot
  */
 UCLASS()
 class SAIRANSKIES_API UEnemyAnimInstance : public UAnimInstance
@@ -23,6 +56,7 @@ public:
 
 	virtual void NativeInitializeAnimation() override;
 	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
 
 	// ==================== MOVEMENT ====================
 	
@@ -167,9 +201,21 @@ protected:
 	UPROPERTY()
 	AEnemyBase* OwnerEnemy;
 
+	/** Written on the game thread, read by the worker update */
+	FEnemyAnimSnapshot Snapshot;
+
+	/** Pending look-at requests (game thread only, moved into Snapshot) */
+	bool bPendingLookAtTarget = false;
+	FVector PendingLookAtTarget = FVector::ZeroVector;
+	bool bPendingLookAtRotation = false;
+	FRotator PendingLookAtRotation = FRotator::ZeroRotator;
+
 	// Cache previous state for transition detection
 	EEnemyState LastFrameState;
 
+	// Copy everything the update needs from the owner (game thread)
+	void GatherSnapshot();
+
 	// Update movement values
 	void UpdateMovementValues(float DeltaSeconds);
 
@@ -185,4 +231,3 @@ protected:
 	// Calculate movement direction
 	float CalculateMovementDirection() const;
 };
-
@@ -8,6 +8,18 @@
 
 class ASairanCharacter;
 
+/** Game-thread data gathered once per frame for the thread-safe update */
+struct FSairanAnimSnapshot
+{
+	FVector Velocity = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	bool bIsFalling = false;
+	bool bIsSprinting = false;
+	bool bIsAttacking = false;
+	bool bIsWeaponDrawn = true;
+	bool bValid = false;
+};
+
 UCLASS()
 class SAIRANSKIES_API USairanAnimInstance : public UAnimInstance
 {
@@ -15,8 +27,12 @@ class SAIRANSKIES_API USairanAnimInstance : public UAnimInstance
 
 public:
 	virtual void NativeInitializeAnimation() override;
+	/** Game thread: copy owner data into Snapshot */
 	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
 
+	/** Worker thread: derive the animation properties from Snapshot */
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
 	// ========== ANIMATION PROPERTIES ==========
 	UPROPERTY(BlueprintReadOnly, Category = "Animation")
 	ASairanCharacter* OwnerCharacter;
@@ -41,4 +57,7 @@ public:
 
 	UPROPERTY(BlueprintReadOnly, Category = "Animation")
 	float VerticalVelocity = 0.0f;
+
+private:
+	FSairanAnimSnapshot Snapshot;
 };
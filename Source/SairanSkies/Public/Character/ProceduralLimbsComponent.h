@@ -41,7 +41,6 @@
 class ASairanCharacter;
 class UStaticMeshComponent;
 class UMaterialInterface;
-class UMaterialInstanceDynamic;
 class UPoseableMeshComponent;
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -325,7 +324,10 @@ public:
 		meta=(ClampMin="0.01", ClampMax="1.0"))
 	float HitFlashDuration = 0.1f;
 
-	/** Activa el flash de golpe (llamar desde SairanCharacter::TakeDamage). */
+	/**
+	 * Activa el flash de golpe (llamar desde SairanCharacter::TakeDamage).
+	 * Escribe custom primitive data en cada extremidad vía UHitFlashSubsystem.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Limbs|HitFlash")
 	void StartHitFlash();
 
@@ -350,20 +352,6 @@ private:
 	float DeathPoseTimer   = 0.0f;
 	static constexpr float DeathCollapseDuration = 0.7f;
 
-	// Hit flash
-	void StopHitFlash();
-	FTimerHandle HitFlashTimerHandle;
-	UPROPERTY()
-	UMaterialInstanceDynamic* FlashMaterialInstance = nullptr;
-	bool bMaterialsCached = false;
-	// Materiales originales por componente (slot 0 cada uno; TashMesh puede tener N)
-	UPROPERTY() UMaterialInterface* OrigBodyMat   = nullptr;
-	UPROPERTY() UMaterialInterface* OrigHandRMat  = nullptr;
-	UPROPERTY() UMaterialInterface* OrigHandLMat  = nullptr;
-	UPROPERTY() UMaterialInterface* OrigFootRMat  = nullptr;
-	UPROPERTY() UMaterialInterface* OrigFootLMat  = nullptr;
-	UPROPERTY() TArray<UMaterialInterface*> OrigTashMats;
-
 	// ---- Factory helpers ----
 	UStaticMeshComponent* MakeSphereComp(const FString& Name, float WorldRadius,
 		UStaticMesh* Mesh, UMaterialInterface* Mat) const;
@@ -25,6 +25,7 @@ class UWeaponLerpComponent;
 class UInteractionComponent;
 class UProceduralLimbsComponent;
 class UUltimateComponent;
+class USairanCharacterMovementComponent;
 
 UENUM(BlueprintType)
 enum class ECharacterState : uint8
@@ -45,7 +46,7 @@ class SAIRANSKIES_API ASairanCharacter : public ACharacter
 	GENERATED_BODY()
 
 public:
-	ASairanCharacter();
+	ASairanCharacter(const FObjectInitializer& ObjectInitializer);
 
 protected:
 	virtual void BeginPlay() override;
@@ -417,6 +418,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Movement")
 	FVector GetMovementInputDirection() const;
 
+	/** Character movement with the grapple and dash modes */
+	USairanCharacterMovementComponent* GetSairanMovement() const { return SairanMovement; }
+
 protected:
 	// Input Callbacks
 	void Move(const FInputActionValue& Value);
@@ -447,8 +451,12 @@ private:
 	void UpdateGravityScale();
 	void SpawnWeapon();
 	void ResetDash();
+	void HandleDashFinished();
 	void HandleDeath();
 
+	UPROPERTY()
+	USairanCharacterMovementComponent* SairanMovement = nullptr;
+
 	FVector2D MovementInput;
 	float TargetCameraDistance;
 	FTimerHandle DashCooldownTimer;
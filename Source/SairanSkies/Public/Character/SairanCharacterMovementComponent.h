@@ -0,0 +1,159 @@
+// SairanSkies - Sairan Character Movement Component
+// Movimiento del jugador. El tirón del gancho, la frenada al soltarlo y el
+// dash son modos propios (PhysCustom) integrados en sub-pasos fijos, así que
+// se comportan igual a 30 y a 240 fps y cuestan un solo update de movimiento.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "SairanCharacterMovementComponent.generated.h"
+
+/** Custom movement modes (MOVE_Custom + this as CustomMovementMode) */
+UENUM(BlueprintType)
+enum class ESairanMovementMode : uint8
+{
+	None,
+	Grapple,          // Pulled towards the grapple target, no gravity
+	GrappleRelease,   // Falling with horizontal dampening after the release plane
+	Dash              // Constant-speed dash along the floor
+};
+
+/** One grapple pull, filled by UGrappleComponent when firing */
+struct FSairanGrapplePull
+{
+	FVector TargetPoint = FVector::ZeroVector;
+	float PullSpeed = 2500.0f;
+
+	/** Aim this many degrees below the target so the capsule clears the surface */
+	float AngleOffset = 15.0f;
+
+	/** Released this far before the release plane (cm) */
+	float ReleaseDistance = 100.0f;
+
+	/** Horizontal velocity lost over DampeningDuration after the release (0-1) */
+	float DampeningFactor = 0.8f;
+	float DampeningDuration = 1.0f;
+};
+
+DECLARE_MULTICAST_DELEGATE(FOnSairanGrappleReleased);
+DECLARE_MULTICAST_DELEGATE(FOnSairanDashFinished);
+
+/**
+ * UCharacterMovementComponent used by ASairanCharacter.
+ *
+ * Grapple:        velocity converges on the pull velocity with an exponential
+ *                 steer, one swept move per sub-step (rotation included).
+ *                 Crossing the release plane (or a head-on hit) switches to
+ *                 GrappleRelease and fires OnGrappleReleased.
+ * GrappleRelease: PhysFalling plus exact exponential decay of the horizontal
+ *                 velocity; falls back to MOVE_Falling after the dampening time.
+ * Dash:           constant velocity for the dash duration, kept on the floor.
+ *
+ * The air jump counter (ASairanCharacter::CurrentJumpCount) follows the mode:
+ * reset on reaching the ground, the ground jump is spent when a pull starts
+ * and only one jump is left after a grapple release.
+ */
+UCLASS()
+class SAIRANSKIES_API USairanCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	// ========== CONFIGURATION ==========
+
+	/** Largest integration step of the custom modes (s) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sairan Movement", meta = (ClampMin = "0.002", ClampMax = "0.05"))
+	float MaxCustomSubstep = 1.0f / 120.0f;
+
+	/** How quickly the pull velocity converges on the desired one (1/s) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sairan Movement|Grapple", meta = (ClampMin = "0.0"))
+	float GrappleSteering = 8.0f;
+
+	/** Pull speed fraction kept right next to the target (smooth arrival) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sairan Movement|Grapple", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MinPullSpeedRatio = 0.3f;
+
+	/** Yaw interpolation speed towards the pull direction */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sairan Movement|Grapple")
+	float GrappleRotationSpeed = 10.0f;
+
+	/** Hits whose normal faces the pull more than this (dot) end the pull early */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sairan Movement|Grapple", meta = (ClampMin = "-1.0", ClampMax = "0.0"))
+	float GrappleHeadOnHitDot = -0.7f;
+
+	// ========== GRAPPLE ==========
+
+	/** Enter the grapple mode towards Pull.TargetPoint */
+	void StartGrapple(const FSairanGrapplePull& Pull);
+
+	/** Leave the grapple / release modes (cancel, reset); no-op otherwise */
+	void StopGrapple();
+
+	bool IsGrappling() const { return IsSairanMode(ESairanMovementMode::Grapple); }
+	bool IsGrappleReleasing() const { return IsSairanMode(ESairanMovementMode::GrappleRelease); }
+
+	/** Broadcast when the pull lets go on its own (release plane or head-on hit) */
+	FOnSairanGrappleReleased OnGrappleReleased;
+
+	// ========== DASH ==========
+
+	void StartDash(const FVector& Direction, float Distance, float Duration);
+
+	bool IsDashing() const { return IsSairanMode(ESairanMovementMode::Dash); }
+
+	/** Broadcast whenever the dash mode ends (time out, lost floor, interrupted) */
+	FOnSairanDashFinished OnDashFinished;
+
+	// ========== JUMP ==========
+
+	/**
+	 * Air jump with a consistent height: vertical speed is replaced, not added.
+	 * During a pull it lets go of the rope (normal release, dampening included).
+	 */
+	void DoAirJump();
+
+	// ========== STATE ==========
+
+	bool IsSairanMode(ESairanMovementMode Mode) const
+	{
+		return MovementMode == MOVE_Custom && CustomMovementMode == static_cast<uint8>(Mode);
+	}
+
+	/** Grapple and release count as airborne (animation, jump rules, landing) */
+	virtual bool IsFalling() const override;
+
+	virtual float GetMaxSpeed() const override;
+	virtual float GetMaxBrakingDeceleration() const override;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+protected:
+	virtual void PhysCustom(float deltaTime, int32 Iterations) override;
+	virtual void PhysicsRotation(float DeltaTime) override;
+	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+
+private:
+	void PhysGrapple(float deltaTime, int32 Iterations);
+	void PhysGrappleRelease(float deltaTime, int32 Iterations);
+	void PhysDash(float deltaTime, int32 Iterations);
+
+	/** Switch from Grapple to GrappleRelease and keep simulating the remaining time */
+	void ReleaseGrapple(float RemainingTime, int32 Iterations);
+
+	/** Direction to the target, lowered by AngleOffset */
+	FVector GetPullDirection(const FVector& Location) const;
+
+	// Grapple state
+	FSairanGrapplePull ActivePull;
+	FVector GrapplePlaneNormal = FVector::ZeroVector;
+	float InitialPullDistance = 1.0f;
+	float DampeningTimeRemaining = 0.0f;
+
+	// Dash state
+	FVector DashVelocity = FVector::ZeroVector;
+	float DashTimeRemaining = 0.0f;
+
+	/** Ground dashes follow the floor and end when it runs out; air dashes stay level */
+	bool bDashOnGround = false;
+};
@@ -14,6 +14,8 @@ class AGrappleHookActor;
 class UGrappleCrosshairWidget;
 class APlayerController;
 class UCableComponent;
+class UGrapplePointSubsystem;
+class USairanCharacterMovementComponent;
 
 UENUM(BlueprintType)
 enum class EGrappleState : uint8
@@ -99,6 +101,19 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Grapple|AimAssist")
 	float AimAssistScreenRadius = 250.0f;
 
+	/** Screen distance multiplier for the current soft-lock target (< 1 = harder to steal) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Grapple|AimAssist", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float SoftLockStickiness = 0.7f;
+
+	/** The current soft-lock target stays locked up to AimAssistScreenRadius times this */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Grapple|AimAssist", meta = (ClampMin = "1.0"))
+	float SoftLockRadiusScale = 1.3f;
+
+	/** Screen distance (pixels) added to anchors whose baked approach looks blocked.
+	 *  The bake is coarse, so these are ranked last instead of discarded. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Grapple|AimAssist", meta = (ClampMin = "0.0"))
+	float BlockedApproachPenalty = 200.0f;
+
 	/** How quickly the aim snaps to the target (higher = faster) */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Grapple|AimAssist")
 	float AimAssistStickySpeed = 18.0f;
@@ -261,25 +276,24 @@ protected:
 	UPROPERTY()
 	ASairanCharacter* OwnerCharacter;
 
+	/** Owner's movement component, which integrates the pull and the release dampening */
+	UPROPERTY()
+	USairanCharacterMovementComponent* SairanMovement = nullptr;
+
 private:
 	// Core functions
 	void UpdateAiming(float DeltaTime);
 	void UpdatePulling(float DeltaTime);
+	void HandleGrappleReleased();
 	void UpdateCamera(float DeltaTime);
 	void UpdateCharacterRotation(float DeltaTime);
 	FHitResult PerformAimTrace();
 	void SetState(EGrappleState NewState);
 	void ResetGrapple();
 	
-	// Aim assist - find best grappleable target in screen area
-	AActor* FindBestGrappleTarget();
-	
-	// Calculate the adjusted target direction (15 degrees below actual target)
-	FVector CalculateGrappleDirection() const;
+	// Aim assist - find best grappleable target in screen area (anchor location out)
+	AActor* FindBestGrappleTarget(FVector& OutTargetLocation);
 	
-	// Check if we've passed the midpoint
-	bool HasPassedMidpoint() const;
-
 	// Grapple hook actor management
 	void SpawnGrappleHookActor();
 	void UpdateGrappleHookVisual();
@@ -303,9 +317,6 @@ private:
 	void LockCamera();
 	void UnlockCamera();
 
-	// Velocity dampening
-	void UpdateVelocityDampening(float DeltaTime);
-
 	// Camera state
 	float OriginalCameraDistance;
 	FVector OriginalCameraOffset;
@@ -317,24 +328,29 @@ private:
 	// Character rotation state
 	bool bOriginalOrientRotationToMovement;
 
-	// Gravity state
-	float OriginalGravityScale;
-
 	// Grapple state
-	FVector GrappleStartPoint;
-	FVector GrappleMidpoint;
-	float InitialDistanceToTarget;
 	bool bCameraTransitioning = false;
 
-	/** Unit vector from GrappleStartPoint to GrappleTargetPoint.
-	 *  Defines the normal of the release plane: the plane perpendicular to the
-	 *  grapple direction that passes through GrappleTargetPoint.
-	 *  When the player crosses this plane they are released from the grapple. */
-	FVector GrapplePlaneNormal = FVector::ZeroVector;
+	// Aim assist state
+	UPROPERTY()
+	UGrapplePointSubsystem* GrapplePoints = nullptr;
+
+	/** Anchor of CurrentSoftLockTarget (an actor may carry several) */
+	TWeakObjectPtr<USceneComponent> SoftLockAnchor;
+
+	/** Baked clearance before SoftLockAnchor along the current approach (0 without bake) */
+	float SoftLockReleaseDistance = 0.0f;
+
+	struct FGrappleCandidate
+	{
+		int32 Point = INDEX_NONE;
+		float ScreenDistance = 0.0f;
+		float ReleaseDistance = 0.0f;
+	};
 
-	// Post-grapple velocity dampening state
-	bool bIsDampeningVelocity = false;
-	float DampeningTimeRemaining = 0.0f;
+	// Reused every aiming frame
+	TArray<int32> CandidatePoints;
+	TArray<FGrappleCandidate> ScoredCandidates;
 
 	// Crosshair smooth tracking state
 	FVector2D CurrentCrosshairPos = FVector2D::ZeroVector;
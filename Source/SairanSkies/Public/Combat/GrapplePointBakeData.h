@@ -0,0 +1,129 @@
+// SairanSkies - Grapple Point Bake Data
+// Visibilidad y aproximación de los anclajes del gancho, horneadas offline
+// por UGrapplePointBakeCommandlet. Una por nivel: /Game/Grapple/Bake/GB_<Mapa>.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GrapplePointBakeData.generated.h"
+
+/** Baked answer for "can an anchor be seen from here?" */
+enum class EGrappleBakedVisibility : uint8
+{
+	Unknown,   // No data (outside the grid, unbaked cell, anchor not listed): trace at runtime
+	Hidden,    // No sample of the cell's view volume sees the anchor
+	Partial,   // Some samples see it, or the volume was not fully sampled: trace at runtime
+	Visible    // Every sample sees it
+};
+
+/**
+ * Per-level grapple bake.
+ *
+ * Anchors: world location, a mask of the approach directions whose pull
+ * path is clear (NumApproachBuckets buckets: 8 azimuth sectors x 4
+ * elevation bands), and per direction how far before the anchor the player
+ * capsule would first touch geometry (release distance).
+ *
+ * Visibility: a uniform 3D grid of player positions. Each cell is sampled
+ * over its whole volume grown by the camera radius (the runtime trace starts
+ * at the follow camera, not at the player). Each cell lists every anchor
+ * within BakedRange with an explicit state, sorted by index. Anchors that
+ * are not listed are Unknown, never Hidden: Hidden is only written when
+ * every sample of the view volume was free of geometry and blocked.
+ *
+ * Runtime anchors are matched to baked ones by location, so anchors that
+ * move away from their baked spot simply have no data.
+ */
+UCLASS()
+class SAIRANSKIES_API UGrapplePointBakeData : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 NumApproachBuckets = 32;
+
+	/** Bumped when the layout changes; older assets are ignored at runtime */
+	static constexpr int32 CurrentVersion = 2;
+
+	/** Release distances are stored in steps of this many cm (uint8) */
+	static constexpr float ReleaseDistanceUnit = 10.0f;
+
+	UPROPERTY(VisibleAnywhere, Category = "GrappleBake")
+	int32 Version = 0;
+
+	// ========== GRID ==========
+
+	UPROPERTY(VisibleAnywhere, Category = "GrappleBake")
+	FVector GridOrigin = FVector::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, Category = "GrappleBake")
+	float CellSize = 400.0f;
+
+	UPROPERTY(VisibleAnywhere, Category = "GrappleBake")
+	FIntVector GridSize = FIntVector::ZeroValue;
+
+	/** Anchors further than this from a cell centre are not listed in it */
+	UPROPERTY(VisibleAnywhere, Category = "GrappleBake")
+	float BakedRange = 0.0f;
+
+	// ========== ANCHORS ==========
+
+	UPROPERTY()
+	TArray<FVector> PointLocations;
+
+	/** Bit b set = approach bucket b is clear */
+	UPROPERTY()
+	TArray<uint32> ApproachMasks;
+
+	/** NumApproachBuckets per anchor, in ReleaseDistanceUnit steps */
+	UPROPERTY()
+	TArray<uint8> ReleaseDistances;
+
+	// ========== VISIBILITY ==========
+
+	/** 1 = baked, 0 = every sample was inside geometry */
+	UPROPERTY()
+	TArray<uint8> CellBaked;
+
+	/** Cell c owns CellEntries[CellStart[c] .. CellStart[c + 1]) */
+	UPROPERTY()
+	TArray<int32> CellStart;
+
+	/** (AnchorIndex << 2) | EGrappleBakedVisibility (Hidden/Partial/Visible), sorted per cell */
+	UPROPERTY()
+	TArray<uint32> CellEntries;
+
+	// ========== QUERIES ==========
+
+	virtual void PostLoad() override;
+
+	/** Rebuild the location lookup (after loading or baking) */
+	void BuildLookup();
+
+	/** Baked anchor at Location, INDEX_NONE if none */
+	int32 FindPoint(const FVector& Location) const;
+
+	EGrappleBakedVisibility GetVisibility(const FVector& PlayerLocation, int32 PointIndex) const;
+
+	/**
+	 * False if the bake found the pull from From's direction blocked. Buckets are
+	 * coarse (8 x 4), so treat it as a hint, not a hard reject.
+	 * OutReleaseDistance = extra release margin (cm), 0 if blocked.
+	 */
+	bool GetApproach(int32 PointIndex, const FVector& From, float& OutReleaseDistance) const;
+
+	/** Cell index of Location, INDEX_NONE outside the grid */
+	int32 GetCellIndex(const FVector& Location) const;
+
+	FVector GetCellCenter(int32 CellIndex) const;
+
+	static int32 GetApproachBucket(const FVector& Direction);
+	static FVector GetApproachDirection(int32 Bucket);
+
+private:
+	/** Quantized location (cm) → anchor index */
+	TMap<FIntVector, int32> PointByLocation;
+
+	static FIntVector QuantizeLocation(const FVector& Location);
+};
@@ -0,0 +1,27 @@
+// SairanSkies - Grapple Point Component
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "GrapplePointComponent.generated.h"
+
+/**
+ * Lightweight grapple anchor.
+ * Add it to any actor the hook should lock onto and place it where the hook
+ * lands. It registers with UGrapplePointSubsystem, so aim assist never scans
+ * the world for tagged actors. Moving the component updates its entry.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class SAIRANSKIES_API UGrapplePointComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+	UGrapplePointComponent();
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
+};
@@ -0,0 +1,197 @@
+// SairanSkies - Grapple Point Subsystem
+// Registro de anclajes del gancho con hash espacial.
+// Aim assist pregunta aquí en vez de GetAllActorsWithTag cada tick.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
+#include "GrapplePointSubsystem.generated.h"
+
+struct FConvexVolume;
+class UGrapplePointBakeData;
+
+/** One registered grapple anchor */
+struct FGrapplePoint
+{
+	/** UGrapplePointComponent, or the root of a legacy tagged actor */
+	TWeakObjectPtr<USceneComponent> Anchor;
+	TObjectKey<USceneComponent> Key;
+	FVector Location = FVector::ZeroVector;
+	FIntPoint Cell = FIntPoint::ZeroValue;
+
+	/** Matching anchor in the level bake (INDEX_NONE = not baked or moved) */
+	int32 BakedIndex = INDEX_NONE;
+
+	/** Cached line of sight from the viewer (GFrameCounter of the trace) */
+	uint64 LineOfSightFrame = 0;
+	bool bLineOfSightValid = false;
+	bool bVisible = false;
+
+	AActor* GetActor() const
+	{
+		const USceneComponent* Component = Anchor.Get();
+		return Component ? Component->GetOwner() : nullptr;
+	}
+};
+
+/**
+ * World-level registry of grapple anchors for UGrappleComponent aim assist.
+ *
+ * Anchors live in a dense array bucketed in a uniform XY hash (CellSize cm).
+ * UGrapplePointComponent registers itself; actors that only carry the
+ * grapple tag are picked up once by RegisterTaggedActors. Both follow their
+ * anchor when it moves: the component through OnUpdateTransform, tagged
+ * actors with a Movable root through the root's TransformUpdated.
+ *
+ * Query (one per aiming frame):
+ *   1. GatherCandidates: cells within range, then range + view frustum test
+ *   2. The caller projects the survivors with its own view-projection
+ *   3. HasLineOfSight on the best candidates only, best first
+ *
+ * Line of sight is cached per anchor. Anchors asked about on the previous
+ * frame get an async refresh (AsyncLineTraceByChannel) once their result is
+ * LineOfSightCacheFrames old; only an anchor with no usable result pays a
+ * synchronous trace. Assumes a single viewer (the local player camera).
+ *
+ * If the level has a bake (UGrapplePointBakeCommandlet), it is consulted
+ * before any trace: anchors hidden from the whole view volume of the player's
+ * cell are rejected and anchors seen from all of it are accepted as a table
+ * lookup; anything else uses the cached trace. Baked approach data is a
+ * hint: the grapple component only ranks blocked anchors lower.
+ *
+ * Cost depends on the anchors near the player, not on the actors in the level.
+ */
+UCLASS()
+class SAIRANSKIES_API UGrapplePointSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	/** Side of a hash cell in cm. Roughly the grapple range. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GrapplePoints", meta = (ClampMin = "100.0"))
+	float CellSize = 2000.0f;
+
+	/** Age (frames) at which a cached line of sight gets an async refresh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GrapplePoints", meta = (ClampMin = "1"))
+	int32 LineOfSightCacheFrames = 4;
+
+	/** Cap on async traces issued per frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GrapplePoints", meta = (ClampMin = "1"))
+	int32 MaxTracesPerFrame = 8;
+
+	/** Radius used for the frustum test (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GrapplePoints")
+	float PointRadius = 50.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GrapplePoints")
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+
+	/** Folder holding the per-level bakes (GB_<MapName>); loaded by path, so it must be in DirectoriesToAlwaysCook */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GrapplePoints|Bake")
+	FString BakeDataDirectory = TEXT("/Game/Grapple/Bake");
+
+	/** Accept anchors every sample of the player's cell sees without tracing */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GrapplePoints|Bake")
+	bool bTrustBakedVisibility = true;
+
+	// ========== REGISTRATION ==========
+
+	void RegisterPoint(USceneComponent* Anchor);
+	void UnregisterPoint(USceneComponent* Anchor);
+
+	/** Re-read Anchor's location (moving anchors) */
+	void UpdatePoint(USceneComponent* Anchor);
+
+	/** Register every actor with Tag that has no UGrapplePointComponent (once per tag); Movable roots are kept up to date */
+	void RegisterTaggedActors(FName Tag);
+
+	UFUNCTION(BlueprintPure, Category = "GrapplePoints")
+	int32 GetNumPoints() const { return Points.Num(); }
+
+	// ========== QUERIES ==========
+
+	/** Indices of anchors within Range of Origin whose sphere touches Frustum */
+	void GatherCandidates(const FVector& Origin, float Range, const FConvexVolume& Frustum, TArray<int32>& OutPoints) const;
+
+	const FGrapplePoint& GetPoint(int32 PointIndex) const { return Points[PointIndex]; }
+
+	/** Baked table first, then cached visibility from ViewOrigin (synchronous seed trace if unknown) */
+	bool HasLineOfSight(int32 PointIndex, const FVector& ViewOrigin, const AActor* Viewer);
+
+	/** Baked approach from From: false if the bake found it blocked (true without bake data) */
+	bool GetApproach(int32 PointIndex, const FVector& From, float& OutReleaseDistance) const;
+
+	UFUNCTION(BlueprintPure, Category = "GrapplePoints")
+	bool HasBakeData() const { return BakeData != nullptr; }
+
+private:
+	struct FPendingTrace
+	{
+		TObjectKey<USceneComponent> Key;
+		FTraceHandle Handle;
+		uint64 Frame = 0;
+	};
+
+	/** Dense array of anchors */
+	TArray<FGrapplePoint> Points;
+
+	/** Anchor → index into Points */
+	TMap<TObjectKey<USceneComponent>, int32> IndexByAnchor;
+
+	/** Cell → indices into Points */
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	/** Tags already swept by RegisterTaggedActors */
+	TSet<FName> RegisteredTags;
+
+	/** Movable roots of tagged actors → their TransformUpdated binding */
+	TMap<TObjectKey<USceneComponent>, FDelegateHandle> MovableTaggedAnchors;
+
+	/** Anchors asked about on QueryFrame (async refresh set) */
+	TArray<TObjectKey<USceneComponent>> QueriedPoints;
+	uint64 QueryFrame = 0;
+
+	TArray<FPendingTrace> PendingTraces;
+
+	UPROPERTY()
+	UGrapplePointBakeData* BakeData = nullptr;
+
+	/** Last viewer, reused by the async refresh */
+	FVector LastViewOrigin = FVector::ZeroVector;
+	TWeakObjectPtr<const AActor> LastViewer;
+
+	FIntPoint ToCell(const FVector& Location) const;
+	void AddToCell(const FIntPoint& Cell, int32 PointIndex);
+	void RemoveFromCell(const FIntPoint& Cell, int32 PointIndex);
+
+	int32 FindBakedIndex(const FVector& Location) const;
+
+	/** Swap-remove Points[Index], fixing up the moved point's references */
+	void RemovePointAt(int32 Index);
+
+	bool IsPending(const TObjectKey<USceneComponent>& Key) const;
+
+	void PollPendingTraces();
+	void IssueTraces();
+
+	/** Ignores the viewer and the anchor's own actor, like the old per-actor trace */
+	FCollisionQueryParams MakeTraceParams(const FGrapplePoint& Point) const;
+
+	UFUNCTION()
+	void HandleTaggedActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	void HandleTaggedAnchorMoved(USceneComponent* Anchor, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+};
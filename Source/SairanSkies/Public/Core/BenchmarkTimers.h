@@ -0,0 +1,113 @@
+// SairanSkies - Benchmark Timers
+// Game-thread time per gameplay area (plus a few counters), accumulated only
+// while a recorder is attached: the stress benchmark or the
+// Sairan.FrameBreakdown console command. Otherwise a scope costs one branch.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Frame breakdown / benchmark CSV column groups */
+enum class EBenchmarkBucket : uint8
+{
+	AITick,			// simulation, significance, ambient director, registry
+	BehaviorTree,	// behavior tree component ticks (tasks, services, decorators)
+	Perception,		// perception service + line-of-sight cache
+	Movement,		// character movement, avoidance, flow fields, path queue, nav cache
+	Animation,		// anim instance game-thread update
+	GroupCombat,	// UGroupCombatManager
+	Combat,			// player hit detection, targeting
+	Traversal,		// grapple
+	UI,				// damage numbers, health bars, crosshair
+	VFX,			// hit flashes, ragdolls, procedural limbs
+
+	Count
+};
+
+enum class EBenchmarkCounter : uint8
+{
+	EnemiesTicked,
+	TracesIssued,
+	WidgetsSpawned,
+
+	Count
+};
+
+namespace SairanBenchmark
+{
+	static constexpr int32 NumBuckets = static_cast<int32>(EBenchmarkBucket::Count);
+	static constexpr int32 NumCounters = static_cast<int32>(EBenchmarkCounter::Count);
+
+	/** True between OnBeginFrame / OnEndFrame while any recorder is attached */
+	extern SAIRANSKIES_API bool bRecording;
+
+	/** Current frame (game thread only) */
+	extern SAIRANSKIES_API uint64 BucketCycles[NumBuckets];
+	extern SAIRANSKIES_API uint32 Counters[NumCounters];
+
+	SAIRANSKIES_API const TCHAR* GetBucketName(EBenchmarkBucket Bucket);
+	SAIRANSKIES_API const TCHAR* GetCounterName(EBenchmarkCounter Counter);
+
+	/** One recorded frame */
+	struct FFrameSample
+	{
+		double FrameMs = 0.0;
+		double BucketMs[NumBuckets] = {};
+		uint32 Counters[NumCounters] = {};
+	};
+
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnFrameSampled, const FFrameSample&);
+
+	/** Record every frame from the next one on until removed; recorders share the same samples */
+	SAIRANSKIES_API FDelegateHandle AddRecorder(FOnFrameSampled::FDelegate&& Recorder);
+	SAIRANSKIES_API void RemoveRecorder(FDelegateHandle Handle);
+
+	inline void AddCount(EBenchmarkCounter Counter, uint32 Amount)
+	{
+		if (bRecording)
+		{
+			Counters[static_cast<int32>(Counter)] += Amount;
+		}
+	}
+
+	/**
+	 * Exclusive timing: a nested scope pauses the enclosing one, so buckets
+	 * add up to at most the frame time (a GroupCombat query inside a BT task
+	 * is charged to GroupCombat only).
+	 */
+	struct SAIRANSKIES_API FScope
+	{
+		explicit FScope(EBenchmarkBucket InBucket)
+			: Bucket(InBucket)
+		{
+			if (bRecording)
+			{
+				Enter();
+			}
+		}
+
+		~FScope()
+		{
+			if (bActive)
+			{
+				Exit();
+			}
+		}
+
+		FScope(const FScope&) = delete;
+		FScope& operator=(const FScope&) = delete;
+
+	private:
+		void Enter();
+		void Exit();
+
+		EBenchmarkBucket Bucket;
+		bool bActive = false;
+		uint64 StartCycles = 0;
+		FScope* Parent = nullptr;
+	};
+}
+
+/** Charge the rest of the enclosing scope to EBenchmarkBucket::Bucket */
+#define SAIRAN_BENCHMARK_SCOPE(Bucket) \
+	SairanBenchmark::FScope PREPROCESSOR_JOIN(BenchmarkScope_, __LINE__)(EBenchmarkBucket::Bucket)
@@ -0,0 +1,40 @@
+// SairanSkies - Enemy Benchmark Commandlet
+// Runs UEnemyStressBenchmark once per enemy count in a headless child game
+// process and writes a summary CSV (mean / p95 / max per column and phase).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EnemyBenchmarkCommandlet.generated.h"
+
+/**
+ * UnrealEditor-Cmd SairanSkies.uproject -run=EnemyBenchmark
+ *   [-Map=/Game/Levels/Enemy_Level_Demo] [-Counts=25,50,100,200]
+ *   [-Frames=1800] [-Warmup=300] [-FPS=30] [-Out=<dir>]
+ *
+ * Each count runs "<Project> <Map> -game -nullrhi -benchmark -fps=<FPS>
+ * -EnemyBenchmark ..." (fixed time step, so every run simulates the same
+ * game time) and leaves Enemies_<N>.csv in the output directory next to
+ * Summary.csv. Returns 1 if any run failed.
+ *
+ * The map needs a navmesh around the player start (patrol ring + combat area).
+ * Packaged builds have no commandlets: run the -EnemyBenchmark line directly.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEnemyBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** Launch one headless run; true if it exited cleanly and wrote CsvPath */
+	bool RunBenchmark(const FString& Map, int32 NumEnemies, int32 Frames, int32 Warmup, int32 FPS, const FString& CsvPath) const;
+
+	/** Append one summary row per phase (plus "All") of CsvPath to SummaryRows */
+	bool SummarizeRun(const FString& CsvPath, int32 NumEnemies, TArray<FString>& SummaryRows) const;
+};
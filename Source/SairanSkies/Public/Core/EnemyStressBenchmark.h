@@ -0,0 +1,121 @@
+// SairanSkies - Enemy Stress Benchmark
+// Headless scaling benchmark: spawns N enemies on patrol paths and in a wave
+// zone, drives the player pawn through patrol → chase → combat for a fixed
+// number of frames and writes one CSV row per measured frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/BenchmarkTimers.h"
+#include "EnemyStressBenchmark.generated.h"
+
+class AEnemyBase;
+class APatrolPath;
+class AWaveZone;
+
+/**
+ * Enemy stress benchmark (only created with -EnemyBenchmark on the command line).
+ *
+ *   <Project> <Map> -game -nullrhi -nosound -unattended -benchmark -fps=30 -deterministic
+ *     -EnemyBenchmark -BenchEnemies=200 -BenchFrames=1800 -BenchCSV=<file>
+ *
+ * Optional: -BenchWarmup=<frames> -BenchRadius=<cm> -BenchEnemyClass=<class path>.
+ * UEnemyBenchmarkCommandlet runs this for several enemy counts and summarises.
+ *
+ * Setup (player pawn present, navmesh built): the arena is centred on the
+ * player. Half the enemies patrol APatrolPaths on a ring of ArenaRadius (out
+ * of sight), the other half belong to an AWaveZone (one wave) placed between
+ * the player and the ring. The player cannot be damaged.
+ *
+ * Phases (measured frames split in three):
+ *   Patrol — player idle at the centre
+ *   Chase  — player runs a circle close to the patrol ring
+ *   Combat — player stands in the wave zone (wave + chasers engage)
+ *
+ * CSV columns: frame / phase, frame and game-thread ms, ms per
+ * EBenchmarkBucket, EBenchmarkCounter values, enemies, physical / virtual
+ * memory, UObject count.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyStressBenchmark : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION (command line) ==========
+
+	int32 NumEnemies = 100;
+	int32 NumMeasuredFrames = 1800;
+	int32 WarmupFrames = 300;
+	float ArenaRadius = 3000.0f;
+	FString CsvPath;
+	FString EnemyClassPath = TEXT("/Game/Blueprints/AI/BP_NormalEnemy.BP_NormalEnemy_C");
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	enum class EPhase : uint8
+	{
+		Setup,
+		Warmup,
+		Patrol,
+		Chase,
+		Combat,
+		Done
+	};
+
+	/** Setup gives up after this many frames without player / navmesh */
+	static constexpr int32 MaxSetupFrames = 600;
+
+	/** Enemies per runtime patrol path */
+	static constexpr int32 EnemiesPerPatrolPath = 8;
+
+	EPhase Phase = EPhase::Setup;
+	int32 PhaseFrame = 0;
+	int32 MeasuredFrame = 0;
+
+	FVector ArenaCenter = FVector::ZeroVector;
+	FVector CombatPoint = FVector::ZeroVector;
+	float ChaseAngle = 0.0f;
+
+	UPROPERTY()
+	TSubclassOf<AEnemyBase> EnemyClass;
+
+	UPROPERTY()
+	TArray<APatrolPath*> PatrolPaths;
+
+	UPROPERTY()
+	AWaveZone* WaveZone = nullptr;
+
+	/** SairanBenchmark recorder, attached for the measured phases */
+	FDelegateHandle RecorderHandle;
+
+	TArray<FString> CsvRows;
+
+	/** Running sums for the closing log line */
+	double SumFrameMs = 0.0;
+	double SumBucketMs[SairanBenchmark::NumBuckets] = {};
+
+	bool TrySetup();
+	void SpawnPatrolEnemies(int32 Count);
+	void SpawnWaveZone(int32 Count);
+
+	void DrivePlayer(float DeltaTime);
+	void MovePlayerTowards(const FVector& Point, float AcceptanceRadius);
+
+	void OnFrameSampled(const SairanBenchmark::FFrameSample& Sample);
+
+	void Finish(bool bSuccess);
+
+	static const TCHAR* GetPhaseName(EPhase InPhase);
+};
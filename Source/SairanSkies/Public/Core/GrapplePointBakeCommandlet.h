@@ -0,0 +1,70 @@
+// SairanSkies - Grapple Point Bake Commandlet
+// Hornea, por nivel, la visibilidad de los anclajes del gancho sobre una
+// rejilla de posiciones del jugador y las direcciones de aproximación libres.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GrapplePointBakeCommandlet.generated.h"
+
+class UGrapplePointBakeData;
+
+/**
+ * UnrealEditor-Cmd SairanSkies.uproject -run=GrapplePointBake -nullrhi
+ *   -Maps=/Game/Levels/Level_A,/Game/Levels/Level_B
+ *   [-Tag=Grapple] [-Range=3000] [-CellSize=400] [-ApproachLength=1500]
+ *   [-MaxRelease=600] [-CapsuleRadius=42] [-CapsuleHalfHeight=96]
+ *   [-ViewRadius=200] [-SamplesPerAxis=3] [-Out=/Game/Grapple/Bake]
+ *
+ * Anchors are the same ones UGrapplePointSubsystem registers at runtime:
+ * every UGrapplePointComponent plus the root of every actor with Tag that
+ * has none. Writes <Out>/GB_<MapName> (UGrapplePointBakeData), which the
+ * subsystem loads on world begin play. Range should match the grapple
+ * component's MaxGrappleRange. ViewRadius covers where the follow camera
+ * can sit around the player while aiming (arm length + socket offset); each
+ * cell is sampled with a SamplesPerAxis^3 lattice over its volume grown by
+ * it. Returns 1 if any map failed.
+ *
+ * <Out> must be cooked: it is listed in DirectoriesToAlwaysCook
+ * (Config/DefaultGame.ini) because the bakes are loaded by path.
+ *
+ * Rebake after moving anchors or occluders; moved anchors fall back to
+ * runtime traces. World Partition maps only bake what is loaded by default.
+ */
+UCLASS()
+class SAIRANSKIES_API UGrapplePointBakeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGrapplePointBakeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	struct FBakeSettings
+	{
+		FName Tag = FName("Grapple");
+		FString OutDir = TEXT("/Game/Grapple/Bake");
+		float Range = 3000.0f;
+		float CellSize = 400.0f;
+		float ApproachLength = 1500.0f;
+		float MaxRelease = 600.0f;
+		float CapsuleRadius = 42.0f;
+		float CapsuleHalfHeight = 96.0f;
+		float ViewRadius = 200.0f;
+		int32 SamplesPerAxis = 3;
+	};
+
+	/** Load Map with collision and every sublevel; nullptr on failure */
+	UWorld* LoadWorld(const FString& Map) const;
+	void ReleaseWorld(UWorld* World) const;
+
+	bool BakeMap(const FString& Map, const FBakeSettings& Settings) const;
+
+	void BakeApproach(UWorld* World, const TArray<AActor*>& PointActors, const FBakeSettings& Settings, UGrapplePointBakeData* Data) const;
+	void BakeVisibility(UWorld* World, const TArray<AActor*>& PointActors, const FBakeSettings& Settings, UGrapplePointBakeData* Data) const;
+
+	bool SaveBakeData(UGrapplePointBakeData* Data, const FString& PackageName) const;
+};
@@ -0,0 +1,74 @@
+// SairanSkies - Hit Flash
+// Flash de golpe compartido por enemigos y extremidades del jugador.
+// Sin cambios de material: el material base lee custom primitive data.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "HitFlashSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * Central hit-flash service.
+ *
+ * A flash is two custom primitive data writes on the component:
+ *   [CustomDataIndex]       flash amount (1 while flashing, 0 otherwise)
+ *   [CustomDataIndex + 1..3] flash colour (RGB)
+ * Base materials lerp their colour / emissive towards the flash colour by the
+ * flash amount (Custom Primitive Data nodes, same indices). The materials and
+ * render state are never touched.
+ *
+ * One expiry list for the whole world, walked in Tick. Hitting a component
+ * that is already flashing pushes its end time back and only rewrites the
+ * colour if it changed (a stronger / different hit), so combos and laser
+ * ticks cost a map lookup per hit.
+ */
+UCLASS()
+class SAIRANSKIES_API UHitFlashSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========== CONFIGURATION ==========
+
+	/** First custom primitive data slot used by the flash (4 floats: amount + RGB); baked into the base materials */
+	static constexpr int32 CustomDataIndex = 0;
+
+	// ========== FLASH ==========
+
+	/** Flash Component with Color for Duration seconds (extends an ongoing flash, taking the new colour) */
+	UFUNCTION(BlueprintCallable, Category = "HitFlash")
+	void Flash(UPrimitiveComponent* Component, FLinearColor Color, float Duration);
+
+	/** End a flash now (pool reuse, death...) */
+	UFUNCTION(BlueprintCallable, Category = "HitFlash")
+	void ClearFlash(UPrimitiveComponent* Component);
+
+	UFUNCTION(BlueprintPure, Category = "HitFlash")
+	int32 GetNumActiveFlashes() const { return Flashes.Num(); }
+
+private:
+	struct FActiveFlash
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Component;
+		TObjectKey<UPrimitiveComponent> Key;
+		FLinearColor Color = FLinearColor::White;
+		float EndTime = 0.0f;
+	};
+
+	TArray<FActiveFlash> Flashes;
+	TMap<TObjectKey<UPrimitiveComponent>, int32> IndexByComponent;
+
+	void WriteFlashAmount(UPrimitiveComponent* Component, float Amount) const;
+	void WriteFlashColor(UPrimitiveComponent* Component, const FLinearColor& Color) const;
+	void RemoveAt(int32 Index);
+};
@@ -0,0 +1,40 @@
+// SairanSkies - Profiling
+// STAT groups for the gameplay systems ("stat SairanAI", "stat SairanCombat"...)
+// and the scope macro every hot path uses: cycle counter + Unreal Insights CPU
+// event + Sairan.FrameBreakdown bucket in one line.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Core/BenchmarkTimers.h"
+
+DECLARE_STATS_GROUP(TEXT("Sairan AI"), STATGROUP_SairanAI, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("Sairan Combat"), STATGROUP_SairanCombat, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("Sairan Traversal"), STATGROUP_SairanTraversal, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("Sairan UI"), STATGROUP_SairanUI, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("Sairan VFX"), STATGROUP_SairanVFX, STATCAT_Advanced);
+
+// Counters shared by several files (per-file cycle stats are declared in their .cpp)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Enemies Ticked"), STAT_Sairan_EnemiesTicked, STATGROUP_SairanAI, SAIRANSKIES_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Traces"), STAT_Sairan_AITraces, STATGROUP_SairanAI, SAIRANSKIES_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Combat Traces"), STAT_Sairan_CombatTraces, STATGROUP_SairanCombat, SAIRANSKIES_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Traversal Traces"), STAT_Sairan_TraversalTraces, STATGROUP_SairanTraversal, SAIRANSKIES_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Widgets Spawned"), STAT_Sairan_WidgetsSpawned, STATGROUP_SairanUI, SAIRANSKIES_API);
+
+/**
+ * Time the rest of the scope under Stat (stat group), as an Insights CPU
+ * event named after Stat, and in EBenchmarkBucket::Bucket.
+ */
+#define SAIRAN_SCOPE(Stat, Bucket) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE(Stat); \
+	SAIRAN_BENCHMARK_SCOPE(Bucket)
+
+/** Add Amount to a DWORD counter stat and to the matching frame breakdown counter */
+#define SAIRAN_COUNT(Stat, Counter, Amount) \
+	do { \
+		INC_DWORD_STAT_BY(Stat, Amount); \
+		SairanBenchmark::AddCount(EBenchmarkCounter::Counter, Amount); \
+	} while (0)
@@ -17,8 +17,10 @@ class USoundBase;
  *  - El jugador entra en el BoxTrigger → comienza la oleada 1 (BaseEnemyCount enemigos).
  *  - Cada oleada duplica el número de enemigos (10, 20, 40, 80...).
  *  - La siguiente oleada no empieza hasta que todos los enemigos de la actual hayan muerto.
- *  - El jugador sale → todos los enemigos se destruyen y la zona se reinicia a la oleada 0.
+ *  - El jugador sale → todos los enemigos vuelven al pool y la zona se reinicia a la oleada 0.
  *  - El jugador vuelve a entrar → comienza de nuevo desde la oleada 1.
+ *  - Los enemigos salen de UEnemyPoolSubsystem (pre-creados al entrar y durante
+ *    cada oleada) y vuelven a él tras el ragdoll, sin SpawnActor/Destroy por oleada.
  *
  * Configuración mínima en el nivel:
  *  1. Colocar AWaveZone en el nivel.
@@ -75,6 +77,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wave")
 	float SpawnTraceHeight = 300.0f;
 
+	/**
+	 * Enemigos pre-creados (ocultos, sin IA) al entrar en la zona.
+	 * Durante cada oleada se pre-crean también los de la siguiente, de modo que
+	 * spawnear una oleada solo reutiliza actores del pool.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wave|Pool",
+		meta=(ClampMin="0"))
+	int32 PrewarmCount = 20;
+
 	/** Sonido al comenzar una nueva oleada */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Wave|SFX")
 	USoundBase* WaveStartSound = nullptr;
@@ -114,6 +125,9 @@ private:
 	void ResetZone();
 	bool FindSpawnLocation(FVector& OutLocation) const;
 
+	/** Enemigos totales de la oleada WaveIndex (BaseEnemyCount × 2^(WaveIndex-1)) */
+	int32 GetWaveEnemyCount(int32 WaveIndex) const;
+
 	int32 EnemiesAliveCount    = 0;
 	int32 EnemiesToSpawnQueue  = 0;
 
@@ -1,39 +1,21 @@
-// SairanSkies - Damage Number Component (UMG Widget-based floating damage numbers)
+// SairanSkies - Damage Number Component (floating damage numbers)
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Fonts/SlateFontInfo.h"
 #include "DamageNumberComponent.generated.h"
 
-class UWidgetComponent;
 class UDamageNumberWidget;
+class UDamageNumberSubsystem;
 class UFont;
 class UMaterialInterface;
 
 /**
- * Stores data for a single floating damage number instance (Widget-based)
- */
-USTRUCT()
-struct FFloatingDamageNumber
-{
-	GENERATED_BODY()
-
-	UPROPERTY()
-	UWidgetComponent* WidgetComponent = nullptr;
-
-	UPROPERTY()
-	UDamageNumberWidget* Widget = nullptr;
-
-	float Lifetime = 0.0f;
-	float MaxLifetime = 1.0f;
-	FVector InitialLocation = FVector::ZeroVector;
-	FLinearColor NumberColor = FLinearColor::White;
-};
-
-/**
- * Attach to enemies. Spawns individual damage numbers at hit locations
- * using UMG Widgets for proper custom font support.
+ * Attach to enemies. Pushes damage numbers at hit locations into
+ * UDamageNumberSubsystem, which paints all of them from one HUD layer
+ * (no widget or component per hit).
  * Numbers float upward and fade out over their lifetime.
  * Color goes green -> orange -> red based on remaining health percentage.
  * Shows X on death.
@@ -50,8 +32,6 @@ protected:
 	virtual void BeginPlay() override;
 
 public:
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
 	// ========== MAIN FUNCTIONS ==========
 
 	/** Spawn a floating damage number at a specific world location */
@@ -69,10 +49,15 @@ public:
 	// ========== SETTINGS ==========
 
 	/**
-	 * Widget class for damage numbers.
-	 * Create a Widget Blueprint inheriting from UDamageNumberWidget
-	 * and add a TextBlock named "DamageText".
-	 * Set your custom font in the TextBlock's Font property in the WBP.
+	 * Font for the numbers (size comes from TextFontSize).
+	 * Ignored when DamageNumberWidgetClass is set: its DamageText font wins.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "DamageNumbers|Settings")
+	FSlateFontInfo NumberFont;
+
+	/**
+	 * Optional Widget Blueprint inheriting from UDamageNumberWidget with a
+	 * TextBlock named "DamageText": only its font is used.
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "DamageNumbers|Settings")
 	TSubclassOf<UDamageNumberWidget> DamageNumberWidgetClass;
@@ -93,14 +78,14 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "DamageNumbers|Settings")
 	int32 TextFontSize = 24;
 
-	/** Draw size for the widget component */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "DamageNumbers|Settings")
-	FVector2D WidgetDrawSize = FVector2D(120.0f, 60.0f);
-
 	/** Offset above the enemy's head for death marker (in cm) */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "DamageNumbers|Settings")
 	float DeathMarkerHeightOffset = 120.0f;
 
+	/** How long the death marker stays up (seconds) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "DamageNumbers|Settings")
+	float DeathMarkerDuration = 3.0f;
+
 	/** Color at full health */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "DamageNumbers|Colors")
 	FLinearColor FullHealthColor = FLinearColor(0.0f, 1.0f, 0.0f, 1.0f);
@@ -132,17 +117,15 @@ public:
 	UMaterialInterface* FontMaterial = nullptr;
 	UPROPERTY()
 	float TextSize = 24.0f;
+	UPROPERTY()
+	FVector2D WidgetDrawSize = FVector2D(120.0f, 60.0f);
 
 private:
 	FLinearColor GetColorForHealthPercent(float HealthPercent) const;
-	void CleanupNumber(int32 Index);
-
-	UPROPERTY()
-	TArray<FFloatingDamageNumber> ActiveNumbers;
 
 	UPROPERTY()
-	UWidgetComponent* DeathWidgetComponent = nullptr;
+	UDamageNumberSubsystem* Numbers = nullptr;
 
-	bool bIsShowingDeath = false;
-	FTimerHandle DeathTimerHandle;
+	uint8 NumberStyle = 0;
+	uint8 DeathStyle = 0;
 };
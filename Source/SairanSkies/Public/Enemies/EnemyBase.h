@@ -6,6 +6,7 @@
 #include "GameFramework/Character.h"
 #include "EnemyTypes.h"
 #include "Perception/AIPerceptionTypes.h"
+#include "AI/EnemyLineOfSightCache.h"
 #include "EnemyBase.generated.h"
 
 // Forward declarations
@@ -16,8 +17,14 @@ class UAnimMontage;
 class UNiagaraSystem;
 class USoundBase;
 class UDamageNumberComponent;
-class UWidgetComponent;
 class UEnemyHealthBarWidget;
+class UEnemySimulationManager;
+class UEnemySignificanceManager;
+class UEnemyLineOfSightCache;
+class UEnemyPoolSubsystem;
+class UEnemyAmbientDirector;
+enum class EEnemySimTimer : uint8;
+enum class EEnemyAmbientEvent : uint8;
 
 UCLASS(Abstract)
 class SAIRANSKIES_API AEnemyBase : public ACharacter
@@ -25,15 +32,12 @@ class SAIRANSKIES_API AEnemyBase : public ACharacter
 	GENERATED_BODY()
 
 public:
-	AEnemyBase();
+	AEnemyBase(const FObjectInitializer& ObjectInitializer);
 
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-public:	
-	virtual void Tick(float DeltaTime) override;
-
 	// ==================== CONFIGURATION ====================
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy|Combat")
@@ -66,11 +70,10 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy|UI")
 	UDamageNumberComponent* DamageNumberComponent;
 
-	/** Floating health bar above the enemy */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy|UI")
-	UWidgetComponent* HealthBarWidgetComponent;
-
-	/** Widget class for enemy health bar (create a WBP inheriting from UEnemyHealthBarWidget) */
+	/**
+	 * Widget class for enemy health bar (create a WBP inheriting from UEnemyHealthBarWidget).
+	 * Shown by UEnemyHealthBarSubsystem's overlay once damaged; no bar if unset.
+	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Enemy|UI")
 	TSubclassOf<UEnemyHealthBarWidget> HealthBarWidgetClass;
 
@@ -104,9 +107,6 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy|State")
 	bool bCanAttack = true;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy|State")
-	float TimeSinceLastSawTarget;
-
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy|State")
 	int32 NearbyAlliesCount = 0;
 
@@ -145,9 +145,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Enemy|State")
 	bool IsInCombatZone() const;
 
+	/** Served from UEnemyLineOfSightCache (one shared trace per update window) */
 	UFUNCTION(BlueprintPure, Category = "Enemy|State")
 	bool CanSeeTarget() const;
 
+	/** Cached visibility of the current target, with the time it was traced */
+	UFUNCTION(BlueprintPure, Category = "Enemy|State")
+	FEnemyLineOfSightResult GetTargetLineOfSight() const;
+
 	UFUNCTION(BlueprintPure, Category = "Enemy|State")
 	bool IsAlerted() const;
 
@@ -171,6 +176,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Enemy|Perception")
 	void SetTarget(AActor* NewTarget, EEnemySenseType SenseType);
 
+	/** Seconds since the current target was last visible (0 when visible or no target) */
+	UFUNCTION(BlueprintPure, Category = "Enemy|Perception")
+	float GetTimeSinceLastSawTarget() const;
+
 	// ==================== COMBAT ====================
 public:
 	UFUNCTION(BlueprintCallable, Category = "Enemy|Combat")
@@ -195,28 +204,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Enemy|VFX")
 	float HitFlashDuration = 0.1f;
 
-	/** Start the hit flash effect */
+	/** Start the hit flash effect (custom primitive data write, see UHitFlashSubsystem) */
 	UFUNCTION(BlueprintCallable, Category = "Enemy|VFX")
 	void StartHitFlash();
 
 protected:
-	/** Stop the hit flash effect and restore original materials */
+	/** End the hit flash now */
 	void StopHitFlash();
 
-	/** Timer handle for hit flash */
-	FTimerHandle HitFlashTimerHandle;
-
-	/** Original materials to restore after flash */
-	UPROPERTY()
-	TArray<UMaterialInterface*> OriginalMaterials;
-
-	/** Dynamic material instance for flash effect */
-	UPROPERTY()
-	UMaterialInstanceDynamic* FlashMaterialInstance;
-
-	/** Whether we have cached the original materials */
-	bool bMaterialsCached = false;
-
 	/** Timer handle for despawn after death */
 	FTimerHandle DespawnTimerHandle;
 
@@ -318,15 +313,16 @@ public:
 
 protected:
 	bool bIsInRandomPause = false;
-	float RandomPauseTimer = 0.0f;
 	float RandomPauseDuration = 0.0f;
 
 	bool bIsLookingAround = false;
-	float LookAroundTimer = 0.0f;
+	/** Second half of a look-around: rotating back to OriginalRotation */
+	bool bIsLookingBack = false;
 	FRotator OriginalRotation;
 	FRotator TargetLookRotation;
 
-	void UpdateRandomPause(float DeltaTime);
+	/** Look-around phase elapsed (LookAround timer) */
+	void AdvanceLookAround();
 	void UpdateLookAround(float DeltaTime);
 
 	// ==================== CONVERSATION SYSTEM ====================
@@ -356,13 +352,18 @@ protected:
 	UPROPERTY()
 	AEnemyBase* ConversationPartner = nullptr;
 
-	float ConversationTimer = 0.0f;
 	float ConversationDuration = 0.0f;
-	float GestureTimer = 0.0f;
-	float ConversationCooldownTimer = 0.0f;
-	float TimeWaitingAtPoint = 0.0f;
 	bool bIsConversationInitiator = false;
 
+	/** Waited TimeBeforeConversation in Idle / random pause — can be picked as a partner */
+	bool bReadyForConversation = false;
+
+	/** World time until which no new conversation can start */
+	float ConversationCooldownEndTime = 0.0f;
+
+	/** Arm or clear the ConversationWait event according to the current state */
+	void UpdateConversationWait();
+
 	void UpdateConversation(float DeltaTime);
 	void PerformConversationGesture();
 
@@ -385,9 +386,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Enemy|VFX")
 	void SpawnHitEffect(FVector Location);
 
-protected:
-	float AttackCooldownTimer;
-
 	// ==================== BLACKBOARD KEYS ====================
 public:
 	static const FName BB_TargetActor;
@@ -398,6 +396,12 @@ public:
 	static const FName BB_DistanceToTarget;
 	static const FName BB_CanAttack;
 
+protected:
+	/** Push the EEnemyBlackboardSync values in Mask to the controller's blackboard (change-driven) */
+	void SyncBlackboard(uint8 Mask);
+
+public:
+
 	// ==================== DEATH / DESPAWN ====================
 
 	/** Delay before the enemy is destroyed after death (seconds) */
@@ -433,6 +437,132 @@ protected:
 	static TArray<AEnemyBase*> ActiveAttackers;
 	bool bIsActiveAttacker = false;
 
+	// ==================== SIMULATION (replaces actor Tick) ====================
+protected:
+	friend class UEnemySimulationManager;
+
+	/** Slot in UEnemySimulationManager arrays (owned by the manager) */
+	int32 SimulationSlot = INDEX_NONE;
+
+	UPROPERTY()
+	UEnemySimulationManager* SimulationManager = nullptr;
+
+	/** Called by the manager on the frame a timer reaches zero */
+	virtual void OnSimulationTimerExpired(EEnemySimTimer Timer);
+
+	/** Per-frame work for the EEnemySimContinuous bits in Mask */
+	void UpdateSimulationContinuous(uint8 Mask, float DeltaTime);
+
+	/** Push the continuous-work mask derived from the current state to the manager */
+	void RefreshSimulationContinuous();
+
+	/** Visibility check for the current target; resets the LoseSight timer when seen */
+	void UpdateTargetTracking();
+
+	void SetSimTimer(EEnemySimTimer Timer, float Seconds);
+	void ClearSimTimer(EEnemySimTimer Timer);
+	bool IsSimTimerActive(EEnemySimTimer Timer) const;
+
+	// ==================== AMBIENT (pauses, look-arounds, conversations) ====================
+protected:
+	friend class UEnemyAmbientDirector;
+
+	/** Record handle in UEnemyAmbientDirector (owned by the director) */
+	int32 AmbientHandle = INDEX_NONE;
+
+	UPROPERTY()
+	UEnemyAmbientDirector* AmbientDirector = nullptr;
+
+	/** Called by the director when a scheduled ambient event comes due */
+	virtual void OnAmbientEvent(EEnemyAmbientEvent Event);
+
+	void ScheduleAmbient(EEnemyAmbientEvent Event, float Seconds);
+	void CancelAmbient(EEnemyAmbientEvent Event);
+	bool IsAmbientScheduled(EEnemyAmbientEvent Event) const;
+
+	// ==================== SIGNIFICANCE (AI LOD) ====================
+public:
+	UFUNCTION(BlueprintPure, Category = "Enemy|Significance")
+	EEnemySignificance GetSignificanceTier() const { return SignificanceTier; }
+
+	/** Called by UEnemySignificanceManager when the tier changes */
+	void SetSignificance(EEnemySignificance NewTier);
+
+protected:
+	friend class UEnemySignificanceManager;
+
+	/** Slot in UEnemySignificanceManager (owned by the manager) */
+	int32 SignificanceSlot = INDEX_NONE;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Enemy|Significance")
+	EEnemySignificance SignificanceTier = EEnemySignificance::Critical;
+
+	// ==================== LINE OF SIGHT ====================
+protected:
+	friend class UEnemyLineOfSightCache;
+
+	/** Slot in UEnemyLineOfSightCache (owned by the cache) */
+	int32 LineOfSightSlot = INDEX_NONE;
+
+	UPROPERTY()
+	UEnemyLineOfSightCache* LineOfSightCache = nullptr;
+
+	// ==================== GROUP COMBAT ====================
+protected:
+	friend class UGroupCombatManager;
+
+	/** Handle into UGroupCombatManager records (owned by the manager) */
+	int32 CombatHandle = INDEX_NONE;
+
+	// ==================== RAGDOLL ====================
+protected:
+	friend class UEnemyRagdollManager;
+
+	/** Slot in UEnemyRagdollManager corpses (owned by the manager) */
+	int32 RagdollSlot = INDEX_NONE;
+
+	/** Full-body physics + DeathRagdollImpulse (only when the ragdoll budget allows it) */
+	void StartRagdoll();
+
+	// ==================== POOLING ====================
+public:
+	/**
+	 * Bring a parked enemy back as if freshly spawned at Location: health, state,
+	 * materials, mesh/capsule/movement, health bar, AI managers, controller + BT
+	 * (the blackboard is re-initialised when the tree restarts).
+	 */
+	virtual void ResetForReuse(const FVector& Location, const FRotator& Rotation);
+
+	/** Park the enemy: unpossess, leave every AI manager, hide, no collision / ticking */
+	virtual void DeactivateForPool();
+
+	UFUNCTION(BlueprintPure, Category = "Enemy|Pool")
+	bool IsInPool() const { return bInPool; }
+
+protected:
+	friend class UEnemyPoolSubsystem;
+
+	/** Pool that created this enemy (null for enemies placed in the level) */
+	UPROPERTY()
+	UEnemyPoolSubsystem* OwningPool = nullptr;
+
+	/** Parked in OwningPool */
+	bool bInPool = false;
+
+	/** Controller kept across pool cycles (unpossessed while parked) */
+	UPROPERTY()
+	AController* PooledController = nullptr;
+
+	/** Mesh attachment / collision captured on BeginPlay to undo the ragdoll */
+	FTransform MeshRelativeTransform;
+	FName MeshCollisionProfile;
+
+	/** BeginPlay / ResetForReuse: registry, line of sight, simulation, significance */
+	void RegisterWithManagers();
+
+	/** EndPlay / DeactivateForPool: every manager the enemy may be in */
+	void UnregisterFromManagers();
+
 	// ==================== VIRTUAL METHODS FOR SUBCLASSES ====================
 protected:
 	virtual void OnStateEnter(EEnemyState NewState);
@@ -0,0 +1,37 @@
+// SairanSkies - Enemy Movement Component
+// Character movement for enemies: walks like the default component, then lets
+// UEnemyAvoidanceManager bend the resulting velocity around nearby enemies.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "EnemyMovementComponent.generated.h"
+
+class UEnemyAvoidanceManager;
+
+/**
+ * UCharacterMovementComponent used by AEnemyBase.
+ *
+ * CalcVelocity reports the velocity the enemy wants (path following or
+ * AddMovementInput) to the avoidance manager and applies the correction
+ * from the manager's last batched ORCA solve.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void CalcVelocity(float DeltaTime, float Friction, bool bFluid, float BrakingDeceleration) override;
+
+protected:
+	friend class UEnemyAvoidanceManager;
+
+	/** Slot in UEnemyAvoidanceManager (owned by the manager) */
+	int32 AvoidanceSlot = INDEX_NONE;
+
+	UPROPERTY()
+	UEnemyAvoidanceManager* AvoidanceManager = nullptr;
+};
@@ -42,6 +42,40 @@ enum class EEnemySenseType : uint8
 	Alert		UMETA(DisplayName = "Alert From Ally")
 };
 
+/**
+ * Niveles de significancia (LOD de IA) — de mayor a menor coste
+ */
+UENUM(BlueprintType)
+enum class EEnemySignificance : uint8
+{
+	Critical	UMETA(DisplayName = "Critical"),	// En combate / alertado: todo a máxima frecuencia
+	High		UMETA(DisplayName = "High"),		// Cerca o visible en pantalla
+	Medium		UMETA(DisplayName = "Medium"),		// Distancia media
+	Low			UMETA(DisplayName = "Low")			// Lejos y fuera de pantalla: casi sin coste
+};
+
+/**
+ * Frecuencias de actualización aplicadas a un enemigo según su nivel de significancia.
+ * Un intervalo de 0 significa "cada frame".
+ */
+USTRUCT(BlueprintType)
+struct FEnemySignificanceTierSettings
+{
+	GENERATED_BODY()
+
+	/** Intervalo de tick del CharacterMovementComponent (s) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float MovementTickInterval = 0.0f;
+
+	/** Si la vista (sight) de la percepción está activa — el oído sigue siempre activo */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance")
+	bool bSightEnabled = true;
+
+	/** Intervalo de tick de la malla / animación (s) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float AnimationTickInterval = 0.0f;
+};
+
 /**
  * Configuración de combate del enemigo
  */
@@ -12,14 +12,12 @@ class SAIRANSKIES_API ANormalEnemy : public AEnemyBase
 	GENERATED_BODY()
 
 public:
-	ANormalEnemy();
+	ANormalEnemy(const FObjectInitializer& ObjectInitializer);
 
 protected:
 	virtual void BeginPlay() override;
 
 public:
-	virtual void Tick(float DeltaTime) override;
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Normal Enemy|Behavior")
 	float LowAlliesAggressionMultiplier = 0.5f;
 
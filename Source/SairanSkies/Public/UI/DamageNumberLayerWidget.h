@@ -0,0 +1,41 @@
+// SairanSkies - Damage Number Layer Widget
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "DamageNumberLayerWidget.generated.h"
+
+/**
+ * Full-screen, hit-test invisible layer that paints every live entry of
+ * UDamageNumberSubsystem in NativePaint: one view projection per frame, one
+ * text element per visible number. No child widgets.
+ *
+ * Number strings and their measured sizes are cached per (style, value),
+ * so a laser hitting for the same amount every tick formats it once.
+ */
+UCLASS()
+class SAIRANSKIES_API UDamageNumberLayerWidget : public UUserWidget
+{
+	GENERATED_BODY()
+
+protected:
+	virtual void NativeConstruct() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+private:
+	struct FCachedGlyph
+	{
+		FString Text;
+		FVector2D Size = FVector2D::ZeroVector;
+	};
+
+	/** Cleared when it grows past this (many distinct values) */
+	static constexpr int32 MaxCachedGlyphs = 2048;
+
+	const FCachedGlyph& GetGlyph(uint8 Style, int32 Value, const FSlateFontInfo& Font) const;
+
+	mutable TMap<uint64, FCachedGlyph> GlyphCache;
+};
@@ -0,0 +1,123 @@
+// SairanSkies - Damage Number Subsystem
+// Todos los números de daño del mundo en un ring buffer de tamaño fijo.
+// Los enemigos solo empujan entradas; una única capa de HUD las pinta.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Fonts/SlateFontInfo.h"
+#include "DamageNumberSubsystem.generated.h"
+
+class UDamageNumberWidget;
+class UDamageNumberLayerWidget;
+
+/** One floating number (or death marker) in the ring buffer */
+struct FDamageNumberEntry
+{
+	/** Value shown; INDEX_NONE draws the death marker ("X") */
+	int32 Value = 0;
+	uint32 OwnerId = 0;
+	uint8 Style = 0;
+	bool bFloatAndFade = true;
+
+	FVector Location = FVector::ZeroVector;
+	FLinearColor Color = FLinearColor::White;
+	float SpawnTime = 0.0f;
+	float Lifetime = 0.0f;
+	float FloatUpSpeed = 0.0f;
+
+	bool IsAlive(float Now) const { return Now - SpawnTime < Lifetime; }
+};
+
+/**
+ * World-wide damage number buffer.
+ *
+ * Pushing a number writes one entry (oldest entry is overwritten when full);
+ * nothing is created per hit. UDamageNumberLayerWidget, added once to the
+ * local player's screen, projects and paints every live entry each frame.
+ * Position and fade are derived from the entry's age, so entries are never
+ * updated after being pushed.
+ *
+ * Styles are registered fonts (face + size) referenced by index, so an entry
+ * stays a small POD.
+ */
+UCLASS()
+class SAIRANSKIES_API UDamageNumberSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// ========== CONFIGURATION ==========
+
+	/** Ring buffer size: max numbers on screen at once */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DamageNumbers", meta = (ClampMin = "16"))
+	int32 Capacity = 256;
+
+	/** Numbers further than this from the camera are not drawn (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DamageNumbers")
+	float MaxDrawDistance = 5000.0f;
+
+	/** Z-order of the layer on the player screen */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DamageNumbers")
+	int32 LayerZOrder = 5;
+
+	// ========== STYLES ==========
+
+	/** Index of Font at FontSize (registered once, shared by every caller) */
+	uint8 RegisterStyle(const FSlateFontInfo& Font, int32 FontSize);
+
+	/** Same, taking the font of a legacy damage number widget's DamageText (falls back to Fallback) */
+	uint8 RegisterWidgetStyle(TSubclassOf<UDamageNumberWidget> WidgetClass, const FSlateFontInfo& Fallback, int32 FontSize);
+
+	const FSlateFontInfo& GetStyleFont(uint8 Style) const { return Styles[Style]; }
+
+	// ========== ENTRIES ==========
+
+	/** Floating number that rises and fades over Lifetime */
+	void PushNumber(const UObject* Owner, const FVector& Location, int32 Value, const FLinearColor& Color,
+		uint8 Style, float Lifetime, float FloatUpSpeed);
+
+	/** Static death marker ("X") shown for Lifetime */
+	void PushMarker(const UObject* Owner, const FVector& Location, const FLinearColor& Color, uint8 Style, float Lifetime);
+
+	/** Drop every entry pushed by Owner (pool reuse, respawn) */
+	void ClearOwner(const UObject* Owner);
+
+	/** Drop expired entries from the old end of the ring */
+	void Prune(float Now);
+
+	/** Visit live entries, oldest first */
+	template <typename FunctorType>
+	void ForEachLive(float Now, FunctorType&& Functor) const
+	{
+		const int32 Cap = Entries.Num();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const FDamageNumberEntry& Entry = Entries[(Head - Count + i + Cap) % Cap];
+			if (Entry.IsAlive(Now))
+			{
+				Functor(Entry);
+			}
+		}
+	}
+
+	int32 GetNumEntries() const { return Count; }
+
+private:
+	FDamageNumberEntry& AddEntry();
+	void EnsureLayer();
+
+	TArray<FDamageNumberEntry> Entries;
+	int32 Head = 0;
+	int32 Count = 0;
+
+	TArray<FSlateFontInfo> Styles;
+	TMap<TObjectKey<UClass>, FSlateFontInfo> WidgetFonts;
+
+	UPROPERTY()
+	TObjectPtr<UDamageNumberLayerWidget> Layer;
+};
@@ -12,6 +12,9 @@ class UTextBlock;
  * Widget for displaying a single floating damage number.
  * Supports custom fonts via UMG's native font system (no TextRenderComponent issues).
  * Create a Widget Blueprint inheriting from this and add a TextBlock named "DamageText".
+ *
+ * Numbers are now painted by UDamageNumberLayerWidget; this widget is only
+ * instantiated once per class to read the DamageText font as a style.
  */
 UCLASS()
 class SAIRANSKIES_API UDamageNumberWidget : public UUserWidget
@@ -31,6 +34,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "DamageNumber")
 	void SetFontSize(int32 Size);
 
+	/** Font of the DamageText block; false if the WBP has none */
+	bool GetDamageFont(FSlateFontInfo& OutFont) const;
+
 protected:
 	/** Bind to a TextBlock named "DamageText" in the Widget Blueprint */
 	UPROPERTY(meta = (BindWidgetOptional))
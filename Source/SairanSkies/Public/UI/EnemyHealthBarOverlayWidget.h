@@ -0,0 +1,63 @@
+// SairanSkies - Enemy Health Bar Overlay Widget
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "EnemyHealthBarOverlayWidget.generated.h"
+
+class AEnemyBase;
+class UCanvasPanel;
+class UEnemyHealthBarWidget;
+
+/**
+ * Full-screen, hit-test invisible canvas holding a small pool of
+ * UEnemyHealthBarWidget elements for UEnemyHealthBarSubsystem.
+ *
+ * Each frame: one view projection, pick the closest eligible enemies (up to
+ * MaxVisibleBars) and move their bars with a render translation. An element
+ * keeps its enemy while it stays visible, and UpdateHealth only runs when
+ * the pushed value differs from the one shown. Unused elements are
+ * collapsed, never destroyed.
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyHealthBarOverlayWidget : public UUserWidget
+{
+	GENERATED_BODY()
+
+protected:
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+	virtual void NativeConstruct() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
+private:
+	struct FBarElement
+	{
+		UEnemyHealthBarWidget* Widget = nullptr;
+		TWeakObjectPtr<AEnemyBase> Enemy;
+		float ShownPercent = -1.0f;
+		bool bInUse = false;
+		bool bVisible = false;
+	};
+
+	struct FBarCandidate
+	{
+		int32 EntryIndex = INDEX_NONE;
+		double DistanceSq = 0.0;
+		FVector2D Position = FVector2D::ZeroVector;
+		int32 Element = INDEX_NONE;
+	};
+
+	/** Free element of BarClass, creating one if none is left */
+	int32 AcquireElement(UClass* BarClass, const FVector2D& BarSize);
+
+	void HideAll();
+
+	UPROPERTY()
+	TObjectPtr<UCanvasPanel> Canvas;
+
+	/** Widgets are owned by the canvas */
+	TArray<FBarElement> Elements;
+
+	TArray<FBarCandidate> Candidates;
+};
@@ -0,0 +1,83 @@
+// SairanSkies - Enemy Health Bar Subsystem
+// Barras de vida de todos los enemigos en un solo overlay.
+// Los valores se empujan al recibir daño; nada se consulta por frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "EnemyHealthBarSubsystem.generated.h"
+
+class AEnemyBase;
+class UEnemyHealthBarWidget;
+class UEnemyHealthBarOverlayWidget;
+
+/** One damaged enemy that may get a bar */
+struct FEnemyHealthBarEntry
+{
+	TWeakObjectPtr<AEnemyBase> Enemy;
+	TObjectKey<AEnemyBase> Key;
+	TSubclassOf<UEnemyHealthBarWidget> BarClass;
+	float HealthPercent = 1.0f;
+	float HeightOffset = 0.0f;
+};
+
+/**
+ * Health bar overlay service.
+ *
+ * Enemies report their health when damaged (ReportHealth) and leave on
+ * death / pool return / EndPlay (RemoveEnemy). Enemies at full health are
+ * never tracked, so undamaged waves cost nothing.
+ *
+ * UEnemyHealthBarOverlayWidget, added once to the local player screen,
+ * picks the closest tracked enemies that are in combat, within
+ * MaxDrawDistance and on screen, up to MaxVisibleBars, and shows them with
+ * a small pool of bar widgets (HealthBarWidgetClass of each enemy).
+ */
+UCLASS()
+class SAIRANSKIES_API UEnemyHealthBarSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// ========== CONFIGURATION ==========
+
+	/** Bars shown at once (closest enemies win) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HealthBars", meta = (ClampMin = "1"))
+	int32 MaxVisibleBars = 12;
+
+	/** Enemies further than this from the camera get no bar (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HealthBars")
+	float MaxDrawDistance = 3000.0f;
+
+	/** On-screen bar size (layer units) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HealthBars")
+	FVector2D BarSize = FVector2D(150.0f, 15.0f);
+
+	/** Z-order of the overlay on the player screen */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HealthBars")
+	int32 LayerZOrder = 4;
+
+	// ========== BARS ==========
+
+	/** Push Enemy's health (after damage); full health removes its bar */
+	void ReportHealth(AEnemyBase* Enemy, float HealthPercent);
+
+	/** Stop tracking Enemy (death, pool return, EndPlay) */
+	void RemoveEnemy(AEnemyBase* Enemy);
+
+	const TArray<FEnemyHealthBarEntry>& GetEntries() const { return Entries; }
+
+private:
+	void RemoveAt(int32 Index);
+	void EnsureOverlay();
+
+	TArray<FEnemyHealthBarEntry> Entries;
+	TMap<TObjectKey<AEnemyBase>, int32> IndexByEnemy;
+
+	UPROPERTY()
+	TObjectPtr<UEnemyHealthBarOverlayWidget> Overlay;
+};